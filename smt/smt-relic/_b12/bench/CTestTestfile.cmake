@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/smt/smt-relic/bench
+# Build directory: /root/repo/smt/smt-relic/_b12/bench
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,114 @@
+# Install script for directory: /root/repo/smt/smt-relic
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/relic" TYPE FILE FILES
+    "/root/repo/smt/smt-relic/include/relic.h"
+    "/root/repo/smt/smt-relic/include/relic_alloc.h"
+    "/root/repo/smt/smt-relic/include/relic_arch.h"
+    "/root/repo/smt/smt-relic/include/relic_bc.h"
+    "/root/repo/smt/smt-relic/include/relic_bench.h"
+    "/root/repo/smt/smt-relic/include/relic_bn.h"
+    "/root/repo/smt/smt-relic/include/relic_core.h"
+    "/root/repo/smt/smt-relic/include/relic_cp.h"
+    "/root/repo/smt/smt-relic/include/relic_dv.h"
+    "/root/repo/smt/smt-relic/include/relic_eb.h"
+    "/root/repo/smt/smt-relic/include/relic_ec.h"
+    "/root/repo/smt/smt-relic/include/relic_ed.h"
+    "/root/repo/smt/smt-relic/include/relic_ep.h"
+    "/root/repo/smt/smt-relic/include/relic_epx.h"
+    "/root/repo/smt/smt-relic/include/relic_err.h"
+    "/root/repo/smt/smt-relic/include/relic_fb.h"
+    "/root/repo/smt/smt-relic/include/relic_fbx.h"
+    "/root/repo/smt/smt-relic/include/relic_fp.h"
+    "/root/repo/smt/smt-relic/include/relic_fpx.h"
+    "/root/repo/smt/smt-relic/include/relic_label.h"
+    "/root/repo/smt/smt-relic/include/relic_md.h"
+    "/root/repo/smt/smt-relic/include/relic_mpc.h"
+    "/root/repo/smt/smt-relic/include/relic_multi.h"
+    "/root/repo/smt/smt-relic/include/relic_pc.h"
+    "/root/repo/smt/smt-relic/include/relic_pp.h"
+    "/root/repo/smt/smt-relic/include/relic_rand.h"
+    "/root/repo/smt/smt-relic/include/relic_test.h"
+    "/root/repo/smt/smt-relic/include/relic_types.h"
+    "/root/repo/smt/smt-relic/include/relic_util.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/relic/low" TYPE FILE FILES
+    "/root/repo/smt/smt-relic/include/low/relic_bn_low.h"
+    "/root/repo/smt/smt-relic/include/low/relic_dv_low.h"
+    "/root/repo/smt/smt-relic/include/low/relic_fb_low.h"
+    "/root/repo/smt/smt-relic/include/low/relic_fp_low.h"
+    "/root/repo/smt/smt-relic/include/low/relic_fpx_low.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/relic" TYPE DIRECTORY FILES "/root/repo/smt/smt-relic/_b12/include/")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/cmake" TYPE FILE FILES "/root/repo/smt/smt-relic/cmake/relic-config.cmake")
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for each subdirectory.
+  include("/root/repo/smt/smt-relic/_b12/src/cmake_install.cmake")
+  include("/root/repo/smt/smt-relic/_b12/test/cmake_install.cmake")
+  include("/root/repo/smt/smt-relic/_b12/bench/cmake_install.cmake")
+
+endif()
+
+if(CMAKE_INSTALL_COMPONENT)
+  set(CMAKE_INSTALL_MANIFEST "install_manifest_${CMAKE_INSTALL_COMPONENT}.txt")
+else()
+  set(CMAKE_INSTALL_MANIFEST "install_manifest.txt")
+endif()
+
+string(REPLACE ";" "\n" CMAKE_INSTALL_MANIFEST_CONTENT
+       "${CMAKE_INSTALL_MANIFEST_FILES}")
+file(WRITE "/root/repo/smt/smt-relic/_b12/${CMAKE_INSTALL_MANIFEST}"
+     "${CMAKE_INSTALL_MANIFEST_CONTENT}")
@@ -0,0 +1,9 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/smt/smt-relic
+# Build directory: /root/repo/smt/smt-relic/_bn446
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("src")
+subdirs("test")
+subdirs("bench")
@@ -0,0 +1,44 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/smt/smt-relic/test
+# Build directory: /root/repo/smt/smt-relic/_bn446/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test_err "/root/repo/smt/smt-relic/_bn446/bin/test_err")
+set_tests_properties(test_err PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/smt/smt-relic/test/CMakeLists.txt;10;add_test;/root/repo/smt/smt-relic/test/CMakeLists.txt;14;ADD_MODULE;/root/repo/smt/smt-relic/test/CMakeLists.txt;0;")
+add_test(test_bn "/root/repo/smt/smt-relic/_bn446/bin/test_bn")
+set_tests_properties(test_bn PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/smt/smt-relic/test/CMakeLists.txt;10;add_test;/root/repo/smt/smt-relic/test/CMakeLists.txt;18;ADD_MODULE;/root/repo/smt/smt-relic/test/CMakeLists.txt;0;")
+add_test(test_dv "/root/repo/smt/smt-relic/_bn446/bin/test_dv")
+set_tests_properties(test_dv PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/smt/smt-relic/test/CMakeLists.txt;10;add_test;/root/repo/smt/smt-relic/test/CMakeLists.txt;22;ADD_MODULE;/root/repo/smt/smt-relic/test/CMakeLists.txt;0;")
+add_test(test_fp "/root/repo/smt/smt-relic/_bn446/bin/test_fp")
+set_tests_properties(test_fp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/smt/smt-relic/test/CMakeLists.txt;10;add_test;/root/repo/smt/smt-relic/test/CMakeLists.txt;26;ADD_MODULE;/root/repo/smt/smt-relic/test/CMakeLists.txt;0;")
+add_test(test_fpx "/root/repo/smt/smt-relic/_bn446/bin/test_fpx")
+set_tests_properties(test_fpx PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/smt/smt-relic/test/CMakeLists.txt;10;add_test;/root/repo/smt/smt-relic/test/CMakeLists.txt;30;ADD_MODULE;/root/repo/smt/smt-relic/test/CMakeLists.txt;0;")
+add_test(test_fb "/root/repo/smt/smt-relic/_bn446/bin/test_fb")
+set_tests_properties(test_fb PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/smt/smt-relic/test/CMakeLists.txt;10;add_test;/root/repo/smt/smt-relic/test/CMakeLists.txt;34;ADD_MODULE;/root/repo/smt/smt-relic/test/CMakeLists.txt;0;")
+add_test(test_fbx "/root/repo/smt/smt-relic/_bn446/bin/test_fbx")
+set_tests_properties(test_fbx PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/smt/smt-relic/test/CMakeLists.txt;10;add_test;/root/repo/smt/smt-relic/test/CMakeLists.txt;38;ADD_MODULE;/root/repo/smt/smt-relic/test/CMakeLists.txt;0;")
+add_test(test_ep "/root/repo/smt/smt-relic/_bn446/bin/test_ep")
+set_tests_properties(test_ep PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/smt/smt-relic/test/CMakeLists.txt;10;add_test;/root/repo/smt/smt-relic/test/CMakeLists.txt;42;ADD_MODULE;/root/repo/smt/smt-relic/test/CMakeLists.txt;0;")
+add_test(test_epx "/root/repo/smt/smt-relic/_bn446/bin/test_epx")
+set_tests_properties(test_epx PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/smt/smt-relic/test/CMakeLists.txt;10;add_test;/root/repo/smt/smt-relic/test/CMakeLists.txt;46;ADD_MODULE;/root/repo/smt/smt-relic/test/CMakeLists.txt;0;")
+add_test(test_eb "/root/repo/smt/smt-relic/_bn446/bin/test_eb")
+set_tests_properties(test_eb PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/smt/smt-relic/test/CMakeLists.txt;10;add_test;/root/repo/smt/smt-relic/test/CMakeLists.txt;50;ADD_MODULE;/root/repo/smt/smt-relic/test/CMakeLists.txt;0;")
+add_test(test_ed "/root/repo/smt/smt-relic/_bn446/bin/test_ed")
+set_tests_properties(test_ed PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/smt/smt-relic/test/CMakeLists.txt;10;add_test;/root/repo/smt/smt-relic/test/CMakeLists.txt;54;ADD_MODULE;/root/repo/smt/smt-relic/test/CMakeLists.txt;0;")
+add_test(test_ec "/root/repo/smt/smt-relic/_bn446/bin/test_ec")
+set_tests_properties(test_ec PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/smt/smt-relic/test/CMakeLists.txt;10;add_test;/root/repo/smt/smt-relic/test/CMakeLists.txt;58;ADD_MODULE;/root/repo/smt/smt-relic/test/CMakeLists.txt;0;")
+add_test(test_pc "/root/repo/smt/smt-relic/_bn446/bin/test_pc")
+set_tests_properties(test_pc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/smt/smt-relic/test/CMakeLists.txt;10;add_test;/root/repo/smt/smt-relic/test/CMakeLists.txt;62;ADD_MODULE;/root/repo/smt/smt-relic/test/CMakeLists.txt;0;")
+add_test(test_pp "/root/repo/smt/smt-relic/_bn446/bin/test_pp")
+set_tests_properties(test_pp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/smt/smt-relic/test/CMakeLists.txt;10;add_test;/root/repo/smt/smt-relic/test/CMakeLists.txt;66;ADD_MODULE;/root/repo/smt/smt-relic/test/CMakeLists.txt;0;")
+add_test(test_md "/root/repo/smt/smt-relic/_bn446/bin/test_md")
+set_tests_properties(test_md PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/smt/smt-relic/test/CMakeLists.txt;10;add_test;/root/repo/smt/smt-relic/test/CMakeLists.txt;70;ADD_MODULE;/root/repo/smt/smt-relic/test/CMakeLists.txt;0;")
+add_test(test_cp "/root/repo/smt/smt-relic/_bn446/bin/test_cp")
+set_tests_properties(test_cp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/smt/smt-relic/test/CMakeLists.txt;10;add_test;/root/repo/smt/smt-relic/test/CMakeLists.txt;74;ADD_MODULE;/root/repo/smt/smt-relic/test/CMakeLists.txt;0;")
+add_test(test_mpc "/root/repo/smt/smt-relic/_bn446/bin/test_mpc")
+set_tests_properties(test_mpc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/smt/smt-relic/test/CMakeLists.txt;10;add_test;/root/repo/smt/smt-relic/test/CMakeLists.txt;78;ADD_MODULE;/root/repo/smt/smt-relic/test/CMakeLists.txt;0;")
+add_test(test_rand "/root/repo/smt/smt-relic/_bn446/bin/test_rand")
+set_tests_properties(test_rand PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/smt/smt-relic/test/CMakeLists.txt;10;add_test;/root/repo/smt/smt-relic/test/CMakeLists.txt;81;ADD_MODULE;/root/repo/smt/smt-relic/test/CMakeLists.txt;0;")
+add_test(test_core "/root/repo/smt/smt-relic/_bn446/bin/test_core")
+set_tests_properties(test_core PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/smt/smt-relic/test/CMakeLists.txt;10;add_test;/root/repo/smt/smt-relic/test/CMakeLists.txt;82;ADD_MODULE;/root/repo/smt/smt-relic/test/CMakeLists.txt;0;")
@@ -1070,17 +1070,22 @@ static void bgn(void) {
 }
 
 static void bls(void) {
-	uint8_t msg[5] = { 0, 1, 2, 3, 4 };
-	g1_t s;
-	g2_t p;
-	bn_t d;
+	uint8_t msg[5] = { 0, 1, 2, 3, 4 }, m[16][5];
+	const uint8_t *ms[16];
+	size_t ls[16];
+	g1_t s, t[16];
+	g2_t p, q[16];
+	g2_key_t e, f[16];
+	bn_t d, k[16];
 
 	g1_null(s);
 	g2_null(p);
+	g2_key_null(e);
 	bn_null(d);
 
 	g1_new(s);
 	g2_new(p);
+	g2_key_new(e);
 	bn_new(d);
 
 	BENCH_RUN("cp_bls_gen") {
@@ -1098,9 +1103,75 @@ static void bls(void) {
 	}
 	BENCH_END;
 
+	BENCH_RUN("g2_key_set") {
+		BENCH_ADD(g2_key_set(e, p));
+	}
+	BENCH_END;
+
+	BENCH_RUN("cp_bls_ver_key") {
+		BENCH_ADD(cp_bls_ver_key(s, msg, 5, e));
+	}
+	BENCH_END;
+
+	for (int i = 0; i < 16; i++) {
+		g1_null(t[i]);
+		g2_null(q[i]);
+		g2_key_null(f[i]);
+		bn_null(k[i]);
+		g1_new(t[i]);
+		g2_new(q[i]);
+		g2_key_new(f[i]);
+		bn_new(k[i]);
+		cp_bls_gen(k[i], q[i]);
+		g2_key_set(f[i], q[i]);
+		rand_bytes(m[i], sizeof(m[i]));
+		ms[i] = m[i];
+		ls[i] = sizeof(m[i]);
+		cp_bls_sig(t[i], m[i], ls[i], k[i]);
+	}
+
+	BENCH_RUN("cp_bls_agg_sig (16)") {
+		BENCH_ADD(cp_bls_agg_sig(s, t, 16));
+	}
+	BENCH_END;
+
+	BENCH_RUN("cp_bls_ver (16 signatures)") {
+		BENCH_ADD(for (int i = 0; i < 16; i++) {
+			cp_bls_ver(t[i], m[i], ls[i], q[i]);
+		});
+	}
+	BENCH_END;
+
+	BENCH_RUN("cp_bls_bat_ver (16)") {
+		BENCH_ADD(cp_bls_bat_ver(t, ms, ls, q, 16));
+	}
+	BENCH_END;
+
+	BENCH_RUN("cp_bls_bat_ver_key (16)") {
+		BENCH_ADD(cp_bls_bat_ver_key(t, ms, ls, f, 16));
+	}
+	BENCH_END;
+
+	for (int i = 0; i < 16; i++) {
+		cp_bls_sig(t[i], msg, 5, k[i]);
+	}
+	cp_bls_agg_sig(s, t, 16);
+
+	BENCH_RUN("cp_bls_agg_ver (16)") {
+		BENCH_ADD(cp_bls_agg_ver(s, msg, 5, q, 16));
+	}
+	BENCH_END;
+
 	g1_free(s);
 	bn_free(d);
 	g2_free(p);
+	g2_key_free(e);
+	for (int i = 0; i < 16; i++) {
+		g1_free(t[i]);
+		g2_free(q[i]);
+		g2_key_free(f[i]);
+		bn_free(k[i]);
+	}
 }
 
 static void bbs(void) {
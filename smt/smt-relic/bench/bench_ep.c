@@ -30,6 +30,7 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
 
 #include "relic.h"
 #include "relic_bench.h"
@@ -401,6 +402,15 @@ static void arith(void) {
 	}
 	BENCH_END;
 
+	BENCH_RUN("ep_mul_sps") {
+		const int *b;
+		int l;
+		b = fp_prime_get_par_sps(&l);
+		fp_prime_get_par(k);
+		BENCH_ADD(ep_mul_sps(p, q, b, l, bn_sign(k)));
+	}
+	BENCH_END;
+
 	for (int i = 0; i < RLC_EP_TABLE; i++) {
 		ep_new(t[i]);
 	}
@@ -594,6 +604,54 @@ static void arith(void) {
 	bn_free(n);
 }
 
+/**
+ * Benchmarks the simultaneous multiplication of many points. The timings are
+ * amortized by the number of points, giving the cost per point of each method.
+ */
+static void many(void) {
+	const int max = 4096;
+	char label[64];
+	bn_t n, *k = (bn_t *)malloc(max * sizeof(bn_t));
+	ep_t r, *p = (ep_t *)malloc(max * sizeof(ep_t));
+
+	if (k == NULL || p == NULL) {
+		free(k);
+		free(p);
+		return;
+	}
+
+	bn_null(n);
+	ep_null(r);
+
+	bn_new(n);
+	ep_new(r);
+	ep_curve_get_ord(n);
+	for (int i = 0; i < max; i++) {
+		bn_null(k[i]);
+		ep_null(p[i]);
+		bn_new(k[i]);
+		ep_new(p[i]);
+		bn_rand_mod(k[i], n);
+		ep_rand(p[i]);
+	}
+
+	for (int m = 16; m <= max; m *= 4) {
+		snprintf(label, sizeof(label), "ep_mul_sim_lot (%d)", m);
+		BENCH_FEW(label, ep_mul_sim_lot(r, p, k, m), m);
+		snprintf(label, sizeof(label), "ep_mul_sim_bucket (%d)", m);
+		BENCH_FEW(label, ep_mul_sim_bucket(r, p, k, m), m);
+	}
+
+	for (int i = 0; i < max; i++) {
+		bn_free(k[i]);
+		ep_free(p[i]);
+	}
+	bn_free(n);
+	ep_free(r);
+	free(k);
+	free(p);
+}
+
 static void bench(void) {
 	ep_param_print();
 	util_banner("Utilities:", 1);
@@ -601,6 +659,7 @@ static void bench(void) {
 	util();
 	util_banner("Arithmetic:", 1);
 	arith();
+	many();
 }
 
 int main(void) {
@@ -30,6 +30,7 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
 
 #include "relic.h"
 #include "relic_bench.h"
@@ -369,6 +370,15 @@ static void arith2(void) {
 	}
 	BENCH_END;
 
+	BENCH_RUN("ep2_mul_sps") {
+		const int *b;
+		int l;
+		b = fp_prime_get_par_sps(&l);
+		fp_prime_get_par(k);
+		BENCH_ADD(ep2_mul_sps(p, q, b, l, bn_sign(k)));
+	}
+	BENCH_END;
+
 	for (int i = 0; i < RLC_EPX_TABLE_MAX; i++) {
 		ep2_new(t[i]);
 	}
@@ -569,6 +579,54 @@ static void arith2(void) {
 	fp2_free(s);
 }
 
+/**
+ * Benchmarks the simultaneous multiplication of many points. The timings are
+ * amortized by the number of points, giving the cost per point of each method.
+ */
+static void many2(void) {
+	const int max = 4096;
+	char label[64];
+	bn_t n, *k = (bn_t *)malloc(max * sizeof(bn_t));
+	ep2_t r, *p = (ep2_t *)malloc(max * sizeof(ep2_t));
+
+	if (k == NULL || p == NULL) {
+		free(k);
+		free(p);
+		return;
+	}
+
+	bn_null(n);
+	ep2_null(r);
+
+	bn_new(n);
+	ep2_new(r);
+	ep2_curve_get_ord(n);
+	for (int i = 0; i < max; i++) {
+		bn_null(k[i]);
+		ep2_null(p[i]);
+		bn_new(k[i]);
+		ep2_new(p[i]);
+		bn_rand_mod(k[i], n);
+		ep2_rand(p[i]);
+	}
+
+	for (int m = 16; m <= max; m *= 4) {
+		snprintf(label, sizeof(label), "ep2_mul_sim_lot (%d)", m);
+		BENCH_FEW(label, ep2_mul_sim_lot(r, p, k, m), m);
+		snprintf(label, sizeof(label), "ep2_mul_sim_bucket (%d)", m);
+		BENCH_FEW(label, ep2_mul_sim_bucket(r, p, k, m), m);
+	}
+
+	for (int i = 0; i < max; i++) {
+		bn_free(k[i]);
+		ep2_free(p[i]);
+	}
+	bn_free(n);
+	ep2_free(r);
+	free(k);
+	free(p);
+}
+
 static void memory4(void) {
 	ep4_t a[BENCH];
 
@@ -885,6 +943,15 @@ static void arith4(void) {
 	}
 	BENCH_END;
 
+	BENCH_RUN("ep4_mul_sps") {
+		const int *b;
+		int l;
+		b = fp_prime_get_par_sps(&l);
+		fp_prime_get_par(k);
+		BENCH_ADD(ep4_mul_sps(p, q, b, l, bn_sign(k)));
+	}
+	BENCH_END;
+
 	for (int i = 0; i < RLC_EPX_TABLE_MAX; i++) {
 		ep4_new(t[i]);
 	}
@@ -1058,6 +1125,183 @@ static void arith4(void) {
 	fp4_free(s);
 }
 
+static void arith13(void) {
+	ep13_t p, q, r, t[RLC_EP13_TABLE_MAX];
+	bn_t k, n;
+	uint8_t bin[26 * RLC_FP_BYTES + 1], msg[5];
+	uint8_t ub[26 * (RLC_FP_BYTES + 32)];
+	int l;
+
+	ep13_null(p);
+	ep13_null(q);
+	ep13_null(r);
+	bn_null(k);
+	bn_null(n);
+	for (int i = 0; i < RLC_EP13_TABLE_MAX; i++) {
+		ep13_null(t[i]);
+	}
+
+	ep13_new(p);
+	ep13_new(q);
+	ep13_new(r);
+	bn_new(k);
+	bn_new(n);
+
+	ep_curve_get_ord(n);
+
+	BENCH_RUN("ep13_add") {
+		ep13_rand(p);
+		ep13_rand(q);
+		BENCH_ADD(ep13_add(r, p, q));
+	}
+	BENCH_END;
+
+	BENCH_RUN("ep13_dbl") {
+		ep13_rand(p);
+		BENCH_ADD(ep13_dbl(r, p));
+	}
+	BENCH_END;
+
+	BENCH_RUN("ep13_mul_basic") {
+		bn_rand_mod(k, n);
+		ep13_rand(p);
+		BENCH_ADD(ep13_mul_basic(q, p, k));
+	} BENCH_END;
+
+#if EP_MUL == SLIDE || !defined(STRIP)
+	BENCH_RUN("ep13_mul_slide") {
+		bn_rand_mod(k, n);
+		ep13_rand(p);
+		BENCH_ADD(ep13_mul_slide(q, p, k));
+	} BENCH_END;
+#endif
+
+#if EP_MUL == LWNAF || !defined(STRIP)
+	BENCH_RUN("ep13_mul_lwnaf") {
+		bn_rand_mod(k, n);
+		ep13_rand(p);
+		BENCH_ADD(ep13_mul_lwnaf(q, p, k));
+	} BENCH_END;
+#endif
+
+	for (int i = 0; i < RLC_EP13_TABLE_MAX; i++) {
+		ep13_new(t[i]);
+	}
+
+	BENCH_RUN("ep13_mul_pre") {
+		ep13_rand(p);
+		BENCH_ADD(ep13_mul_pre(t, p));
+	} BENCH_END;
+
+	BENCH_RUN("ep13_mul_fix") {
+		bn_rand_mod(k, n);
+		ep13_rand(p);
+		ep13_mul_pre(t, p);
+		BENCH_ADD(ep13_mul_fix(q, t, k));
+	} BENCH_END;
+
+#if EP_FIX == COMBS || !defined(STRIP)
+	BENCH_RUN("ep13_mul_pre_combs") {
+		ep13_rand(p);
+		BENCH_ADD(ep13_mul_pre_combs(t, p));
+	} BENCH_END;
+
+	BENCH_RUN("ep13_mul_fix_combs") {
+		bn_rand_mod(k, n);
+		ep13_rand(p);
+		ep13_mul_pre_combs(t, p);
+		BENCH_ADD(ep13_mul_fix_combs(q, t, k));
+	} BENCH_END;
+#endif
+
+#if EP_FIX == LWNAF || !defined(STRIP)
+	BENCH_RUN("ep13_mul_pre_lwnaf") {
+		ep13_rand(p);
+		BENCH_ADD(ep13_mul_pre_lwnaf(t, p));
+	} BENCH_END;
+
+	BENCH_RUN("ep13_mul_fix_lwnaf") {
+		bn_rand_mod(k, n);
+		ep13_rand(p);
+		ep13_mul_pre_lwnaf(t, p);
+		BENCH_ADD(ep13_mul_fix_lwnaf(q, t, k));
+	} BENCH_END;
+#endif
+
+	for (int i = 0; i < RLC_EP13_TABLE_MAX; i++) {
+		ep13_free(t[i]);
+	}
+
+	BENCH_RUN("ep13_psi") {
+		ep13_rand(p);
+		BENCH_ADD(ep13_psi(q, p, 1));
+	} BENCH_END;
+
+	BENCH_RUN("ep13_write_bin (0)") {
+		ep13_rand(p);
+		l = ep13_size_bin(p, 0);
+		BENCH_ADD(ep13_write_bin(bin, l, p, 0));
+	} BENCH_END;
+
+	BENCH_RUN("ep13_write_bin (1)") {
+		ep13_rand(p);
+		l = ep13_size_bin(p, 1);
+		BENCH_ADD(ep13_write_bin(bin, l, p, 1));
+	} BENCH_END;
+
+	BENCH_RUN("ep13_read_bin (0)") {
+		ep13_rand(p);
+		l = ep13_size_bin(p, 0);
+		ep13_write_bin(bin, l, p, 0);
+		BENCH_ADD(ep13_read_bin(p, bin, l));
+	} BENCH_END;
+
+	BENCH_RUN("ep13_read_bin (1)") {
+		ep13_rand(p);
+		l = ep13_size_bin(p, 1);
+		ep13_write_bin(bin, l, p, 1);
+		BENCH_ADD(ep13_read_bin(p, bin, l));
+	} BENCH_END;
+
+	l = 26 * ((FP_PRIME + ep_param_level() + 7) / 8);
+
+	BENCH_RUN("md_xmd (ep13_map)") {
+		rand_bytes(msg, sizeof(msg));
+		BENCH_ADD(md_xmd(ub, l, msg, sizeof(msg), (const uint8_t *)"RELIC", 5));
+	} BENCH_END;
+
+	BENCH_RUN("ep13_map_from_field") {
+		rand_bytes(ub, l);
+		BENCH_ADD(ep13_map_from_field(p, ub, l));
+	} BENCH_END;
+
+	BENCH_RUN("ep13_rand_mul_u") {
+		ep13_rand(p);
+		BENCH_ADD(ep13_rand_mul_u(q, p));
+	} BENCH_END;
+
+	BENCH_RUN("ep13_cof") {
+		ep13_rand(p);
+		BENCH_ADD(ep13_cof(q, p));
+	} BENCH_END;
+
+	BENCH_RUN("ep13_cof_fuentes") {
+		ep13_rand(p);
+		BENCH_ADD(ep13_cof_fuentes(q, p));
+	} BENCH_END;
+
+	BENCH_RUN("ep13_map") {
+		rand_bytes(msg, sizeof(msg));
+		BENCH_ADD(ep13_map(p, msg, sizeof(msg)));
+	} BENCH_END;
+
+	ep13_free(p);
+	ep13_free(q);
+	ep13_free(r);
+	bn_free(k);
+	bn_free(n);
+}
+
 int main(void) {
 	int r0, r1;
 	if (core_init() != RLC_OK) {
@@ -1084,6 +1328,7 @@ int main(void) {
 
 		util_banner("Arithmetic:", 1);
 		arith2();
+		many2();
 	}
 
 	if ((r1 = ep4_curve_is_twist())) {
@@ -1097,7 +1342,12 @@ int main(void) {
 		arith4();
 	}
 
-	if (!r0 && !r1) {
+	if (ep_curve_is_pairf() == EP_BW13) {
+		ep_param_print();
+
+		util_banner("Arithmetic:", 1);
+		arith13();
+	} else if (!r0 && !r1) {
 		RLC_THROW(ERR_NO_CURVE);
 		core_clean();
 		return 0;
@@ -30,6 +30,7 @@
  */
 
 #include "relic.h"
+#include "relic_fpx_low.h"
 #include "relic_bench.h"
 
 static void memory2(void) {
@@ -2014,6 +2015,153 @@ static void arith12(void) {
 	bn_free(e);
 }
 
+static void arith13(void) {
+	fp13_t a, b, c;
+	dv13_t e;
+	uint8_t bin[13 * RLC_FP_BYTES];
+
+	fp13_null(a);
+	fp13_null(b);
+	fp13_null(c);
+	dv13_null(e);
+
+	fp13_new(a);
+	fp13_new(b);
+	fp13_new(c);
+	dv13_new(e);
+
+	BENCH_RUN("fp13_add") {
+		fp13_rand(a);
+		fp13_rand(b);
+		BENCH_ADD(fp13_add(c, a, b));
+	}
+	BENCH_END;
+
+	BENCH_RUN("fp13_sub") {
+		fp13_rand(a);
+		fp13_rand(b);
+		BENCH_ADD(fp13_sub(c, a, b));
+	}
+	BENCH_END;
+
+	BENCH_RUN("fp13_mul") {
+		fp13_rand(a);
+		fp13_rand(b);
+		BENCH_ADD(fp13_mul(c, a, b));
+	}
+	BENCH_END;
+
+	BENCH_RUN("fp13_muln_low") {
+		fp13_rand(a);
+		fp13_rand(b);
+		BENCH_ADD(fp13_muln_low(e, a, b));
+	}
+	BENCH_END;
+
+	BENCH_RUN("fp13_sqr") {
+		fp13_rand(a);
+		BENCH_ADD(fp13_sqr(c, a));
+	}
+	BENCH_END;
+
+	BENCH_RUN("fp13_sqrn_low") {
+		fp13_rand(a);
+		BENCH_ADD(fp13_sqrn_low(e, a));
+	}
+	BENCH_END;
+
+	BENCH_RUN("fp13_rdc") {
+		fp13_rand(a);
+		fp13_rand(b);
+		fp13_muln_low(e, a, b);
+		BENCH_ADD(fp13_rdc(c, e));
+	}
+	BENCH_END;
+
+	BENCH_RUN("fp13_norm") {
+		fp_t n;
+		fp_null(n);
+		fp_new(n);
+		fp13_rand(a);
+		BENCH_ADD(fp13_norm(n, a));
+		fp_free(n);
+	}
+	BENCH_END;
+
+	BENCH_RUN("fp13_is_square") {
+		fp13_rand(a);
+		BENCH_ADD(fp13_is_square(a));
+	}
+	BENCH_END;
+
+	BENCH_RUN("fp13_srt") {
+		fp13_rand(a);
+		fp13_sqr(a, a);
+		BENCH_ADD(fp13_srt(c, a));
+	}
+	BENCH_END;
+
+	BENCH_RUN("fp13_exp") {
+		bn_t d;
+		bn_null(d);
+		bn_new(d);
+		fp13_rand(a);
+		d->used = RLC_FP_DIGS;
+		dv_copy(d->dp, fp_prime_get(), RLC_FP_DIGS);
+		BENCH_ADD(fp13_exp(c, a, d));
+		bn_free(d);
+	}
+	BENCH_END;
+
+	BENCH_RUN("fp13_pck") {
+		fp13_rand(a);
+		fp13_upk(a, a);
+		BENCH_ADD(fp13_pck(c, a));
+	}
+	BENCH_END;
+
+	BENCH_RUN("fp13_upk") {
+		fp13_rand(a);
+		fp13_upk(a, a);
+		fp13_pck(a, a);
+		BENCH_ADD(fp13_upk(c, a));
+	}
+	BENCH_END;
+
+	BENCH_RUN("fp13_write_bin (0)") {
+		fp13_rand(a);
+		BENCH_ADD(fp13_write_bin(bin, sizeof(bin), a, 0));
+	}
+	BENCH_END;
+
+	BENCH_RUN("fp13_write_bin (1)") {
+		fp13_rand(a);
+		fp13_upk(a, a);
+		BENCH_ADD(fp13_write_bin(bin, 1 + 12 * RLC_FP_BYTES, a, 1));
+	}
+	BENCH_END;
+
+	BENCH_RUN("fp13_read_bin (0)") {
+		fp13_rand(a);
+		fp13_write_bin(bin, sizeof(bin), a, 0);
+		BENCH_ADD(fp13_read_bin(a, bin, sizeof(bin)));
+	}
+	BENCH_END;
+
+	BENCH_RUN("fp13_read_bin (1)") {
+		fp13_rand(a);
+		fp13_upk(a, a);
+		fp13_write_bin(bin, fp13_size_bin(a, 1), a, 1);
+		BENCH_ADD(fp13_read_bin(a, bin, 1 + 12 * RLC_FP_BYTES));
+	}
+	BENCH_END;
+
+	fp13_free(a);
+	fp13_free(b);
+	fp13_free(c);
+	dv13_free(e);
+}
+
 static void memory18(void) {
 	fp18_t a[BENCH];
 
@@ -3302,6 +3450,12 @@ int main(void) {
 		arith12();
 	}
 
+	if (ep_param_embed() == 13) {
+		util_banner("Extension of degree 13:", 0);
+		util_banner("Arithmetic:", 1);
+		arith13();
+	}
+
 	if (fp_prime_get_cnr() && (ep_param_embed() >= 18)) {
 		util_banner("Octdecic extension:", 0);
 		util_banner("Utilities:", 1);
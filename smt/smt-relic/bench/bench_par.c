@@ -0,0 +1,242 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (c) 2010 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Benchmarks for the thread-parallel multi-pairing and multiplication of many
+ * points.
+ *
+ * @ingroup bench
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "relic.h"
+#include "relic_bench.h"
+
+/**
+ * Number of pairs in each benchmarked product.
+ */
+#define PAIRS		64
+
+/**
+ * Number of points in each benchmarked simultaneous multiplication.
+ */
+#define POINTS		4096
+
+/**
+ * Prints the speedup of the last benchmark relative to a baseline.
+ *
+ * @param[in] base			- the timing of the baseline.
+ */
+static void speedup(ull_t base) {
+	ull_t t = bench_total();
+
+	if (t > 0) {
+		util_print("       speedup over 1 thread = %.2f\n", (double)base / t);
+	}
+}
+
+static void pairing(void) {
+	g1_t p[PAIRS];
+	g2_t q[PAIRS];
+	gt_t r;
+	ull_t base;
+	int i;
+
+	gt_null(r);
+	gt_new(r);
+	for (i = 0; i < PAIRS; i++) {
+		g1_null(p[i]);
+		g2_null(q[i]);
+		g1_new(p[i]);
+		g2_new(q[i]);
+		g1_rand(p[i]);
+		g2_rand(q[i]);
+	}
+
+	BENCH_FEW("pc_map_sim (64)", pc_map_sim(r, p, q, PAIRS), 1);
+	base = bench_total();
+
+	BENCH_FEW("pc_map_sim_par (64, 1 thread)",
+			pc_map_sim_par(r, p, q, PAIRS, 1), 1);
+	speedup(base);
+
+	BENCH_FEW("pc_map_sim_par (64, 2 threads)",
+			pc_map_sim_par(r, p, q, PAIRS, 2), 1);
+	speedup(base);
+
+	BENCH_FEW("pc_map_sim_par (64, 4 threads)",
+			pc_map_sim_par(r, p, q, PAIRS, 4), 1);
+	speedup(base);
+
+	BENCH_FEW("pc_map_sim_par (64, 8 threads)",
+			pc_map_sim_par(r, p, q, PAIRS, 8), 1);
+	speedup(base);
+
+	BENCH_FEW("pc_map_sim_par (64, 16 threads)",
+			pc_map_sim_par(r, p, q, PAIRS, 16), 1);
+	speedup(base);
+
+	gt_free(r);
+	for (i = 0; i < PAIRS; i++) {
+		g1_free(p[i]);
+		g2_free(q[i]);
+	}
+}
+
+/**
+ * Benchmarks the multiplication of many points, each taking long enough to be
+ * timed in a single execution.
+ */
+static void multiply1(void) {
+	bn_t n, *k = (bn_t *)malloc(POINTS * sizeof(bn_t));
+	g1_t r, *p = (g1_t *)malloc(POINTS * sizeof(g1_t));
+	char label[64];
+	ull_t base;
+	int i, t;
+
+	if (k == NULL || p == NULL) {
+		free(k);
+		free(p);
+		return;
+	}
+
+	bn_null(n);
+	g1_null(r);
+
+	bn_new(n);
+	g1_new(r);
+	pc_get_ord(n);
+	for (i = 0; i < POINTS; i++) {
+		bn_null(k[i]);
+		g1_null(p[i]);
+		bn_new(k[i]);
+		g1_new(p[i]);
+		bn_rand_mod(k[i], n);
+		g1_rand(p[i]);
+	}
+
+	BENCH_ONE("g1_mul_sim_lot (4096)", g1_mul_sim_lot(r, p, k, POINTS), 1);
+	base = bench_total();
+
+	for (t = 1; t <= 16; t *= 2) {
+		snprintf(label, sizeof(label), "g1_mul_sim_par (4096, %d thread%s)", t,
+				(t == 1 ? "" : "s"));
+		BENCH_ONE(label, g1_mul_sim_par(r, p, k, POINTS, t), 1);
+		speedup(base);
+	}
+
+	bn_free(n);
+	g1_free(r);
+	for (i = 0; i < POINTS; i++) {
+		bn_free(k[i]);
+		g1_free(p[i]);
+	}
+	free(k);
+	free(p);
+}
+
+static void multiply2(void) {
+	bn_t n, *k = (bn_t *)malloc(POINTS * sizeof(bn_t));
+	g2_t r, *p = (g2_t *)malloc(POINTS * sizeof(g2_t));
+	char label[64];
+	ull_t base;
+	int i, t;
+
+	if (k == NULL || p == NULL) {
+		free(k);
+		free(p);
+		return;
+	}
+
+	bn_null(n);
+	g2_null(r);
+
+	bn_new(n);
+	g2_new(r);
+	pc_get_ord(n);
+	for (i = 0; i < POINTS; i++) {
+		bn_null(k[i]);
+		g2_null(p[i]);
+		bn_new(k[i]);
+		g2_new(p[i]);
+		bn_rand_mod(k[i], n);
+		g2_rand(p[i]);
+	}
+
+	BENCH_ONE("g2_mul_sim_lot (4096)", g2_mul_sim_lot(r, p, k, POINTS), 1);
+	base = bench_total();
+
+	for (t = 1; t <= 16; t *= 2) {
+		snprintf(label, sizeof(label), "g2_mul_sim_par (4096, %d thread%s)", t,
+				(t == 1 ? "" : "s"));
+		BENCH_ONE(label, g2_mul_sim_par(r, p, k, POINTS, t), 1);
+		speedup(base);
+	}
+
+	bn_free(n);
+	g2_free(r);
+	for (i = 0; i < POINTS; i++) {
+		bn_free(k[i]);
+		g2_free(p[i]);
+	}
+	free(k);
+	free(p);
+}
+
+int main(void) {
+	if (core_init() != RLC_OK) {
+		core_clean();
+		return 1;
+	}
+
+	conf_print();
+	util_banner("Benchmarks for the parallel operations:", 0);
+
+#if !defined(MULTI)
+	util_print("Built without MULTI, slices are computed in sequence.\n");
+#endif
+#if TIMER == HPROC || TIMER == ANSI
+	util_print("The timer measures process time, so use TIMER=HREAL or "
+			"TIMER=CYCLE to observe scaling.\n");
+#endif
+
+	if (pc_param_set_any() != RLC_OK) {
+		RLC_THROW(ERR_NO_CURVE);
+		core_clean();
+		return 0;
+	}
+
+	pc_param_print();
+
+	util_banner("Arithmetic:", 1);
+	pairing();
+	multiply1();
+	multiply2();
+
+	core_clean();
+	return 0;
+}
@@ -30,6 +30,7 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
 
 #include "relic.h"
 #include "relic_bench.h"
@@ -302,15 +303,19 @@ static void memory2(void) {
 }
 
 static void util2(void) {
-	g2_t p, q;
+	g2_t p, q, t[16];
 	uint8_t bin[8 * RLC_PC_BYTES + 1];
-	int l;
+	int l, r[16];
 
 	g2_null(p);
 	g2_null(q);
 
 	g2_new(p);
 	g2_new(q);
+	for (int j = 0; j < 16; j++) {
+		g2_null(t[j]);
+		g2_new(t[j]);
+	}
 
 	BENCH_RUN("g2_is_infty") {
 		g2_rand(p);
@@ -367,6 +372,14 @@ static void util2(void) {
 	}
 	BENCH_END;
 
+	BENCH_RUN("g2_is_valid_bn_batch (16)") {
+		for (int j = 0; j < 16; j++) {
+			g2_rand(t[j]);
+		}
+		BENCH_ADD(g2_is_valid_bn_batch(r, t, 16));
+	}
+	BENCH_DIV(16);
+
 	BENCH_RUN("g2_size_bin (0)") {
 		g2_rand(p);
 		BENCH_ADD(g2_size_bin(p, 0));
@@ -405,6 +418,9 @@ static void util2(void) {
 
 	g2_free(p)
 	g2_free(q);
+	for (int j = 0; j < 16; j++) {
+		g2_free(t[j]);
+	}
 }
 
 static void arith2(void) {
@@ -661,11 +677,15 @@ static void util(void) {
 
 static void arith(void) {
 	gt_t a, b, c;
+	gt_pre_t t;
 	bn_t d, e, f;
 
+	gt_pre_null(t);
+
 	gt_new(a);
 	gt_new(b);
 	gt_new(c);
+	gt_pre_new(t);
 	bn_new(d);
 	bn_new(e);
 	bn_new(f);
@@ -705,6 +725,21 @@ static void arith(void) {
 	}
 	BENCH_END;
 
+	BENCH_RUN("gt_exp_pre") {
+		gt_rand(a);
+		BENCH_ADD(gt_exp_pre(t, a));
+	}
+	BENCH_END;
+
+	BENCH_RUN("gt_exp_fix") {
+		gt_rand(a);
+		gt_exp_pre(t, a);
+		pc_get_ord(d);
+		bn_rand_mod(e, d);
+		BENCH_ADD(gt_exp_fix(c, t, e));
+	}
+	BENCH_END;
+
 	BENCH_RUN("gt_exp_sim") {
 		gt_rand(a);
 		gt_rand(b);
@@ -726,20 +761,70 @@ static void arith(void) {
 	gt_free(a);
 	gt_free(b);
 	gt_free(c);
+	gt_pre_free(t);
 	bn_free(d);
 	bn_free(e);
 	bn_free(f);
 }
 
+/**
+ * Benchmarks the simultaneous exponentiation of many elements. The timings are
+ * amortized by the number of elements, giving the cost per element.
+ */
+static void many(void) {
+	const int max = 256;
+	char label[64];
+	bn_t n, *k = (bn_t *)malloc(max * sizeof(bn_t));
+	gt_t c, *a = (gt_t *)malloc(max * sizeof(gt_t));
+
+	if (k == NULL || a == NULL) {
+		free(k);
+		free(a);
+		return;
+	}
+
+	bn_null(n);
+	gt_null(c);
+
+	bn_new(n);
+	gt_new(c);
+	pc_get_ord(n);
+	for (int i = 0; i < max; i++) {
+		bn_null(k[i]);
+		gt_null(a[i]);
+		bn_new(k[i]);
+		gt_new(a[i]);
+		bn_rand_mod(k[i], n);
+		gt_rand(a[i]);
+	}
+
+	for (int m = 4; m <= max; m *= 4) {
+		snprintf(label, sizeof(label), "gt_exp_sim_lot (%d)", m);
+		BENCH_FEW(label, gt_exp_sim_lot(c, a, k, m), m);
+	}
+
+	for (int i = 0; i < max; i++) {
+		bn_free(k[i]);
+		gt_free(a[i]);
+	}
+	bn_free(n);
+	gt_free(c);
+	free(k);
+	free(a);
+}
+
 static void pairing(void) {
 	g1_t p[2];
 	g2_t q[2];
+	g2_key_t k[2];
 	gt_t r;
 
 	g1_new(p[0]);
 	g2_new(q[0]);
 	g1_new(p[1]);
 	g2_new(q[1]);
+	g2_key_new(k[0]);
+	g2_key_new(k[1]);
 	gt_new(r);
 
 	BENCH_RUN("pc_map") {
@@ -762,10 +847,50 @@ static void pairing(void) {
 	}
 	BENCH_END;
 
+	BENCH_RUN("g2_key_set") {
+		g2_rand(q[0]);
+		BENCH_ADD(g2_key_set(k[0], q[0]));
+	}
+	BENCH_END;
+
+	BENCH_RUN("pc_map_key") {
+		g1_rand(p[0]);
+		BENCH_ADD(pc_map_key(r, p[0], k[0]));
+	}
+	BENCH_END;
+
+	BENCH_RUN("pc_map_sim_key (2)") {
+		g1_rand(p[1]);
+		g2_key_set(k[1], q[1]);
+		BENCH_ADD(pc_map_sim_key(r, p, k, 2));
+	}
+	BENCH_END;
+
+	if (ep_curve_is_pairf() == EP_BN) {
+		BENCH_RUN("g1_is_valid + g2_is_valid_bn + gt_is_valid_bn") {
+			g1_rand(p[0]);
+			g2_rand(q[0]);
+			pc_map(r, p[0], q[0]);
+			BENCH_ADD(g1_is_valid(p[0]); g2_is_valid_bn(q[0]);
+					gt_is_valid_bn(r));
+		}
+		BENCH_END;
+
+		BENCH_RUN("pc_validate_bn") {
+			g1_rand(p[0]);
+			g2_rand(q[0]);
+			pc_map(r, p[0], q[0]);
+			BENCH_ADD(pc_validate_bn(p[0], q[0], r));
+		}
+		BENCH_END;
+	}
+
 	g1_free(p[0]);
 	g2_free(q[0]);
 	g1_free(p[1]);
 	g2_free(q[1]);
+	g2_key_free(k[0]);
+	g2_key_free(k[1]);
 	gt_free(r);
 }
 
@@ -809,6 +934,7 @@ int main(void) {
 
 	util_banner("Arithmetic:", 1);
 	arith();
+	many();
 
 	util_banner("Pairing:", 0);
 	util_banner("Arithmetic:", 1);
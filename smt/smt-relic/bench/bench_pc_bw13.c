@@ -63,10 +63,15 @@ static void G2(void) {
 
 static void Gt(void) {
 	fp13_t h0, h1;
+	bn_t x;
+	const int *b;
+	int l;
 	fp13_null(h0);
 	fp13_null(h1);
+	bn_null(x);
 	fp13_new(h0);
 	fp13_new(h1);
+	bn_new(x);
 	fp13_rand(h0);
 	fp13_rand(h1);
 	pp_exp_bwk13(h0, h0, h1); 
@@ -74,6 +79,35 @@ static void Gt(void) {
 		BENCH_ADD(gt_is_valid_bw13(h0));
 	} BENCH_END;
 
+	fp_prime_get_par(x);
+	bn_abs(x, x);
+	b = fp_prime_get_par_sps(&l);
+
+	BENCH_RUN("fp13_sqr_cyc") {
+		BENCH_ADD(fp13_sqr_cyc(h1, h0));
+	} BENCH_END;
+
+	BENCH_RUN("fp13_exp (x)") {
+		BENCH_ADD(fp13_exp(h1, h0, x));
+	} BENCH_END;
+
+	BENCH_RUN("fp13_exp_cyc (x)") {
+		BENCH_ADD(fp13_exp_cyc(h1, h0, x));
+	} BENCH_END;
+
+	BENCH_RUN("fp13_exp_cyc_sps (x)") {
+		BENCH_ADD(fp13_exp_cyc_sps(h1, h0, b, l, RLC_POS));
+	} BENCH_END;
+
+	BENCH_RUN("pp_exp_bwk13") {
+		fp13_rand(h0);
+		fp13_rand(h1);
+		BENCH_ADD(pp_exp_bwk13(h1, h0, h1));
+	} BENCH_END;
+
+	fp13_free(h0);
+	fp13_free(h1);
+	bn_free(x);
 }
 
 int main(void) {
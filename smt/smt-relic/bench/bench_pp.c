@@ -338,6 +338,8 @@ static void pairing12(void) {
 	ep2_t p[2], r;
 	ep_t q[2];
 	fp12_t e;
+	fp2_t _t[2][RLC_PP_TABLE_K12], *t[2] = { _t[0], _t[1] };
+	uint8_t bin[2 * RLC_PP_TABLE_K12 * RLC_FP_BYTES];
 	int j;
 
 	bn_null(k);
@@ -358,6 +360,12 @@ static void pairing12(void) {
 		ep2_new(p[j]);
 		ep_new(q[j]);
 	}
+	for (j = 0; j < RLC_PP_TABLE_K12; j++) {
+		fp2_null(_t[0][j]);
+		fp2_null(_t[1][j]);
+		fp2_new(_t[0][j]);
+		fp2_new(_t[1][j]);
+	}
 
 	ep2_curve_get_ord(n);
 
@@ -537,6 +545,67 @@ static void pairing12(void) {
 		BENCH_ADD(pp_map_sim_oatep_k12(e, q, p, 2));
 	}
 	BENCH_END;
+
+	BENCH_RUN("pp_pre_k12") {
+		ep2_rand(p[0]);
+		BENCH_ADD(pp_pre_k12(t[0], p[0]));
+	}
+	BENCH_END;
+
+	BENCH_RUN("pp_map_pre_k12") {
+		ep2_rand(p[0]);
+		ep_rand(q[0]);
+		pp_pre_k12(t[0], p[0]);
+		BENCH_ADD(pp_map_pre_k12(e, q[0], t[0]));
+	}
+	BENCH_END;
+
+	BENCH_RUN("pp_map_sim_pre_k12 (2)") {
+		ep2_rand(p[0]);
+		ep_rand(q[0]);
+		ep2_rand(p[1]);
+		ep_rand(q[1]);
+		pp_pre_k12(t[0], p[0]);
+		pp_pre_k12(t[1], p[1]);
+		BENCH_ADD(pp_map_sim_pre_k12(e, q, t, 2));
+	}
+	BENCH_END;
+
+	BENCH_RUN("pp_map_sim_mix_k12 (1 + 1)") {
+		ep2_rand(p[0]);
+		ep_rand(q[0]);
+		ep2_rand(p[1]);
+		ep_rand(q[1]);
+		pp_pre_k12(t[1], p[1]);
+		BENCH_ADD(pp_map_sim_mix_k12(e, q, p, 1, q + 1, t + 1, 1));
+	}
+	BENCH_END;
+
+	BENCH_RUN("pp_map_sim_mix_k12 (2 + 0)") {
+		ep2_rand(p[0]);
+		ep_rand(q[0]);
+		ep2_rand(p[1]);
+		ep_rand(q[1]);
+		BENCH_ADD(pp_map_sim_mix_k12(e, q, p, 2, NULL, NULL, 0));
+	}
+	BENCH_END;
+
+	BENCH_RUN("pp_write_pre_k12") {
+		ep2_rand(p[0]);
+		pp_pre_k12(t[0], p[0]);
+		j = pp_size_pre_k12(t[0]);
+		BENCH_ADD(pp_write_pre_k12(bin, j, t[0]));
+	}
+	BENCH_END;
+
+	BENCH_RUN("pp_read_pre_k12") {
+		ep2_rand(p[0]);
+		pp_pre_k12(t[0], p[0]);
+		j = pp_size_pre_k12(t[0]);
+		pp_write_pre_k12(bin, j, t[0]);
+		BENCH_ADD(pp_read_pre_k12(t[1], bin, j));
+	}
+	BENCH_END;
 #endif
 
 	bn_free(k);
@@ -548,6 +617,79 @@ static void pairing12(void) {
 		ep2_free(p[j]);
 		ep_free(q[j]);
 	}
+	for (j = 0; j < RLC_PP_TABLE_K12; j++) {
+		fp2_free(_t[0][j]);
+		fp2_free(_t[1][j]);
+	}
+}
+
+static void pairing13(void) {
+	ep13_t q[2];
+	ep_t p[2];
+	fp13_t e, f, t[RLC_PP_TABLE_K13];
+	int j;
+
+	fp13_null(e);
+	fp13_null(f);
+
+	fp13_new(e);
+	fp13_new(f);
+	for (j = 0; j < RLC_PP_TABLE_K13; j++) {
+		fp13_null(t[j]);
+		fp13_new(t[j]);
+	}
+
+	for (j = 0; j < 2; j++) {
+		ep13_null(q[j]);
+		ep_null(p[j]);
+		ep13_new(q[j]);
+		ep_new(p[j]);
+	}
+
+	BENCH_RUN("pp_exp_bwk13") {
+		fp13_rand(e);
+		fp13_rand(f);
+		BENCH_ADD(pp_exp_bwk13(e, e, f));
+	}
+	BENCH_END;
+
+	BENCH_RUN("pp_map_sup_oatep_k13") {
+		ep13_rand(q[0]);
+		ep_rand(p[0]);
+		BENCH_ADD(pp_map_sup_oatep_k13(e, p[0], q[0]));
+	}
+	BENCH_END;
+
+	BENCH_RUN("pp_map_sim_k13 (2)") {
+		ep13_rand(q[0]);
+		ep_rand(p[0]);
+		ep13_rand(q[1]);
+		ep_rand(p[1]);
+		BENCH_ADD(pp_map_sim_k13(e, p, q, 2));
+	}
+	BENCH_END;
+
+	BENCH_RUN("pp_pre_k13") {
+		ep13_rand(q[0]);
+		BENCH_ADD(pp_pre_k13(t, q[0]));
+	}
+	BENCH_END;
+
+	BENCH_RUN("pp_map_pre_k13") {
+		ep_rand(p[0]);
+		BENCH_ADD(pp_map_pre_k13(e, p[0], t));
+	}
+	BENCH_END;
+
+	fp13_free(e);
+	fp13_free(f);
+	for (j = 0; j < RLC_PP_TABLE_K13; j++) {
+		fp13_free(t[j]);
+	}
+	for (j = 0; j < 2; j++) {
+		ep13_free(q[j]);
+		ep_free(p[j]);
+	}
 }
 
 static void pairing48(void) {
@@ -781,6 +923,10 @@ int main(void) {
 		pairing12();
 	}
 
+	if (ep_param_embed() == 13) {
+		pairing13();
+	}
+
 	if (ep_param_embed() == 48) {
 		pairing48();
 	}
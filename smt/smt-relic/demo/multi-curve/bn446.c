@@ -0,0 +1,40 @@
+#include <relic.h>
+
+/* Compiled against the BN-P446 build, so every symbol carries its label. */
+int verify_bn446(void) {
+	g1_t p;
+	g2_t q;
+	gt_t e;
+	int result = RLC_ERR;
+
+	g1_null(p);
+	g2_null(q);
+	gt_null(e);
+
+	if (core_init() != RLC_OK || pc_param_set_any() != RLC_OK) {
+		core_clean();
+		return RLC_ERR;
+	}
+
+	RLC_TRY {
+		g1_new(p);
+		g2_new(q);
+		gt_new(e);
+
+		pc_param_print();
+		g1_rand(p);
+		g2_rand(q);
+		pc_map(e, p, q);
+		if (pc_validate_bn(p, q, e)) {
+			result = RLC_OK;
+		}
+	} RLC_CATCH_ANY {
+		result = RLC_ERR;
+	} RLC_FINALLY {
+		g1_free(p);
+		g2_free(q);
+		gt_free(e);
+	}
+	core_clean();
+	return result;
+}
@@ -0,0 +1,41 @@
+#include <relic.h>
+
+/* Compiled against the BW13-P310 build, so every symbol carries its label. */
+int verify_bw13(void) {
+	ep_t p;
+	ep13_t q;
+	fp13_t e;
+	int result = RLC_ERR;
+
+	ep_null(p);
+	ep13_null(q);
+	fp13_null(e);
+
+	if (core_init() != RLC_OK || ep_param_set_any_pairf() != RLC_OK) {
+		core_clean();
+		return RLC_ERR;
+	}
+
+	RLC_TRY {
+		ep_new(p);
+		ep13_new(q);
+		fp13_new(e);
+
+		ep_param_print();
+		ep_rand(p);
+		ep13_rand(q);
+		pp_map_sup_oatep_k13(e, p, q);
+		if (g1_is_valid_bw13(p) && g2_is_valid_bw13(q) &&
+				gt_is_valid_bw13(e) && fp13_cmp_dig(e, 1) != RLC_EQ) {
+			result = RLC_OK;
+		}
+	} RLC_CATCH_ANY {
+		result = RLC_ERR;
+	} RLC_FINALLY {
+		ep_free(p);
+		ep13_free(q);
+		fp13_free(e);
+	}
+	core_clean();
+	return result;
+}
@@ -0,0 +1,23 @@
+/*
+ * Verifies a BN-P446 and a BW13-P310 pairing in the same process. Build with:
+ *
+ *   tools/relic_build_multi.sh build-multi bn446:preset/x64-pbc-bn446.sh \
+ *       bw13:preset/x64-ecc-bw310.sh
+ *   cc -c bn446.c -Ibuild-multi/bn446/include -Iinclude
+ *   cc -c bw13.c -Ibuild-multi/bw13/include -Iinclude
+ *   cc main.c bn446.o bw13.o build-multi/librelic_s_multi.a -lgmp
+ */
+
+#include <stdio.h>
+
+int verify_bn446(void);
+int verify_bw13(void);
+
+int main(void) {
+	int r0 = verify_bn446();
+	int r1 = verify_bw13();
+
+	printf("BN-P446: %s\n", r0 == 0 ? "ok" : "FAIL");
+	printf("BW13-P310: %s\n", r1 == 0 ? "ok" : "FAIL");
+	return (r0 == 0 && r1 == 0) ? 0 : 1;
+}
@@ -376,4 +376,95 @@ void fp3_sqrm_low(fp3_t c, const fp3_t a);
  */
 void fp3_rdcn_low(fp3_t c, dv3_t a);
 
+/**
+ * Adds two 13-th extension field elements of size RLC_FP_DIGS + 1 without
+ * reducing the result modulo p. Computes c = a + b.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the first field element to add.
+ * @param[in] b				- the second field element to add.
+ */
+void fp13_addn_low(fp13_t c, fp13_t a, fp13_t b);
+
+/**
+ * Subtracts two 13-th extension field elements without reducing the result
+ * modulo p. Computes c = a - b.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the first field element.
+ * @param[in] b				- the field element to subtract.
+ */
+void fp13_subn_low(fp13_t c, fp13_t a, fp13_t b);
+
+/**
+ * Adds two double-precision 13-th extension field elements of the same size.
+ * Computes c = a + b.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the first field element to add.
+ * @param[in] b				- the second field element to add.
+ */
+void fp13_addd_low(dv13_t c, dv13_t a, dv13_t b);
+
+/**
+ * Adds two double-precision 13-th extension field elements of the same size
+ * and corrects the result by conditionally adding 2^(RLC_FP_DIGS * WSIZE) * p.
+ * Computes c = a + b.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the first field element to add.
+ * @param[in] b				- the second field element to add.
+ */
+void fp13_addc_low(dv13_t c, dv13_t a, dv13_t b);
+
+/**
+ * Subtracts two double-precision 13-th extension field elements of the same
+ * size. Computes c = a - b.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the first field element.
+ * @param[in] b				- the field element to subtract.
+ */
+void fp13_subd_low(dv13_t c, dv13_t a, dv13_t b);
+
+/**
+ * Subtracts two double-precision 13-th extension field elements of the same
+ * size and corrects the result by conditionally adding
+ * 2^(RLC_FP_DIGS * WSIZE) * p. Computes c = a - b.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the first field element.
+ * @param[in] b				- the field element to subtract.
+ */
+void fp13_subc_low(dv13_t c, dv13_t a, dv13_t b);
+
+/**
+ * Multiplies two 13-th extension field elements without reducing the result
+ * modulo p. Computes c = a * b.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the first field element to multiply.
+ * @param[in] b				- the second field element to multiply.
+ */
+void fp13_muln_low(dv13_t c, fp13_t a, fp13_t b);
+
+/**
+ * Squares a 13-th extension field element without reducing the result modulo
+ * p. Computes c = a * a.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the field element to square.
+ */
+void fp13_sqrn_low(dv13_t c, fp13_t a);
+
+/**
+ * Reduces a double-precision 13-th extension field element, as produced by
+ * fp13_muln_low() or fp13_sqrn_low(), modulo the configured prime p.
+ * Computes c = a mod p.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the double-precision element to reduce.
+ */
+void fp13_rdcn_low(fp13_t c, dv13_t a);
+
 #endif /* !RLC_FPX_LOW_H */
@@ -48,10 +48,75 @@
 #include <linux/perf_event.h>
 #endif
 
+/*============================================================================*/
+/* Constant definitions                                                       */
+/*============================================================================*/
+
+/**
+ * List of operations counted when the library is built with OPCNT. Each entry
+ * counts calls to the functions implementing the operation in its API.
+ */
+enum operations {
+	/** Prime field multiplication. */
+	OP_FP_MUL,
+	/** Prime field squaring. */
+	OP_FP_SQR,
+	/** Prime field inversion. */
+	OP_FP_INV,
+	/** Quadratic extension field multiplication. */
+	OP_FP2_MUL,
+	/** Quadratic extension field squaring. */
+	OP_FP2_SQR,
+	/** Quadratic extension field inversion. */
+	OP_FP2_INV,
+	/** Dodecic extension field multiplication. */
+	OP_FP12_MUL,
+	/** Dodecic extension field squaring. */
+	OP_FP12_SQR,
+	/** Dodecic extension field cyclotomic squaring. */
+	OP_FP12_CYC,
+	/** Extension field multiplication of degree 13. */
+	OP_FP13_MUL,
+	/** Extension field squaring of degree 13. */
+	OP_FP13_SQR,
+	/** Extension field inversion of degree 13. */
+	OP_FP13_INV,
+	/** Point addition in G_1. */
+	OP_EP_ADD,
+	/** Point doubling in G_1. */
+	OP_EP_DBL,
+	/** Point addition over the quadratic extension. */
+	OP_EP2_ADD,
+	/** Point doubling over the quadratic extension. */
+	OP_EP2_DBL,
+	/** Point addition over the extension of degree 13. */
+	OP_EP13_ADD,
+	/** Point doubling over the extension of degree 13. */
+	OP_EP13_DBL,
+	/** Constant to indicate the number of counted operations. */
+	OP_MAX
+};
+
 /*============================================================================*/
 /* Macro definitions                                                          */
 /*============================================================================*/
 
+/**
+ * Counts one execution of an operation in the current thread. A counter only
+ * records calls to the functions of the corresponding API, so an operation
+ * built on top of others increments their counters only when it calls them
+ * through that API. In particular, the prime field counters miss the products
+ * and reductions that lazy-reduction code in the extension fields performs
+ * directly with the low-level functions.
+ *
+ * @param[in] OP			- the operation executed.
+ */
+#ifdef OPCNT
+#define RLC_OPCNT(OP)		core_get()->opcnt[OP]++
+#else
+#define RLC_OPCNT(OP)		/* empty */
+#endif
+
 /**
  * Runs a new benchmark once.
  *
@@ -61,7 +126,7 @@
  */
 #define BENCH_ONE(LABEL, FUNCTION, N)										\
 	bench_reset();															\
-	util_print("BENCH: " LABEL "%*c = ", (int)(32 - strlen(LABEL)), ' ');	\
+	bench_label(LABEL);														\
 	bench_before();															\
 	FUNCTION;																\
 	bench_after();															\
@@ -78,7 +143,7 @@
  */
 #define BENCH_FEW(LABEL, FUNCTION, N)										\
 	bench_reset();															\
-	util_print("BENCH: " LABEL "%*c = ", (int)(32 - strlen(LABEL)), ' ');	\
+	bench_label(LABEL);														\
 	bench_before();															\
 	for (int i = 0; i < BENCH; i++)	{										\
 		FUNCTION;															\
@@ -94,7 +159,7 @@
  */
 #define BENCH_RUN(LABEL)													\
 	bench_reset();															\
-	util_print("BENCH: " LABEL "%*c = ", (int)(32 - strlen(LABEL)), ' ');	\
+	bench_label(LABEL);														\
 	for (int _b = 0; _b < BENCH; _b++)	{									\
 
 /**
@@ -187,6 +252,15 @@ void bench_overhead(void);
  */
 void bench_reset(void);
 
+/**
+ * Sets the label of the current benchmark. With plain output, the label is
+ * printed immediately, while with CSV or JSON output it is printed as part of
+ * the benchmark record.
+ *
+ * @param[in] label			- the benchmark label, kept until it is printed.
+ */
+void bench_label(const char *label);
+
 /**
  * Measures the time before a benchmark is executed.
  */
@@ -205,7 +279,11 @@ void bench_after(void);
 void bench_compute(int benches);
 
 /**
- * Prints the last benchmark.
+ * Prints the last benchmark. With CSV output, the record has the fields
+ * "bench", label, unit, executions, samples, mean, min, p10, median, p90 and
+ * max, followed by name=count for each nonzero operation counter. With JSON
+ * output, the record is an object with the same fields on a single line. The
+ * statistics are computed over per-execution timings of up to BENCH samples.
  */
 void bench_print(void);
 
@@ -216,4 +294,26 @@ void bench_print(void);
  */
 ull_t bench_total(void);
 
+/**
+ * Resets the operation counters of the current thread.
+ */
+void bench_count_reset(void);
+
+/**
+ * Copies the operation counters of the current thread into a vector of
+ * OP_MAX entries, indexed by the constants in the operations list. The vector
+ * is zeroed if the library was built without OPCNT.
+ *
+ * @param[out] cnt			- the operation counts.
+ */
+void bench_count_get(ull_t *cnt);
+
+/**
+ * Returns the printable name of a counted operation.
+ *
+ * @param[in] op			- the operation.
+ * @return the name of the operation.
+ */
+const char *bench_count_name(int op);
+
 #endif /* !RLC_BENCH_H */
@@ -448,6 +448,14 @@ typedef struct _ctx_t {
 
 #if defined(WITH_PC)
 	gt_t gt_g;
+	/** SHA-256 digests of G_2 elements that passed the membership test. */
+	uint8_t g2_val[RLC_G2_CACHE][32];
+	/** Number of G_2 elements inserted in the cache so far. */
+	int g2_val_num;
+	/** The generator of G_2 prepared for repeated pairings. */
+	g2_key_t g2_g;
+	/** The generator of G_T prepared for exponentiations, or NULL if unused. */
+	gt_pre_t gt_p;
 #endif
 
 #if BENCH > 0
@@ -457,12 +465,29 @@ typedef struct _ctx_t {
 	ben_t after;
 	/** Stores the sum of timings for the current benchmark. */
 	ull_t total;
+	/** The label of the current benchmark. */
+	const char *label;
+	/** Stores the first timings of the current benchmark. */
+	ull_t sample[BENCH];
+	/** Number of timings measured for the current benchmark. */
+	int samples;
+	/** Number of executions covered by the current benchmark. */
+	int benches;
 #ifdef OVERH
 	/** Benchmarking overhead to be measured and subtracted from benchmarks. */
 	ull_t over;
 #endif
 #endif
 
+#ifdef OPCNT
+	/** Number of times each counted operation was executed by this thread. */
+	ull_t opcnt[OP_MAX];
+	/** Operation counts taken before the execution of the benchmark. */
+	ull_t opcnt_before[OP_MAX];
+	/** Stores the sum of operation counts for the current benchmark. */
+	ull_t opcnt_total[OP_MAX];
+#endif
+
 #if RAND != CALL
 	/** Internal state of the PRNG. */
 	uint8_t rand[RLC_RAND_SIZE];
@@ -522,6 +547,20 @@ ctx_t *core_get(void);
  */
 void core_set(ctx_t *ctx);
 
+/**
+ * Runs independent jobs, in parallel threads if multithreading is enabled.
+ * Jobs running outside the calling thread use a private copy of its library
+ * context, so that the error state is not shared, and the threads get their
+ * own context back afterwards.
+ *
+ * @param[in] f					- the function computing a job.
+ * @param[in,out] arg			- the array of job arguments.
+ * @param[in] size				- the size in bytes of a job argument.
+ * @param[in] n					- the number of jobs.
+ * @return RLC_OK if all jobs succeeded, RLC_ERR otherwise.
+ */
+int core_run_par(void (*f)(void *), void *arg, size_t size, int n);
+
 #if defined(MULTI)
 
 #include "relic_multi.h"
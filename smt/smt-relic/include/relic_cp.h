@@ -1553,6 +1553,74 @@ int cp_bls_sig(g1_t s, const uint8_t *msg, int len, const bn_t d);
  */
 int cp_bls_ver(const g1_t s, const uint8_t *msg, size_t len, const g2_t q);
 
+/**
+ * Aggregates BLS signatures into a single signature.
+ *
+ * @param[out] s			- the aggregate signature.
+ * @param[in] sig			- the signatures to aggregate.
+ * @param[in] n				- the number of signatures.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_bls_agg_sig(g1_t s, const g1_t *sig, int n);
+
+/**
+ * Verifies an aggregate BLS signature on a single message signed by several
+ * keys. The keys must come with a proof of possession of the private key to
+ * rule out rogue-key attacks.
+ *
+ * @param[in] s				- the aggregate signature.
+ * @param[in] msg			- the signed message.
+ * @param[in] len			- the message length in bytes.
+ * @param[in] q				- the public keys of the signers.
+ * @param[in] n				- the number of public keys.
+ * @return a boolean value indicating if the signature is valid.
+ */
+int cp_bls_agg_ver(const g1_t s, const uint8_t *msg, size_t len,
+		const g2_t *q, int n);
+
+/**
+ * Verifies a batch of independent BLS signatures with a single product of
+ * n + 1 pairings, after randomizing each signature with a 64-bit scalar. The
+ * batch is rejected if any signature is invalid.
+ *
+ * @param[in] s				- the signatures.
+ * @param[in] msg			- the signed messages.
+ * @param[in] len			- the message lengths in bytes.
+ * @param[in] q				- the public keys.
+ * @param[in] n				- the number of signatures.
+ * @return a boolean value indicating if all signatures are valid.
+ */
+int cp_bls_bat_ver(const g1_t *s, const uint8_t **msg, const size_t *len,
+		const g2_t *q, int n);
+
+/**
+ * Verifies a BLS signature against a prepared public key, skipping the
+ * membership test of the key and the G_2 part of the Miller loop. The
+ * signature is still checked to be in G_1.
+ *
+ * @param[in] s				- the signature.
+ * @param[in] msg			- the message to sign.
+ * @param[in] len			- the message length in bytes.
+ * @param[in] q				- the prepared public key.
+ * @return a boolean value indicating if the signature is valid.
+ */
+int cp_bls_ver_key(const g1_t s, const uint8_t *msg, size_t len,
+		const g2_key_t q);
+
+/**
+ * Verifies a batch of independent BLS signatures against prepared public keys,
+ * as in the batch verification with public keys in G_2.
+ *
+ * @param[in] s				- the signatures.
+ * @param[in] msg			- the signed messages.
+ * @param[in] len			- the message lengths in bytes.
+ * @param[in] q				- the prepared public keys.
+ * @param[in] n				- the number of signatures.
+ * @return a boolean value indicating if all signatures are valid.
+ */
+int cp_bls_bat_ver_key(const g1_t *s, const uint8_t **msg, const size_t *len,
+		const g2_key_t *q, int n);
+
 /**
  * Generates a key pair for the Boneh-Boyen (BB) signature protocol.
  *
@@ -229,6 +229,12 @@ enum {
  */
 #define RLC_EP_CTMAP_MAX		16
 
+/**
+ * Minimum number of points for which the simultaneous multiplication of many
+ * points switches to the bucket method.
+ */
+#define RLC_EP_BUCKET			64
+
 /*============================================================================*/
 /* Type definitions                                                           */
 /*============================================================================*/
@@ -989,6 +995,18 @@ void ep_mul_gen(ep_t r, const bn_t k);
  */
 void ep_mul_dig(ep_t r, const ep_t p, dig_t k);
 
+/**
+ * Multiplies a prime elliptic point by an integer in sparse form, such as the
+ * curve parameter. The result is not normalized.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the point to multiply.
+ * @param[in] b				- the integer in sparse form.
+ * @param[in] len			- the length of the integer in sparse form.
+ * @param[in] sign			- the sign of the integer.
+ */
+void ep_mul_sps(ep_t r, const ep_t p, const int *b, int len, int sign);
+
 /**
  * Builds a precomputation table for multiplying a fixed prime elliptic point
  * using the binary method.
@@ -1166,6 +1184,36 @@ void ep_mul_sim_joint(ep_t r, const ep_t p, const bn_t k, const ep_t q,
  */
 void ep_mul_sim_lot(ep_t r, const ep_t p[], const bn_t k[], int n);
 
+/**
+ * Multiplies and adds multiple elliptic curve points simultaneously using the
+ * bucket method of Pippenger, accumulating the buckets in affine coordinates
+ * with simultaneous inversions. Computes R = \Sum_i=0..n [k_i]P_i without
+ * reducing the scalars.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the elements to multiply.
+ * @param[in] k				- the integer scalars.
+ * @param[in] n				- the number of elements to multiply.
+ * @throw ERR_NO_MEMORY		- if there is no available memory.
+ */
+void ep_mul_sim_bucket(ep_t r, const ep_t p[], const bn_t k[], int n);
+
+/**
+ * Multiplies and adds multiple elliptic curve points simultaneously using
+ * several threads. The points are split into n slices, each slice is
+ * multiplied in its own thread with a private copy of the library context,
+ * and the partial sums are added at the end. Threads are only spawned when
+ * the library is built with MULTI; otherwise the slices are computed in
+ * sequence.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the elements to multiply.
+ * @param[in] k				- the integer scalars.
+ * @param[in] m				- the number of elements to multiply.
+ * @param[in] n				- the number of threads.
+ */
+void ep_mul_sim_par(ep_t r, const ep_t p[], const bn_t k[], int m, int n);
+
 /**
  * Multiplies and adds the generator and a prime elliptic curve point
  * simultaneously. Computes R = [k]G + [m]Q.
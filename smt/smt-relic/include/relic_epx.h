@@ -91,6 +91,44 @@
 #define RLC_EPX_TABLE_MAX 	RLC_MAX(RLC_EPX_TABLE_BASIC, RLC_EPX_TABLE_COMBD)
 #endif
 
+/**
+ * Number of subscalars in the decomposition of a scalar by the endomorphism
+ * psi over BW13 curves.
+ */
+#define RLC_EP13_SUB			24
+
+/**
+ * Minimum number of points for which the simultaneous multiplication of many
+ * points switches to the bucket method.
+ */
+#define RLC_EP2_BUCKET			32
+
+/**
+ * Size of a precomputation table for BW13 curves using the single-table comb
+ * method, with one group of 2^EP_DEPTH points for each EP_DEPTH subscalars.
+ */
+#define RLC_EP13_TABLE_COMBS	(RLC_CEIL(RLC_EP13_SUB, EP_DEPTH) << EP_DEPTH)
+
+/**
+ * Size of a precomputation table for BW13 curves using the w-(T)NAF method,
+ * with the odd multiples of each power of psi applied to the point.
+ */
+#define RLC_EP13_TABLE_LWNAF	(RLC_EP13_SUB << (EP_DEPTH - 2))
+
+/**
+ * Size of a precomputation table for BW13 curves using the chosen algorithm.
+ */
+#if EP_FIX == LWNAF || EP_FIX == GLV
+#define RLC_EP13_TABLE			RLC_EP13_TABLE_LWNAF
+#else
+#define RLC_EP13_TABLE			RLC_EP13_TABLE_COMBS
+#endif
+
+/**
+ * Maximum size of a precomputation table for BW13 curves.
+ */
+#define RLC_EP13_TABLE_MAX		RLC_MAX(RLC_EP13_TABLE_COMBS, RLC_EP13_TABLE_LWNAF)
+
 /**
  * Maximum number of coefficients of an isogeny map polynomial.
  * 4 is sufficient for a degree-3 isogeny polynomial.
@@ -686,45 +724,34 @@ typedef ep13_st *ep13_t;
 #endif
 
 /**
- * Builds a precomputation table for multiplying a fixed prime elliptic point
- * over a quadratic extension.
+ * Builds a precomputation table for multiplying a fixed point on a BW13 curve
+ * over a 13-th extension. Only the comb and w-NAF methods are available, both
+ * built on the decomposition by psi, so the remaining choices map to the comb
+ * method.
  *
  * @param[out] T				- the precomputation table.
  * @param[in] P					- the point to multiply.
  */
-#if EP_FIX == BASIC
-#define ep13_mul_pre(T, P)		ep13_mul_pre_basic(T, P)
-#elif EP_FIX == COMBS
-#define ep13_mul_pre(T, P)		ep13_mul_pre_combs(T, P)
-#elif EP_FIX == COMBD
-#define ep13_mul_pre(T, P)		ep13_mul_pre_combd(T, P)
-#elif EP_FIX == LWNAF
-#define ep13_mul_pre(T, P)		ep13_mul_pre_lwnaf(T, P)
-#elif EP_FIX == GLV
-//TODO: implement ep2_mul_pre_glv
+#if EP_FIX == LWNAF || EP_FIX == GLV
 #define ep13_mul_pre(T, P)		ep13_mul_pre_lwnaf(T, P)
+#else
+#define ep13_mul_pre(T, P)		ep13_mul_pre_combs(T, P)
 #endif
 
 /**
- * Multiplies a fixed prime elliptic point over a quadratic extension using a
+ * Multiplies a fixed point on a BW13 curve over a 13-th extension using a
  * precomputation table. Computes R = kP.
  *
  * @param[out] R				- the result.
  * @param[in] T					- the precomputation table.
  * @param[in] K					- the integer.
  */
-#if EP_FIX == BASIC
-#define ep13_mul_fix(R, T, K)	ep13_mul_fix_basic(R, T, K)
-#elif EP_FIX == COMBS
-#define ep13_mul_fix(R, T, K)	ep13_mul_fix_combs(R, T, K)
-#elif EP_FIX == COMBD
-#define ep13_mul_fix(R, T, K)	ep13_mul_fix_combd(R, T, K)
-#elif EP_FIX == LWNAF
-#define ep13_mul_fix(R, T, K)	ep13_mul_fix_lwnaf(R, T, K)
-#elif EP_FIX == GLV
-//TODO: implement ep2_mul_pre_glv
+#if EP_FIX == LWNAF || EP_FIX == GLV
 #define ep13_mul_fix(R, T, K)	ep13_mul_fix_lwnaf(R, T, K)
+#else
+#define ep13_mul_fix(R, T, K)	ep13_mul_fix_combs(R, T, K)
 #endif
+
 /**
  * Given a random point q of E, computes uq, where the seed u is used to parameterize the elliptic curves
  *
@@ -732,21 +759,34 @@ typedef ep13_st *ep13_t;
  * @param[in] q					- the  point to multiply.
  
  */
-void  ep13_rand_mul_u(ep13_t r, ep13_t q);
+void ep13_rand_mul_u(ep13_t r, ep13_t q);
+
+/**
+ * Multiplies a prime elliptic point by an integer in sparse form, such as the
+ * curve parameter. The base is normalized first, so that additions are
+ * mixed. The result is not normalized.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the point to multiply.
+ * @param[in] b				- the integer in sparse form.
+ * @param[in] len			- the length of the integer in sparse form.
+ * @param[in] sign			- the sign of the integer.
+ */
+void ep13_mul_sps(ep13_t r, ep13_t p, const int *b, int len, int sign);
 /**
  * Given a random point q of E, hashing q to G2
  *
  * @param[out] r				- the result.
  * @param[in] q					- the  random point .
  */
-void  ep13_cof(ep13_t r, ep13_t p);
+void ep13_cof(ep13_t r, ep13_t p);
 /**
  * Given a random point q of E, hashing q to G2 using fuentes et's method
  *
  * @param[out] r				- the result.
  * @param[in] q					- the  random point .
  */
-void  ep13_cof_fuentes(ep13_t r, ep13_t p);
+void ep13_cof_fuentes(ep13_t r, ep13_t p);
 /**
  * Multiplies and adds two prime elliptic curve points simultaneously. Computes
  * R = kP + lQ.
@@ -1136,6 +1176,18 @@ void ep2_mul_gen(ep2_t r, const bn_t k);
  */
 void ep2_mul_dig(ep2_t r, const ep2_t p, const dig_t k);
 
+/**
+ * Multiplies a prime elliptic point by an integer in sparse form, such as the
+ * curve parameter. The result is not normalized.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the point to multiply.
+ * @param[in] b				- the integer in sparse form.
+ * @param[in] len			- the length of the integer in sparse form.
+ * @param[in] sign			- the sign of the integer.
+ */
+void ep2_mul_sps(ep2_t r, const ep2_t p, const int *b, int len, int sign);
+
 
 /**
  * Multiplies a point in an elliptic curve over a quadratic extension field by
@@ -1320,6 +1372,35 @@ void ep2_mul_sim_joint(ep2_t r, const ep2_t p, const bn_t k, const ep2_t q, cons
  */
 void ep2_mul_sim_lot(ep2_t r, const ep2_t p[], const bn_t k[], int n);
 
+/**
+ * Multiplies simultaneously elements from a prime elliptic curve using the
+ * bucket method of Pippenger, accumulating the buckets in affine coordinates
+ * with simultaneous inversions. Computes R = \Sum_i=0..n k_iP_i without
+ * reducing the scalars.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the points to multiply.
+ * @param[in] k				- the integer scalars.
+ * @param[in] n				- the number of elements to multiply.
+ * @throw ERR_NO_MEMORY		- if there is no available memory.
+ */
+void ep2_mul_sim_bucket(ep2_t r, const ep2_t p[], const bn_t k[], int n);
+
+/**
+ * Multiplies simultaneously elements from a prime elliptic curve using several
+ * threads. The points are split into n slices, each slice is multiplied in its
+ * own thread with a private copy of the library context, and the partial sums
+ * are added at the end. Threads are only spawned when the library is built with
+ * MULTI; otherwise the slices are computed in sequence.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the points to multiply.
+ * @param[in] k				- the integer scalars.
+ * @param[in] m				- the number of elements to multiply.
+ * @param[in] n				- the number of threads.
+ */
+void ep2_mul_sim_par(ep2_t r, const ep2_t p[], const bn_t k[], int m, int n);
+
 /**
  * Multiplies and adds the generator and a prime elliptic curve point
  * simultaneously. Computes R = [k]G + [l]Q.
@@ -1776,6 +1857,18 @@ void ep4_mul_gen(ep4_t r, const bn_t k);
  */
 void ep4_mul_dig(ep4_t r, const ep4_t p, const dig_t k);
 
+/**
+ * Multiplies a prime elliptic point by an integer in sparse form, such as the
+ * curve parameter. The result is not normalized.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the point to multiply.
+ * @param[in] b				- the integer in sparse form.
+ * @param[in] len			- the length of the integer in sparse form.
+ * @param[in] sign			- the sign of the integer.
+ */
+void ep4_mul_sps(ep4_t r, const ep4_t p, const int *b, int len, int sign);
+
 
 /**
  * Multiplies a point in an elliptic curve over a quartic extension field by
@@ -2143,6 +2236,58 @@ int ep13_cmp(ep13_t p, ep13_t q);
  */
 void ep13_tab(ep13_t *t, ep13_t p, int w);
 
+/**
+ * Returns the number of bytes necessary to store a prime elliptic curve point
+ * over a 13-th extension with optional point compression.
+ *
+ * @param[in] a				- the prime elliptic curve point.
+ * @param[in] pack			- the flag to indicate compression.
+ * @return the number of bytes.
+ */
+int ep13_size_bin(ep13_t a, int pack);
+
+/**
+ * Reads a prime elliptic curve point over a 13-th extension from a byte
+ * vector in big-endian format.
+ *
+ * @param[out] a			- the result.
+ * @param[in] bin			- the byte vector.
+ * @param[in] len			- the buffer capacity.
+ * @throw ERR_NO_VALID		- if the encoded point is invalid.
+ * @throw ERR_NO_BUFFER		- if the buffer capacity is invalid.
+ */
+void ep13_read_bin(ep13_t a, const uint8_t *bin, int len);
+
+/**
+ * Writes a prime elliptic curve point over a 13-th extension to a byte vector
+ * in big-endian format with optional point compression.
+ *
+ * @param[out] bin			- the byte vector.
+ * @param[in] len			- the buffer capacity.
+ * @param[in] a				- the prime elliptic curve point to write.
+ * @param[in] pack			- the flag to indicate point compression.
+ * @throw ERR_NO_BUFFER		- if the buffer capacity is invalid.
+ */
+void ep13_write_bin(uint8_t *bin, int len, ep13_t a, int pack);
+
+/**
+ * Compresses a point in an elliptic curve over a 13-th extension by keeping
+ * the x-coordinate and the sign of the y-coordinate.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the point to compress.
+ */
+void ep13_pck(ep13_t r, ep13_t p);
+
+/**
+ * Decompresses a point in an elliptic curve over a 13-th extension.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the point to decompress.
+ * @return if the decompression was successful
+ */
+int ep13_upk(ep13_t r, ep13_t p);
+
 /**
  * Configures an elliptic curve.
  *
@@ -2162,6 +2307,17 @@ void ep13_curve_get_gen(ep13_t g);
  */
 void ep13_curve_get_gen(ep13_t g);
 
+/**
+ * Maps an array of uniformly random bytes to a point in G2 of an elliptic
+ * curve over a 13-th extension. That array is expected to have a length
+ * suitable for two extension field elements plus extra bytes for uniformity.
+ *
+ * @param[out] p			- the result.
+ * @param[in] uniform_bytes	- the array of uniform bytes to map.
+ * @param[in] len			- the array length in bytes.
+ */
+void ep13_map_from_field(ep13_t p, const uint8_t *uniform_bytes, int len);
+
 /**
  * Maps a byte array to a point in G2 of an elliptic curve over a 13-th extension.
  *
@@ -2169,8 +2325,20 @@ void ep13_curve_get_gen(ep13_t g);
  * @param[in] msg			- the byte array to map.
  * @param[in] len			- the array length in bytes.
  */
-
 void ep13_map(ep13_t p, const uint8_t *msg, int len);
+
+/**
+ * Maps a byte array to a point in G2 of an elliptic curve over a 13-th
+ * extension using an explicit domain separation tag.
+ *
+ * @param[out] p			- the result.
+ * @param[in] msg			- the byte array to map.
+ * @param[in] len			- the array length in bytes.
+ * @param[in] dst			- the domain separation tag.
+ * @param[in] dst_len		- the domain separation tag length in bytes.
+ */
+void ep13_map_dst(ep13_t p, const uint8_t *msg, int len, const uint8_t *dst,
+		int dst_len);
 /**
  * Adds to points represented in affine coordinates in an elliptic curve over a
  * quadratic extension.
@@ -2210,7 +2378,7 @@ void ep13_add_projc(ep13_t r, ep13_t p, ep13_t q);
   * @param[in] p			- the first point.
   * @param[in] q			- the point to subtract.
   */
-void ep13_sub(ep13_t r, ep13_t p, ep13_t q);
+void ep13_sub_projc(ep13_t r, ep13_t p, ep13_t q);
 
 /**
  * Doubles a points represented in affine coordinates in an elliptic curve over
@@ -2293,4 +2461,44 @@ void ep13_mul_monty(ep13_t r, ep13_t p, const bn_t k);
  */
 void ep13_mul_lwnaf(ep13_t r, ep13_t p, const bn_t k);
 
+/**
+ * Builds a precomputation table for multiplying a fixed point on a BW13 curve
+ * using the single-table comb method over the RLC_EP13_SUB subscalars of the
+ * decomposition by psi. The table has RLC_EP13_TABLE_COMBS points.
+ *
+ * @param[out] t			- the precomputation table.
+ * @param[in] p				- the point to multiply.
+ */
+void ep13_mul_pre_combs(ep13_t *t, ep13_t p);
+
+/**
+ * Multiplies a fixed point on a BW13 curve by an integer using the
+ * single-table comb method.
+ *
+ * @param[out] r			- the result.
+ * @param[in] t				- the precomputation table.
+ * @param[in] k				- the integer.
+ */
+void ep13_mul_fix_combs(ep13_t r, ep13_t *t, const bn_t k);
+
+/**
+ * Builds a precomputation table for multiplying a fixed point on a BW13 curve
+ * using the w-NAF method, storing the odd multiples of the RLC_EP13_SUB powers
+ * of psi applied to the point. The table has RLC_EP13_TABLE_LWNAF points.
+ *
+ * @param[out] t			- the precomputation table.
+ * @param[in] p				- the point to multiply.
+ */
+void ep13_mul_pre_lwnaf(ep13_t *t, ep13_t p);
+
+/**
+ * Multiplies a fixed point on a BW13 curve by an integer using the w-NAF
+ * method.
+ *
+ * @param[out] r			- the result.
+ * @param[in] t				- the precomputation table.
+ * @param[in] k				- the integer.
+ */
+void ep13_mul_fix_lwnaf(ep13_t r, ep13_t *t, const bn_t k);
+
 #endif /* !RLC_EPX_H */
@@ -39,6 +39,28 @@
 #include "relic_fp.h"
 #include "relic_types.h"
 
+/*============================================================================*/
+/* Constant definitions                                                       */
+/*============================================================================*/
+
+/**
+ * Width of the signed windows used in fixed-base cyclotomic exponentiation.
+ */
+#define RLC_FP12_WIDTH			4
+
+/**
+ * Number of windows needed to represent an exponent of RLC_FP_BITS bits with
+ * signed digits of RLC_FP12_WIDTH bits.
+ */
+#define RLC_FP12_WINDS			((RLC_FP_BITS - 1) / RLC_FP12_WIDTH + 2)
+
+/**
+ * Number of quadratic extension field elements in a precomputation table for
+ * fixed-base cyclotomic exponentiation. Each window stores the positive digits
+ * of the base in compressed form, occupying four coefficients each.
+ */
+#define RLC_FP12_TABLE			(4 * RLC_FP12_WINDS * (1 << (RLC_FP12_WIDTH - 1)))
+
 /*============================================================================*/
 /* Type definitions                                                           */
 /*============================================================================*/
@@ -958,6 +980,17 @@ void fp2_sub_dig(fp2_t c, const fp2_t a, dig_t b);
 #define fp13_sqr(C, A)	fp13_sqr_lazyr(C, A)
 #endif
 
+/**
+ * Squares a 13-th extension field element in the cyclotomic subgroup of order
+ * Phi_13(p). Since the only proper subfield of F_{p^13} is F_p, there is no
+ * compressed (Granger-Scott or Karabina) squaring for this subgroup, and the
+ * lazy-reduced Karatsuba squaring is used.
+ *
+ * @param[out] C			- the result.
+ * @param[in] A				- the 13-th extension field element to square.
+ */
+#define fp13_sqr_cyc(C, A)	fp13_sqr_lazyr(C, A)
+
 
 
 /**
@@ -3386,6 +3419,20 @@ void fp2_exp_cyc_sim(fp2_t e, const fp2_t a, const bn_t b, const fp2_t c, const
  */
 void fp12_exp_cyc_sim(fp12_t e, const fp12_t a, const bn_t b, const fp12_t c, const bn_t d);
 
+/**
+ * Computes a product of powers of cyclotomic dodecic extension field elements.
+ * Computes c = \prod a_i^{b_i}. Exponents are decomposed with the Frobenius
+ * map on pairing-friendly curves, so the elements must have the order of the
+ * curve in that case.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the elements to exponentiate.
+ * @param[in] b				- the exponents.
+ * @param[in] n				- the number of elements.
+ * @throw ERR_NO_MEMORY		- if there is no available memory.
+ */
+void fp12_exp_cyc_sim_lot(fp12_t c, const fp12_t a[], const bn_t b[], int n);
+
 /**
  * Computes a power of a cyclotomic dodecic extension field element.
  *
@@ -3397,6 +3444,28 @@ void fp12_exp_cyc_sim(fp12_t e, const fp12_t a, const bn_t b, const fp12_t c, co
  */
 void fp12_exp_cyc_sps(fp12_t c, const fp12_t a, const int *b, int l, int s);
 
+/**
+ * Builds a precomputation table for fixed-base exponentiation of a cyclotomic
+ * dodecic extension field element. The table stores the powers a^(j * 2^(wi))
+ * for 1 <= j <= 2^(w-1) in compressed form, where w is RLC_FP12_WIDTH.
+ *
+ * @param[out] t			- the precomputation table, with RLC_FP12_TABLE
+ * 							elements.
+ * @param[in] a				- the cyclotomic element to exponentiate.
+ */
+void fp12_exp_cyc_pre(fp2_t *t, const fp12_t a);
+
+/**
+ * Computes a power of a cyclotomic dodecic extension field element using a
+ * precomputation table.
+ *
+ * @param[out] c			- the result.
+ * @param[in] t				- the precomputation table of the basis.
+ * @param[in] b				- the exponent.
+ * @throw ERR_NO_BUFFER		- if the exponent is larger than the table allows.
+ */
+void fp12_exp_cyc_fix(fp12_t c, const fp2_t *t, const bn_t b);
+
 /**
  * Compresses a dodecic extension field element.
  *
@@ -3497,17 +3566,41 @@ int fp13_cmp(const fp13_t a, const fp13_t b);
  */
 
 
+/**
+ * Returns the number of bytes necessary to store a 13-th extension field
+ * element. Compressed elements take a leading byte and twelve coefficients.
+ *
+ * @param[in] a				- the extension field element.
+ * @param[in] pack			- the flag to indicate compression.
+ * @return the number of bytes.
+ */
+int fp13_size_bin(fp13_t a, int pack);
+
 /**
  * Reads a 13-th extension field element from a byte vector in big-endian
  * format.
- * void fp13_read_str(fp13_t a,const char*str,int len,int radix);
  *
  * @param[out] a			- the result.
  * @param[in] bin			- the byte vector.
  * @param[in] len			- the buffer capacity.
  * @throw ERR_NO_BUFFER		- if the buffer capacity is not correct.
+ * @throw ERR_NO_VALID		- if the compressed encoding is not canonical.
  */
-void fp13_read_bin(fp13_t a,uint8_t *bin,int len);
+void fp13_read_bin(fp13_t a, const uint8_t *bin, int len);
+
+/**
+ * Writes a 13-th extension field element to a byte vector in big-endian
+ * format.
+ *
+ * @param[out] bin			- the byte vector.
+ * @param[in] len			- the buffer capacity.
+ * @param[in] a				- the extension field element to write.
+ * @param[in] pack			- the flag to indicate compression.
+ * @throw ERR_NO_BUFFER		- if the buffer capacity is not correct.
+ * @throw ERR_NO_VALID		- if compression is requested for an element
+ * 							outside the cyclotomic subgroup.
+ */
+void fp13_write_bin(uint8_t *bin, int len, fp13_t a, int pack);
 /**
  * Assigns a 13-th extension field element to a digit.
  *
@@ -3552,8 +3645,7 @@ void fp13_hlv(fp13_t c, fp13_t a);
 /**
  * Negates a 13-th extension field element.
  *
- * @param[out] c			void fp13_mul_frb(fp13_t c,fp13_t a,int i);
-- the result.
+ * @param[out] c			- the result.
  * @param[out] a			- the 13-th extension field element to negate.
  */
 void fp13_neg(fp13_t c,fp13_t a);
@@ -3607,11 +3699,25 @@ void fp13_inv_sim(fp13_t *c, fp13_t *a, int n);
  * @param[in] a				- the extension field element.
  * @return					- 1 if there is a square root, 0 otherwise.
  */
-
 int fp13_srt(fp13_t c, fp13_t a);
 
+/**
+ * Tests if a 13-th extension field element is a quadratic residue.
+ *
+ * @param[in] a				- the extension field element to test.
+ * @return					- 1 if the element is a square, -1 otherwise.
+ */
 int fp13_is_square(fp13_t a);
 
+/**
+ * Computes the norm of a 13-th extension field element over the prime field.
+ * Computes c = a^(1 + p + ... + p^12).
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the extension field element.
+ */
+void fp13_norm(fp_t c, fp13_t a);
+
 /**
  * Computes a power of a 13-th extension field element.
  *
@@ -3621,6 +3727,38 @@ int fp13_is_square(fp13_t a);
  */
 void fp13_exp(fp13_t c,fp13_t a,bn_t b);
 
+/**
+ * Tests if a 13-th extension field element is in the cyclotomic subgroup,
+ * that is, if its norm over the prime field is one.
+ *
+ * @param[in] a				- the 13-th extension field element to test.
+ * @return 1 if the extension field element is in the subgroup, 0 otherwise.
+ */
+int fp13_test_cyc(fp13_t a);
+
+/**
+ * Computes a power of a 13-th extension field element in the cyclotomic
+ * subgroup. Negative exponents cost a single extra unitary inversion.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the basis.
+ * @param[in] b				- the exponent.
+ */
+void fp13_exp_cyc(fp13_t c, fp13_t a, const bn_t b);
+
+/**
+ * Computes a power of a 13-th extension field element in the cyclotomic
+ * subgroup. Negative digits are accumulated separately, so that at most one
+ * unitary inversion is computed.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the basis.
+ * @param[in] b				- the exponent in sparse form.
+ * @param[in] l				- the length of the exponent in sparse form.
+ * @param[in] s				- the sign of the exponent.
+ */
+void fp13_exp_cyc_sps(fp13_t c, fp13_t a, const int *b, int l, int s);
+
 
 /**
  * Computes the Frobenius endomorphism of a 13-th extension element.
@@ -3640,6 +3778,27 @@ void fp13_frb(fp13_t c,fp13_t a,int i);
  */
 void fp13_inv_uni(fp13_t c,fp13_t a);
 
+/**
+ * Compresses a 13-th extension field element in the cyclotomic subgroup by
+ * computing the element b of F_{p^13} such that a = b/b^p, normalized so that
+ * its first non-zero coefficient is one. Elements outside the subgroup are
+ * copied unchanged.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the 13-th extension field element to compress.
+ * @return 1 if the element was compressed, 0 if it is outside the subgroup.
+ */
+int fp13_pck(fp13_t c, fp13_t a);
+
+/**
+ * Decompresses a 13-th extension field element by computing c = a/a^p.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the 13-th extension field element to decompress.
+ * @return if the decompression was successful
+ */
+int fp13_upk(fp13_t c, fp13_t a);
+
 /**
  * Copies the second argument to the first argument.
  *
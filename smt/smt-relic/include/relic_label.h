@@ -53,12 +53,14 @@
 #undef core_clean
 #undef core_get
 #undef core_set
+#undef core_run_par
 #undef core_set_thread_initializer
 
 #define core_init 	RLC_PREFIX(core_init)
 #define core_clean 	RLC_PREFIX(core_clean)
 #define core_get 	RLC_PREFIX(core_get)
 #define core_set 	RLC_PREFIX(core_set)
+#define core_run_par 	RLC_PREFIX(core_run_par)
 #define core_set_thread_initializer 	RLC_PREFIX(core_set_thread_initializer)
 
 #undef arch_init
@@ -77,21 +79,29 @@
 #undef bench_clean
 #undef bench_overhead
 #undef bench_reset
+#undef bench_label
 #undef bench_before
 #undef bench_after
 #undef bench_compute
 #undef bench_print
 #undef bench_total
+#undef bench_count_reset
+#undef bench_count_get
+#undef bench_count_name
 
 #define bench_init 	RLC_PREFIX(bench_init)
 #define bench_clean 	RLC_PREFIX(bench_clean)
 #define bench_overhead 	RLC_PREFIX(bench_overhead)
 #define bench_reset 	RLC_PREFIX(bench_reset)
+#define bench_label 	RLC_PREFIX(bench_label)
 #define bench_before 	RLC_PREFIX(bench_before)
 #define bench_after 	RLC_PREFIX(bench_after)
 #define bench_compute 	RLC_PREFIX(bench_compute)
 #define bench_print 	RLC_PREFIX(bench_print)
 #define bench_total 	RLC_PREFIX(bench_total)
+#define bench_count_reset 	RLC_PREFIX(bench_count_reset)
+#define bench_count_get 	RLC_PREFIX(bench_count_get)
+#define bench_count_name 	RLC_PREFIX(bench_count_name)
 
 #undef err_simple_msg
 #undef err_full_msg
@@ -952,6 +962,7 @@
 #undef ep_mul_lwreg
 #undef ep_mul_gen
 #undef ep_mul_dig
+#undef ep_mul_sps
 #undef ep_mul_pre_basic
 #undef ep_mul_pre_yaowi
 #undef ep_mul_pre_nafwi
@@ -969,6 +980,8 @@
 #undef ep_mul_sim_inter
 #undef ep_mul_sim_joint
 #undef ep_mul_sim_lot
+#undef ep_mul_sim_bucket
+#undef ep_mul_sim_par
 #undef ep_mul_sim_gen
 #undef ep_mul_sim_dig
 #undef ep_norm
@@ -978,6 +991,11 @@
 #undef ep_map_dst
 #undef ep_pck
 #undef ep_upk
+#undef ep_curve_set_twist
+#undef ep_curve_twist_get_gen
+#undef ep_twist_rand
+#undef ep_curve_twist_get_a
+#undef ep_curve_twist_get_b
 
 #define ep_curve_init 	RLC_PREFIX(ep_curve_init)
 #define ep_curve_clean 	RLC_PREFIX(ep_curve_clean)
@@ -1046,6 +1064,7 @@
 #define ep_mul_lwreg 	RLC_PREFIX(ep_mul_lwreg)
 #define ep_mul_gen 	RLC_PREFIX(ep_mul_gen)
 #define ep_mul_dig 	RLC_PREFIX(ep_mul_dig)
+#define ep_mul_sps 	RLC_PREFIX(ep_mul_sps)
 #define ep_mul_pre_basic 	RLC_PREFIX(ep_mul_pre_basic)
 #define ep_mul_pre_yaowi 	RLC_PREFIX(ep_mul_pre_yaowi)
 #define ep_mul_pre_nafwi 	RLC_PREFIX(ep_mul_pre_nafwi)
@@ -1063,6 +1082,8 @@
 #define ep_mul_sim_inter 	RLC_PREFIX(ep_mul_sim_inter)
 #define ep_mul_sim_joint 	RLC_PREFIX(ep_mul_sim_joint)
 #define ep_mul_sim_lot 	RLC_PREFIX(ep_mul_sim_lot)
+#define ep_mul_sim_bucket 	RLC_PREFIX(ep_mul_sim_bucket)
+#define ep_mul_sim_par 	RLC_PREFIX(ep_mul_sim_par)
 #define ep_mul_sim_gen 	RLC_PREFIX(ep_mul_sim_gen)
 #define ep_mul_sim_dig 	RLC_PREFIX(ep_mul_sim_dig)
 #define ep_norm 	RLC_PREFIX(ep_norm)
@@ -1072,6 +1093,11 @@
 #define ep_map_dst 	RLC_PREFIX(ep_map_dst)
 #define ep_pck 	RLC_PREFIX(ep_pck)
 #define ep_upk 	RLC_PREFIX(ep_upk)
+#define ep_curve_set_twist 	RLC_PREFIX(ep_curve_set_twist)
+#define ep_curve_twist_get_gen 	RLC_PREFIX(ep_curve_twist_get_gen)
+#define ep_twist_rand 	RLC_PREFIX(ep_twist_rand)
+#define ep_curve_twist_get_a 	RLC_PREFIX(ep_curve_twist_get_a)
+#define ep_curve_twist_get_b 	RLC_PREFIX(ep_curve_twist_get_b)
 
 #undef ed_st
 #undef ed_t
@@ -1414,6 +1440,7 @@
 #undef ep2_mul_lwreg
 #undef ep2_mul_gen
 #undef ep2_mul_dig
+#undef ep2_mul_sps
 #undef ep2_mul_cof
 #undef ep2_mul_pre_basic
 #undef ep2_mul_pre_yaowi
@@ -1432,6 +1459,8 @@
 #undef ep2_mul_sim_inter
 #undef ep2_mul_sim_joint
 #undef ep2_mul_sim_lot
+#undef ep2_mul_sim_bucket
+#undef ep2_mul_sim_par
 #undef ep2_mul_sim_gen
 #undef ep2_mul_sim_dig
 #undef ep2_norm
@@ -1487,6 +1516,7 @@
 #define ep2_mul_lwreg 	RLC_PREFIX(ep2_mul_lwreg)
 #define ep2_mul_gen 	RLC_PREFIX(ep2_mul_gen)
 #define ep2_mul_dig 	RLC_PREFIX(ep2_mul_dig)
+#define ep2_mul_sps 	RLC_PREFIX(ep2_mul_sps)
 #define ep2_mul_cof 	RLC_PREFIX(ep2_mul_cof)
 #define ep2_mul_pre_basic 	RLC_PREFIX(ep2_mul_pre_basic)
 #define ep2_mul_pre_yaowi 	RLC_PREFIX(ep2_mul_pre_yaowi)
@@ -1505,6 +1535,8 @@
 #define ep2_mul_sim_inter 	RLC_PREFIX(ep2_mul_sim_inter)
 #define ep2_mul_sim_joint 	RLC_PREFIX(ep2_mul_sim_joint)
 #define ep2_mul_sim_lot 	RLC_PREFIX(ep2_mul_sim_lot)
+#define ep2_mul_sim_bucket 	RLC_PREFIX(ep2_mul_sim_bucket)
+#define ep2_mul_sim_par 	RLC_PREFIX(ep2_mul_sim_par)
 #define ep2_mul_sim_gen 	RLC_PREFIX(ep2_mul_sim_gen)
 #define ep2_mul_sim_dig 	RLC_PREFIX(ep2_mul_sim_dig)
 #define ep2_norm 	RLC_PREFIX(ep2_norm)
@@ -1563,6 +1595,7 @@
 #undef ep4_mul_lwreg
 #undef ep4_mul_gen
 #undef ep4_mul_dig
+#undef ep4_mul_sps
 #undef ep4_mul_cof
 #undef ep4_mul_pre_basic
 #undef ep4_mul_pre_yaowi
@@ -1633,6 +1666,7 @@
 #define ep4_mul_lwreg 	RLC_PREFIX(ep4_mul_lwreg)
 #define ep4_mul_gen 	RLC_PREFIX(ep4_mul_gen)
 #define ep4_mul_dig 	RLC_PREFIX(ep4_mul_dig)
+#define ep4_mul_sps 	RLC_PREFIX(ep4_mul_sps)
 #define ep4_mul_cof 	RLC_PREFIX(ep4_mul_cof)
 #define ep4_mul_pre_basic 	RLC_PREFIX(ep4_mul_pre_basic)
 #define ep4_mul_pre_yaowi 	RLC_PREFIX(ep4_mul_pre_yaowi)
@@ -1661,6 +1695,101 @@
 #define ep4_pck 	RLC_PREFIX(ep4_pck)
 #define ep4_upk 	RLC_PREFIX(ep4_upk)
 
+#undef ep13_st
+#undef ep13_t
+#define ep13_st       RLC_PREFIX(ep13_st)
+#define ep13_t        RLC_PREFIX(ep13_t)
+
+#undef ep13_rand_mul_u
+#undef ep13_mul_sps
+#undef ep13_cof
+#undef ep13_cof_fuentes
+#undef ep13_print
+#undef ep13_neg
+#undef ep13_norm
+#undef ep13_norm_sim
+#undef ep13_on_curve
+#undef ep13_rhs
+#undef ep13_rand
+#undef ep13_copy
+#undef ep13_set_infty
+#undef ep13_is_infty
+#undef ep13_cmp
+#undef ep13_tab
+#undef ep13_size_bin
+#undef ep13_read_bin
+#undef ep13_write_bin
+#undef ep13_pck
+#undef ep13_upk
+#undef ep13_curve_set
+#undef ep13_curve_get_gen
+#undef ep13_curve_get_gen
+#undef ep13_map_from_field
+#undef ep13_map
+#undef ep13_map_dst
+#undef ep13_add_basic
+#undef ep13_add_slp_basic
+#undef ep13_add_projc
+#undef ep13_sub_projc
+#undef ep13_dbl_basic
+#undef ep13_dbl_slp_basic
+#undef ep13_dbl_projc
+#undef ep13_psi
+#undef ep13_frb
+#undef ep13_mul_basic
+#undef ep13_mul_slide
+#undef ep13_mul_monty
+#undef ep13_mul_lwnaf
+#undef ep13_mul_pre_combs
+#undef ep13_mul_fix_combs
+#undef ep13_mul_pre_lwnaf
+#undef ep13_mul_fix_lwnaf
+
+#define ep13_rand_mul_u 	RLC_PREFIX(ep13_rand_mul_u)
+#define ep13_mul_sps 	RLC_PREFIX(ep13_mul_sps)
+#define ep13_cof 	RLC_PREFIX(ep13_cof)
+#define ep13_cof_fuentes 	RLC_PREFIX(ep13_cof_fuentes)
+#define ep13_print 	RLC_PREFIX(ep13_print)
+#define ep13_neg 	RLC_PREFIX(ep13_neg)
+#define ep13_norm 	RLC_PREFIX(ep13_norm)
+#define ep13_norm_sim 	RLC_PREFIX(ep13_norm_sim)
+#define ep13_on_curve 	RLC_PREFIX(ep13_on_curve)
+#define ep13_rhs 	RLC_PREFIX(ep13_rhs)
+#define ep13_rand 	RLC_PREFIX(ep13_rand)
+#define ep13_copy 	RLC_PREFIX(ep13_copy)
+#define ep13_set_infty 	RLC_PREFIX(ep13_set_infty)
+#define ep13_is_infty 	RLC_PREFIX(ep13_is_infty)
+#define ep13_cmp 	RLC_PREFIX(ep13_cmp)
+#define ep13_tab 	RLC_PREFIX(ep13_tab)
+#define ep13_size_bin 	RLC_PREFIX(ep13_size_bin)
+#define ep13_read_bin 	RLC_PREFIX(ep13_read_bin)
+#define ep13_write_bin 	RLC_PREFIX(ep13_write_bin)
+#define ep13_pck 	RLC_PREFIX(ep13_pck)
+#define ep13_upk 	RLC_PREFIX(ep13_upk)
+#define ep13_curve_set 	RLC_PREFIX(ep13_curve_set)
+#define ep13_curve_get_gen 	RLC_PREFIX(ep13_curve_get_gen)
+#define ep13_curve_get_gen 	RLC_PREFIX(ep13_curve_get_gen)
+#define ep13_map_from_field 	RLC_PREFIX(ep13_map_from_field)
+#define ep13_map 	RLC_PREFIX(ep13_map)
+#define ep13_map_dst 	RLC_PREFIX(ep13_map_dst)
+#define ep13_add_basic 	RLC_PREFIX(ep13_add_basic)
+#define ep13_add_slp_basic 	RLC_PREFIX(ep13_add_slp_basic)
+#define ep13_add_projc 	RLC_PREFIX(ep13_add_projc)
+#define ep13_sub_projc 	RLC_PREFIX(ep13_sub_projc)
+#define ep13_dbl_basic 	RLC_PREFIX(ep13_dbl_basic)
+#define ep13_dbl_slp_basic 	RLC_PREFIX(ep13_dbl_slp_basic)
+#define ep13_dbl_projc 	RLC_PREFIX(ep13_dbl_projc)
+#define ep13_psi 	RLC_PREFIX(ep13_psi)
+#define ep13_frb 	RLC_PREFIX(ep13_frb)
+#define ep13_mul_basic 	RLC_PREFIX(ep13_mul_basic)
+#define ep13_mul_slide 	RLC_PREFIX(ep13_mul_slide)
+#define ep13_mul_monty 	RLC_PREFIX(ep13_mul_monty)
+#define ep13_mul_lwnaf 	RLC_PREFIX(ep13_mul_lwnaf)
+#define ep13_mul_pre_combs 	RLC_PREFIX(ep13_mul_pre_combs)
+#define ep13_mul_fix_combs 	RLC_PREFIX(ep13_mul_fix_combs)
+#define ep13_mul_pre_lwnaf 	RLC_PREFIX(ep13_mul_pre_lwnaf)
+#define ep13_mul_fix_lwnaf 	RLC_PREFIX(ep13_mul_fix_lwnaf)
+
 #undef fp2_st
 #undef fp2_t
 #undef dv2_t
@@ -1697,6 +1826,10 @@
 #define fp12_st        RLC_PREFIX(fp12_st)
 #define fp12_t         RLC_PREFIX(fp12_t)
 #define dv12_t         RLC_PREFIX(dv12_t)
+#undef fp13_t
+#undef dv13_t
+#define fp13_t        RLC_PREFIX(fp13_t)
+#define dv13_t        RLC_PREFIX(dv13_t)
 #undef fp18_st
 #undef fp18_t
 #undef dv18_t
@@ -1766,6 +1899,8 @@
 #undef fp2_pck
 #undef fp2_upk
 #undef fp2_exp_cyc_sim
+#undef fp12_exp_cyc_pre
+#undef fp12_exp_cyc_fix
 
 #define fp2_add_dig 	RLC_PREFIX(fp2_add_dig)
 #define fp2_sub_dig 	RLC_PREFIX(fp2_sub_dig)
@@ -1811,6 +1946,8 @@
 #define fp2_pck 	RLC_PREFIX(fp2_pck)
 #define fp2_upk 	RLC_PREFIX(fp2_upk)
 #define fp2_exp_cyc_sim 	RLC_PREFIX(fp2_exp_cyc_sim)
+#define fp12_exp_cyc_pre 	RLC_PREFIX(fp12_exp_cyc_pre)
+#define fp12_exp_cyc_fix 	RLC_PREFIX(fp12_exp_cyc_fix)
 
 #undef fp2_addn_low
 #undef fp2_addm_low
@@ -2227,7 +2364,10 @@
 #undef fp12_exp_dig
 #undef fp12_exp_cyc
 #undef fp12_exp_cyc_sim
+#undef fp12_exp_cyc_sim_lot
 #undef fp12_exp_cyc_sps
+#undef fp12_exp_cyc_pre
+#undef fp12_exp_cyc_fix
 #undef fp12_pck
 #undef fp12_upk
 #undef fp12_pck_max
@@ -2272,12 +2412,103 @@
 #define fp12_exp_dig 	RLC_PREFIX(fp12_exp_dig)
 #define fp12_exp_cyc 	RLC_PREFIX(fp12_exp_cyc)
 #define fp12_exp_cyc_sim 	RLC_PREFIX(fp12_exp_cyc_sim)
+#define fp12_exp_cyc_sim_lot 	RLC_PREFIX(fp12_exp_cyc_sim_lot)
 #define fp12_exp_cyc_sps 	RLC_PREFIX(fp12_exp_cyc_sps)
+#define fp12_exp_cyc_pre 	RLC_PREFIX(fp12_exp_cyc_pre)
+#define fp12_exp_cyc_fix 	RLC_PREFIX(fp12_exp_cyc_fix)
 #define fp12_pck 	RLC_PREFIX(fp12_pck)
 #define fp12_upk 	RLC_PREFIX(fp12_upk)
 #define fp12_pck_max 	RLC_PREFIX(fp12_pck_max)
 #define fp12_upk_max 	RLC_PREFIX(fp12_upk_max)
 
+#undef fp13_rand
+#undef fp13_init
+#undef fp13_copy
+#undef fp13_zero
+#undef fp13_is_zero
+#undef fp13_print
+#undef fp13_cmp_dig
+#undef fp13_cmp
+#undef fp13_size_bin
+#undef fp13_read_bin
+#undef fp13_write_bin
+#undef fp13_set_dig
+#undef fp13_add
+#undef fp13_dbl
+#undef fp13_sub
+#undef fp13_hlv
+#undef fp13_neg
+#undef fp13_rdc
+#undef fp13_mul_lazyr
+#undef fp13_sqr_lazyr
+#undef fp13_inv
+#undef fp13_inv_sim
+#undef fp13_srt
+#undef fp13_is_square
+#undef fp13_norm
+#undef fp13_exp
+#undef fp13_test_cyc
+#undef fp13_exp_cyc
+#undef fp13_exp_cyc_sps
+#undef fp13_frb
+#undef fp13_inv_uni
+#undef fp13_pck
+#undef fp13_upk
+
+#define fp13_rand 	RLC_PREFIX(fp13_rand)
+#define fp13_init 	RLC_PREFIX(fp13_init)
+#define fp13_copy 	RLC_PREFIX(fp13_copy)
+#define fp13_zero 	RLC_PREFIX(fp13_zero)
+#define fp13_is_zero 	RLC_PREFIX(fp13_is_zero)
+#define fp13_print 	RLC_PREFIX(fp13_print)
+#define fp13_cmp_dig 	RLC_PREFIX(fp13_cmp_dig)
+#define fp13_cmp 	RLC_PREFIX(fp13_cmp)
+#define fp13_size_bin 	RLC_PREFIX(fp13_size_bin)
+#define fp13_read_bin 	RLC_PREFIX(fp13_read_bin)
+#define fp13_write_bin 	RLC_PREFIX(fp13_write_bin)
+#define fp13_set_dig 	RLC_PREFIX(fp13_set_dig)
+#define fp13_add 	RLC_PREFIX(fp13_add)
+#define fp13_dbl 	RLC_PREFIX(fp13_dbl)
+#define fp13_sub 	RLC_PREFIX(fp13_sub)
+#define fp13_hlv 	RLC_PREFIX(fp13_hlv)
+#define fp13_neg 	RLC_PREFIX(fp13_neg)
+#define fp13_rdc 	RLC_PREFIX(fp13_rdc)
+#define fp13_mul_lazyr 	RLC_PREFIX(fp13_mul_lazyr)
+#define fp13_sqr_lazyr 	RLC_PREFIX(fp13_sqr_lazyr)
+#define fp13_inv 	RLC_PREFIX(fp13_inv)
+#define fp13_inv_sim 	RLC_PREFIX(fp13_inv_sim)
+#define fp13_srt 	RLC_PREFIX(fp13_srt)
+#define fp13_is_square 	RLC_PREFIX(fp13_is_square)
+#define fp13_norm 	RLC_PREFIX(fp13_norm)
+#define fp13_exp 	RLC_PREFIX(fp13_exp)
+#define fp13_test_cyc 	RLC_PREFIX(fp13_test_cyc)
+#define fp13_exp_cyc 	RLC_PREFIX(fp13_exp_cyc)
+#define fp13_exp_cyc_sps 	RLC_PREFIX(fp13_exp_cyc_sps)
+#define fp13_frb 	RLC_PREFIX(fp13_frb)
+#define fp13_inv_uni 	RLC_PREFIX(fp13_inv_uni)
+#define fp13_pck 	RLC_PREFIX(fp13_pck)
+#define fp13_upk 	RLC_PREFIX(fp13_upk)
+
+#undef fp13_addn_low
+#undef fp13_subn_low
+#undef fp13_addd_low
+#undef fp13_addc_low
+#undef fp13_subd_low
+#undef fp13_subc_low
+#undef fp13_muln_low
+#undef fp13_sqrn_low
+#undef fp13_rdcn_low
+
+#define fp13_addn_low 	RLC_PREFIX(fp13_addn_low)
+#define fp13_subn_low 	RLC_PREFIX(fp13_subn_low)
+#define fp13_addd_low 	RLC_PREFIX(fp13_addd_low)
+#define fp13_addc_low 	RLC_PREFIX(fp13_addc_low)
+#define fp13_subd_low 	RLC_PREFIX(fp13_subd_low)
+#define fp13_subc_low 	RLC_PREFIX(fp13_subc_low)
+#define fp13_muln_low 	RLC_PREFIX(fp13_muln_low)
+#define fp13_sqrn_low 	RLC_PREFIX(fp13_sqrn_low)
+#define fp13_rdcn_low 	RLC_PREFIX(fp13_rdcn_low)
+
 #undef fp18_copy
 #undef fp18_zero
 #undef fp18_is_zero
@@ -2592,6 +2823,12 @@
 
 
 
+#undef bc_aes_cbc_enc
+#undef bc_aes_cbc_dec
+
+#define bc_aes_cbc_enc 	RLC_PREFIX(bc_aes_cbc_enc)
+#define bc_aes_cbc_dec 	RLC_PREFIX(bc_aes_cbc_dec)
+
 #undef pp_map_init
 #undef pp_map_clean
 #undef pp_add_k2_basic
@@ -2646,11 +2883,30 @@
 #undef pp_map_weilp_k12
 #undef pp_map_sim_weilp_k12
 #undef pp_map_oatep_k12
+#undef pp_mil_sim_oatep_k12
 #undef pp_map_sim_oatep_k12
+#undef pp_map_sim_par_k12
+#undef pp_pre_k12
+#undef pp_map_pre_k12
+#undef pp_map_sim_pre_k12
+#undef pp_map_sim_mix_k12
+#undef pp_size_pre_k12
+#undef pp_write_pre_k12
+#undef pp_read_pre_k12
 #undef pp_map_k24
 #undef pp_map_sim_k24
 #undef pp_map_k48
 #undef pp_map_k54
+#undef pp_add_k13_projc_lazyr
+#undef pp_dba_k13_projc_lazyr
+#undef pp_qpl_k13_projc_lazyr
+#undef pp_exp_bwk13
+#undef pp_map_sup_oatep_k13
+#undef pp_map_sim_k13
+#undef pp_pre_k13
+#undef pp_map_pre_k13
+#undef pp_pre_write_k13
+#undef pp_pre_read_k13
 
 #define pp_map_init 	RLC_PREFIX(pp_map_init)
 #define pp_map_clean 	RLC_PREFIX(pp_map_clean)
@@ -2706,19 +2962,108 @@
 #define pp_map_weilp_k12 	RLC_PREFIX(pp_map_weilp_k12)
 #define pp_map_sim_weilp_k12 	RLC_PREFIX(pp_map_sim_weilp_k12)
 #define pp_map_oatep_k12 	RLC_PREFIX(pp_map_oatep_k12)
+#define pp_mil_sim_oatep_k12 	RLC_PREFIX(pp_mil_sim_oatep_k12)
 #define pp_map_sim_oatep_k12 	RLC_PREFIX(pp_map_sim_oatep_k12)
+#define pp_map_sim_par_k12 	RLC_PREFIX(pp_map_sim_par_k12)
+#define pp_pre_k12 	RLC_PREFIX(pp_pre_k12)
+#define pp_map_pre_k12 	RLC_PREFIX(pp_map_pre_k12)
+#define pp_map_sim_pre_k12 	RLC_PREFIX(pp_map_sim_pre_k12)
+#define pp_map_sim_mix_k12 	RLC_PREFIX(pp_map_sim_mix_k12)
+#define pp_size_pre_k12 	RLC_PREFIX(pp_size_pre_k12)
+#define pp_write_pre_k12 	RLC_PREFIX(pp_write_pre_k12)
+#define pp_read_pre_k12 	RLC_PREFIX(pp_read_pre_k12)
 #define pp_map_k24 	RLC_PREFIX(pp_map_k24)
 #define pp_map_sim_k24 	RLC_PREFIX(pp_map_sim_k24)
 #define pp_map_k48 	RLC_PREFIX(pp_map_k48)
 #define pp_map_k54 	RLC_PREFIX(pp_map_k54)
+#define pp_add_k13_projc_lazyr 	RLC_PREFIX(pp_add_k13_projc_lazyr)
+#define pp_dba_k13_projc_lazyr 	RLC_PREFIX(pp_dba_k13_projc_lazyr)
+#define pp_qpl_k13_projc_lazyr 	RLC_PREFIX(pp_qpl_k13_projc_lazyr)
+#define pp_exp_bwk13 	RLC_PREFIX(pp_exp_bwk13)
+#define pp_map_sup_oatep_k13 	RLC_PREFIX(pp_map_sup_oatep_k13)
+#define pp_map_sim_k13 	RLC_PREFIX(pp_map_sim_k13)
+#define pp_pre_k13 	RLC_PREFIX(pp_pre_k13)
+#define pp_map_pre_k13 	RLC_PREFIX(pp_map_pre_k13)
+#define pp_pre_write_k13 	RLC_PREFIX(pp_pre_write_k13)
+#define pp_pre_read_k13 	RLC_PREFIX(pp_pre_read_k13)
 
 #undef pc_core_init
 #undef pc_core_calc
 #undef pc_core_clean
+#undef pc_map_key
+#undef pc_map_sim_key
+#undef pc_validate_bn
 
 #define pc_core_init 	RLC_PREFIX(pc_core_init)
 #define pc_core_calc 	RLC_PREFIX(pc_core_calc)
 #define pc_core_clean 	RLC_PREFIX(pc_core_clean)
+#define pc_map_key 	RLC_PREFIX(pc_map_key)
+#define pc_map_sim_key 	RLC_PREFIX(pc_map_sim_key)
+#define pc_validate_bn 	RLC_PREFIX(pc_validate_bn)
+
+#undef g1_mul
+#undef g1_mul_gen
+#undef g1_is_valid
+#undef g1_is_valid_bw13
+
+#define g1_mul 	RLC_PREFIX(g1_mul)
+#define g1_mul_gen 	RLC_PREFIX(g1_mul_gen)
+#define g1_is_valid 	RLC_PREFIX(g1_is_valid)
+#define g1_is_valid_bw13 	RLC_PREFIX(g1_is_valid_bw13)
+
+#undef g2_mul
+#undef g2_mul_gen
+#undef g2_is_valid
+#undef g2_is_valid_cached
+#undef g2_key_make
+#undef g2_key_clean
+#undef g2_key_set
+#undef g2_key_get_gen
+#undef g2_is_valid_bn
+#undef g2_is_valid_bn_batch
+#undef g2_is_valid_bw13
+
+#define g2_mul 	RLC_PREFIX(g2_mul)
+#define g2_mul_gen 	RLC_PREFIX(g2_mul_gen)
+#define g2_is_valid 	RLC_PREFIX(g2_is_valid)
+#define g2_is_valid_cached 	RLC_PREFIX(g2_is_valid_cached)
+#define g2_key_make 	RLC_PREFIX(g2_key_make)
+#define g2_key_clean 	RLC_PREFIX(g2_key_clean)
+#define g2_key_set 	RLC_PREFIX(g2_key_set)
+#define g2_key_get_gen 	RLC_PREFIX(g2_key_get_gen)
+#define g2_is_valid_bn 	RLC_PREFIX(g2_is_valid_bn)
+#define g2_is_valid_bn_batch 	RLC_PREFIX(g2_is_valid_bn_batch)
+#define g2_is_valid_bw13 	RLC_PREFIX(g2_is_valid_bw13)
+
+#undef gt_rand
+#undef gt_exp
+#undef gt_exp_dig
+#undef gt_exp_sim
+#undef gt_exp_sim_lot
+#undef gt_exp_gen
+#undef gt_pre_make
+#undef gt_pre_clean
+#undef gt_exp_pre
+#undef gt_exp_fix
+#undef gt_get_gen
+#undef gt_is_valid
+#undef gt_is_valid_bn
+#undef gt_is_valid_bw13
+
+#define gt_rand 	RLC_PREFIX(gt_rand)
+#define gt_exp 	RLC_PREFIX(gt_exp)
+#define gt_exp_dig 	RLC_PREFIX(gt_exp_dig)
+#define gt_exp_sim 	RLC_PREFIX(gt_exp_sim)
+#define gt_exp_sim_lot 	RLC_PREFIX(gt_exp_sim_lot)
+#define gt_exp_gen 	RLC_PREFIX(gt_exp_gen)
+#define gt_pre_make 	RLC_PREFIX(gt_pre_make)
+#define gt_pre_clean 	RLC_PREFIX(gt_pre_clean)
+#define gt_exp_pre 	RLC_PREFIX(gt_exp_pre)
+#define gt_exp_fix 	RLC_PREFIX(gt_exp_fix)
+#define gt_get_gen 	RLC_PREFIX(gt_get_gen)
+#define gt_is_valid 	RLC_PREFIX(gt_is_valid)
+#define gt_is_valid_bn 	RLC_PREFIX(gt_is_valid_bn)
+#define gt_is_valid_bw13 	RLC_PREFIX(gt_is_valid_bw13)
 
 #undef mpc_mt_gen
 #undef mpc_mt_lcl
@@ -2734,6 +3079,54 @@
 #define mpc_sss_gen 	RLC_PREFIX(mpc_sss_gen)
 #define mpc_sss_key 	RLC_PREFIX(mpc_sss_key)
 
+#undef g1_mul_lcl
+#undef g1_mul_bct
+#undef g1_mul_mpc
+#undef pc_map_lcl
+#undef pc_map_bct
+#undef pc_map_mpc
+
+#define g1_mul_lcl 	RLC_PREFIX(g1_mul_lcl)
+#define g1_mul_bct 	RLC_PREFIX(g1_mul_bct)
+#define g1_mul_mpc 	RLC_PREFIX(g1_mul_mpc)
+#define pc_map_lcl 	RLC_PREFIX(pc_map_lcl)
+#define pc_map_bct 	RLC_PREFIX(pc_map_bct)
+#define pc_map_mpc 	RLC_PREFIX(pc_map_mpc)
+
+#undef g2_mul_lcl
+#undef g2_mul_bct
+#undef g2_mul_mpc
+#undef pc_map_lcl
+#undef pc_map_bct
+#undef pc_map_mpc
+
+#define g2_mul_lcl 	RLC_PREFIX(g2_mul_lcl)
+#define g2_mul_bct 	RLC_PREFIX(g2_mul_bct)
+#define g2_mul_mpc 	RLC_PREFIX(g2_mul_mpc)
+#define pc_map_lcl 	RLC_PREFIX(pc_map_lcl)
+#define pc_map_bct 	RLC_PREFIX(pc_map_bct)
+#define pc_map_mpc 	RLC_PREFIX(pc_map_mpc)
+
+#undef gt_exp_lcl
+#undef gt_exp_bct
+#undef gt_exp_mpc
+#undef pc_map_mpc
+
+#define gt_exp_lcl 	RLC_PREFIX(gt_exp_lcl)
+#define gt_exp_bct 	RLC_PREFIX(gt_exp_bct)
+#define gt_exp_mpc 	RLC_PREFIX(gt_exp_mpc)
+#define pc_map_mpc 	RLC_PREFIX(pc_map_mpc)
+
+#undef pc_map_tri
+#undef pc_map_lcl
+#undef pc_map_bct
+#undef pc_map_mpc
+
+#define pc_map_tri 	RLC_PREFIX(pc_map_tri)
+#define pc_map_lcl 	RLC_PREFIX(pc_map_lcl)
+#define pc_map_bct 	RLC_PREFIX(pc_map_bct)
+#define pc_map_mpc 	RLC_PREFIX(pc_map_mpc)
+
 #undef crt_t
 #undef rsa_t
 #undef rabin_t
@@ -2816,6 +3209,11 @@
 #undef cp_bls_gen
 #undef cp_bls_sig
 #undef cp_bls_ver
+#undef cp_bls_agg_sig
+#undef cp_bls_agg_ver
+#undef cp_bls_bat_ver
+#undef cp_bls_ver_key
+#undef cp_bls_bat_ver_key
 #undef cp_bbs_gen
 #undef cp_bbs_sig
 #undef cp_bbs_ver
@@ -2966,6 +3364,11 @@
 #define cp_bls_gen 	RLC_PREFIX(cp_bls_gen)
 #define cp_bls_sig 	RLC_PREFIX(cp_bls_sig)
 #define cp_bls_ver 	RLC_PREFIX(cp_bls_ver)
+#define cp_bls_agg_sig 	RLC_PREFIX(cp_bls_agg_sig)
+#define cp_bls_agg_ver 	RLC_PREFIX(cp_bls_agg_ver)
+#define cp_bls_bat_ver 	RLC_PREFIX(cp_bls_bat_ver)
+#define cp_bls_ver_key 	RLC_PREFIX(cp_bls_ver_key)
+#define cp_bls_bat_ver_key 	RLC_PREFIX(cp_bls_bat_ver_key)
 #define cp_bbs_gen 	RLC_PREFIX(cp_bbs_gen)
 #define cp_bbs_sig 	RLC_PREFIX(cp_bbs_sig)
 #define cp_bbs_ver 	RLC_PREFIX(cp_bbs_ver)
@@ -3075,6 +3478,28 @@
 #define md_xmd_sh384 	RLC_PREFIX(md_xmd_sh384)
 #define md_xmd_sh512 	RLC_PREFIX(md_xmd_sh512)
 
+#undef fb_param_get
+#undef fp_invn_asm
+#undef fp2_rdc_basic
+#undef fp2_rdc_integ
+#undef fp3_rdc_basic
+#undef fp3_rdc_integ
+#undef ed_map_ell2_5mod8
+#undef ep_mul_sim_lot_endom
+#undef pp_dbl_k8_projc_new
+#undef pp_dbl_k8_projc_lazyr_new
+
+#define fb_param_get 	RLC_PREFIX(fb_param_get)
+#define fp_invn_asm 	RLC_PREFIX(fp_invn_asm)
+#define fp2_rdc_basic 	RLC_PREFIX(fp2_rdc_basic)
+#define fp2_rdc_integ 	RLC_PREFIX(fp2_rdc_integ)
+#define fp3_rdc_basic 	RLC_PREFIX(fp3_rdc_basic)
+#define fp3_rdc_integ 	RLC_PREFIX(fp3_rdc_integ)
+#define ed_map_ell2_5mod8 	RLC_PREFIX(ed_map_ell2_5mod8)
+#define ep_mul_sim_lot_endom 	RLC_PREFIX(ep_mul_sim_lot_endom)
+#define pp_dbl_k8_projc_new 	RLC_PREFIX(pp_dbl_k8_projc_new)
+#define pp_dbl_k8_projc_lazyr_new 	RLC_PREFIX(pp_dbl_k8_projc_lazyr_new)
+
 #endif /* LABEL */
 
 #endif /* !RLC_LABEL_H */
@@ -99,6 +99,27 @@
  */
 #define RLC_G2_TABLE			RLC_CAT(RLC_CAT(RLC_, RLC_G2_UPPER), _TABLE)
 
+/**
+ * Number of G_2 elements remembered as valid in the library context.
+ */
+#define RLC_G2_CACHE			16
+
+/**
+ * Indicates that pairings can be computed from precomputed line functions of
+ * the G_2 argument.
+ */
+#if FP_PRIME < 1536 && FP_PRIME != 315 && FP_PRIME != 317 && FP_PRIME != 509 \
+		&& PP_MAP == OATEP
+#define RLC_PC_PRE
+#endif
+
+/**
+ * Indicates that G_T elements can be exponentiated with precomputation tables.
+ */
+#if FP_PRIME < 1536 && FP_PRIME != 315 && FP_PRIME != 317 && FP_PRIME != 509
+#define RLC_GT_PRE
+#endif
+
 /*============================================================================*/
 /* Type definitions                                                           */
 /*============================================================================*/
@@ -128,6 +149,44 @@ typedef RLC_CAT(RLC_G2_LOWER, st) g2_st;
  */
 typedef RLC_CAT(RLC_GT_LOWER, t) gt_t;
 
+/**
+ * Represents a G_2 element prepared for repeated pairings, such as a
+ * long-lived public key.
+ */
+typedef struct {
+	/** The element in affine coordinates. */
+	g2_t q;
+	/** Flag to indicate that the element passed the membership test. */
+	int valid;
+#if defined(RLC_PC_PRE)
+	/** The precomputed line functions of the pairing with the element. */
+	fp2_t t[RLC_PP_TABLE_K12];
+#endif
+} g2_key_st;
+
+/**
+ * Pointer to a prepared G_2 element.
+ */
+typedef g2_key_st *g2_key_t;
+
+/**
+ * Represents a G_T element prepared for repeated exponentiations, such as the
+ * generator.
+ */
+typedef struct {
+	/** The element. */
+	gt_t a;
+#if defined(RLC_GT_PRE)
+	/** The compressed powers of the element. */
+	fp2_t t[RLC_FP12_TABLE];
+#endif
+} gt_pre_st;
+
+/**
+ * Pointer to a prepared G_T element.
+ */
+typedef gt_pre_st *gt_pre_t;
+
 /*============================================================================*/
 /* Macro definitions                                                          */
 /*============================================================================*/
@@ -198,6 +257,72 @@ typedef RLC_CAT(RLC_GT_LOWER, t) gt_t;
  */
 #define gt_free(A)			RLC_CAT(RLC_GT_LOWER, free)(A)
 
+/**
+ * Initializes a prepared G_2 element with a null value.
+ *
+ * @param[out] K			- the element to initialize.
+ */
+#define g2_key_null(K)		K = NULL
+
+/**
+ * Calls a function to allocate a prepared G_2 element.
+ *
+ * @param[out] K			- the new element.
+ * @throw ERR_NO_MEMORY		- if there is no available memory.
+ */
+#define g2_key_new(K)														\
+	K = (g2_key_t)calloc(1, sizeof(g2_key_st));								\
+	if (K == NULL) {														\
+		RLC_THROW(ERR_NO_MEMORY);											\
+	} else {																\
+		g2_key_make(K);														\
+	}
+
+/**
+ * Calls a function to clean and free a prepared G_2 element.
+ *
+ * @param[out] K			- the element to clean and free.
+ */
+#define g2_key_free(K)														\
+	if (K != NULL) {														\
+		g2_key_clean(K);													\
+		free(K);															\
+		K = NULL;															\
+	}
+
+/**
+ * Initializes a prepared G_T element with a null value.
+ *
+ * @param[out] T			- the element to initialize.
+ */
+#define gt_pre_null(T)		T = NULL
+
+/**
+ * Calls a function to allocate a prepared G_T element.
+ *
+ * @param[out] T			- the new element.
+ * @throw ERR_NO_MEMORY		- if there is no available memory.
+ */
+#define gt_pre_new(T)														\
+	T = (gt_pre_t)calloc(1, sizeof(gt_pre_st));								\
+	if (T == NULL) {														\
+		RLC_THROW(ERR_NO_MEMORY);											\
+	} else {																\
+		gt_pre_make(T);														\
+	}
+
+/**
+ * Calls a function to clean and free a prepared G_T element.
+ *
+ * @param[out] T			- the element to clean and free.
+ */
+#define gt_pre_free(T)														\
+	if (T != NULL) {														\
+		gt_pre_clean(T);													\
+		free(T);															\
+		T = NULL;															\
+	}
+
 
 
 /**
@@ -682,6 +807,28 @@ typedef RLC_CAT(RLC_GT_LOWER, t) gt_t;
  */
 #define g2_mul_dig(R, P, K)		RLC_CAT(RLC_G2_LOWER, mul_dig)(R, P, K)
 
+/**
+ * Multiplies an element from G_1 by an integer in sparse form.
+ *
+ * @param[out] R			- the result.
+ * @param[in] P				- the element to multiply.
+ * @param[in] B				- the integer in sparse form.
+ * @param[in] L				- the length of the integer in sparse form.
+ * @param[in] S				- the sign of the integer.
+ */
+#define g1_mul_sps(R, P, B, L, S)	RLC_CAT(RLC_G1_LOWER, mul_sps)(R, P, B, L, S)
+
+/**
+ * Multiplies an element from G_2 by an integer in sparse form.
+ *
+ * @param[out] R			- the result.
+ * @param[in] P				- the element to multiply.
+ * @param[in] B				- the integer in sparse form.
+ * @param[in] L				- the length of the integer in sparse form.
+ * @param[in] S				- the sign of the integer.
+ */
+#define g2_mul_sps(R, P, B, L, S)	RLC_CAT(RLC_G2_LOWER, mul_sps)(R, P, B, L, S)
+
 /**
  * Builds a precomputation table for multiplying an element from G_1.
  *
@@ -739,6 +886,19 @@ typedef RLC_CAT(RLC_GT_LOWER, t) gt_t;
  */
 #define g1_mul_sim_lot(R, P, K, N)	RLC_CAT(RLC_G1_LOWER, mul_sim_lot)(R, P, K, N)
 
+/**
+ * Multiplies simultaneously elements from G_1 using N threads, each handling
+ * a slice of the elements. Computes R = \Sum_i=0..m k_iP_i.
+ *
+ * @param[out] R			- the result.
+ * @param[in] P				- the G_1 elements to multiply.
+ * @param[in] K				- the integer scalars.
+ * @param[in] M				- the number of elements to multiply.
+ * @param[in] N				- the number of threads.
+ */
+#define g1_mul_sim_par(R, P, K, M, N)											\
+	RLC_CAT(RLC_G1_LOWER, mul_sim_par)(R, P, K, M, N)
+
 /**
  * Multiplies elements from G_1 by small scalars. Computes R = \sum k_iP_i.
  *
@@ -770,6 +930,24 @@ typedef RLC_CAT(RLC_GT_LOWER, t) gt_t;
  */
 #define g2_mul_sim_lot(R, P, K, N)	RLC_CAT(RLC_G2_LOWER, mul_sim_lot)(R, P, K, N)
 
+/**
+ * Multiplies simultaneously elements from G_2 using N threads, each handling
+ * a slice of the elements. Computes R = \Sum_i=0..m k_iP_i. Falls back to the
+ * sequential method when there is no parallel implementation.
+ *
+ * @param[out] R			- the result.
+ * @param[in] P				- the G_2 elements to multiply.
+ * @param[in] K				- the integer scalars.
+ * @param[in] M				- the number of elements to multiply.
+ * @param[in] N				- the number of threads.
+ */
+#if FP_PRIME == 315 || FP_PRIME == 317 || FP_PRIME == 509
+#define g2_mul_sim_par(R, P, K, M, N)	g2_mul_sim_lot(R, P, K, M)
+#else
+#define g2_mul_sim_par(R, P, K, M, N)											\
+	RLC_CAT(RLC_G2_LOWER, mul_sim_par)(R, P, K, M, N)
+#endif
+
 /**
  * Multiplies elements from G_2 by small scalars. Computes R = \sum k_iP_i.
  *
@@ -883,6 +1061,25 @@ typedef RLC_CAT(RLC_GT_LOWER, t) gt_t;
 #define pc_map_sim(R, P, Q, M);	RLC_CAT(RLC_PC_LOWER, map_sim_k2)(R, P, Q, M)
 #endif
 
+/**
+ * Computes the multi-pairing of G_1 elements and G_2 elements using N threads,
+ * each computing the Miller loop of a slice of the pairs. Falls back to the
+ * sequential multi-pairing when there is no parallel implementation.
+ *
+ * @param[out] R			- the result.
+ * @param[in] P				- the first pairing arguments.
+ * @param[in] Q				- the second pairing arguments.
+ * @param[in] M 			- the number of pairing arguments.
+ * @param[in] N 			- the number of threads.
+ */
+#if FP_PRIME < 1536 && FP_PRIME != 315 && FP_PRIME != 317 && FP_PRIME != 509 \
+		&& PP_MAP == OATEP
+#define pc_map_sim_par(R, P, Q, M, N);											\
+	RLC_CAT(RLC_PC_LOWER, map_sim_par_k12)(R, P, Q, M, N)
+#else
+#define pc_map_sim_par(R, P, Q, M, N);	pc_map_sim(R, P, Q, M)
+#endif
+
 /**
  * Computes the final exponentiation of the pairing.
  *
@@ -993,13 +1190,59 @@ void gt_exp_dig(gt_t c, const gt_t a, const dig_t b);
 void gt_exp_sim(gt_t e, const gt_t a, const bn_t b, const gt_t c, const bn_t d);
 
 /**
- * Exponentiates a generator from G_T by an integer. Computes c = a^b.
+ * Exponentiates many elements from G_T by integers simultaneously. Computes
+ * c = \prod a_i^{b_i}.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the elements to exponentiate.
+ * @param[in] b				- the integer exponents.
+ * @param[in] n				- the number of elements.
+ * @throw ERR_NO_MEMORY		- if there is no available memory.
+ */
+void gt_exp_sim_lot(gt_t c, const gt_t a[], const bn_t b[], int n);
+
+/**
+ * Exponentiates a generator from G_T by an integer. Computes c = a^b. The
+ * precomputation table of the generator is built in the first call.
  *
  * @param[out] c			- the result.
  * @param[in] b				- the integer exponent.
  */
 void gt_exp_gen(gt_t c, const bn_t b);
 
+/**
+ * Allocates the fields of a prepared G_T element.
+ *
+ * @param[out] t			- the element to initialize.
+ * @throw ERR_NO_MEMORY		- if there is no available memory.
+ */
+void gt_pre_make(gt_pre_t t);
+
+/**
+ * Frees the fields of a prepared G_T element.
+ *
+ * @param[out] t			- the element to clean.
+ */
+void gt_pre_clean(gt_pre_t t);
+
+/**
+ * Prepares an element from G_T for repeated exponentiations by building a
+ * table of its powers in compressed cyclotomic form.
+ *
+ * @param[out] t			- the prepared element.
+ * @param[in] a				- the element from G_T.
+ */
+void gt_exp_pre(gt_pre_t t, const gt_t a);
+
+/**
+ * Exponentiates a prepared element from G_T by an integer. Computes c = a^b.
+ *
+ * @param[out] c			- the result.
+ * @param[in] t				- the prepared element.
+ * @param[in] b				- the integer exponent.
+ */
+void gt_exp_fix(gt_t c, const gt_pre_t t, const bn_t b);
+
  /**
   * Returns the generator for the group G_T.
   *
@@ -1027,18 +1270,112 @@ int g2_is_valid(const g2_t a);
  * @param[in] a             - the element to check.
  */
 int gt_is_valid(const gt_t a);
+
+/**
+ * Checks if an element from G_2 is valid (has the right order), remembering
+ * the last RLC_G2_CACHE elements that passed the check in the library context
+ * so that long-lived public keys are only tested once. Elements are first
+ * checked to be on the curve and then looked up by the hash of their
+ * uncompressed encoding. Uses the faster membership test on BN curves.
+ *
+ * @param[in] a             - the element to check.
+ */
+int g2_is_valid_cached(const g2_t a);
+
+/**
+ * Allocates the fields of a prepared G_2 element.
+ *
+ * @param[out] k			- the element to initialize.
+ * @throw ERR_NO_MEMORY		- if there is no available memory.
+ */
+void g2_key_make(g2_key_t k);
+
+/**
+ * Frees the fields of a prepared G_2 element.
+ *
+ * @param[out] k			- the element to clean.
+ */
+void g2_key_clean(g2_key_t k);
+
+/**
+ * Prepares a G_2 element for repeated pairings. The element is normalized and
+ * checked for membership once, and the line functions of the pairing with
+ * the element are precomputed when the configured pairing supports it.
+ *
+ * @param[out] k			- the prepared element.
+ * @param[in] q				- the element from G_2.
+ * @return 1 if the element is valid, 0 otherwise.
+ */
+int g2_key_set(g2_key_t k, const g2_t q);
+
+/**
+ * Returns the generator of G_2 prepared for repeated pairings. The result is
+ * owned by the library context and must not be modified.
+ *
+ * @return the prepared generator.
+ */
+g2_key_t g2_key_get_gen(void);
+
+/**
+ * Computes the bilinear pairing of a G_1 element and a prepared G_2 element.
+ * Computes r = e(p, k).
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first element.
+ * @param[in] k				- the prepared second element.
+ */
+void pc_map_key(gt_t r, const g1_t p, const g2_key_t k);
+
+/**
+ * Computes the multi-pairing of G_1 elements and prepared G_2 elements.
+ * Computes r = \prod e(p_i, k_i).
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first pairing arguments.
+ * @param[in] k				- the prepared second pairing arguments.
+ * @param[in] m 			- the number of pairing arguments.
+ */
+void pc_map_sim_key(gt_t r, const g1_t *p, const g2_key_t *k, int m);
+
 /**
  * Checks if an element form G_2 on the BN curves is valid (has the right order).
  *
  * @param[in] a             - the element to check.
  */
 int g2_is_valid_bn(const g2_t a); 
+
+/**
+ * Checks if a vector of elements from G_2 on BN curves are valid (have the
+ * right order). The [z]-multiplication chain is shared by all elements and
+ * the final comparisons use a single simultaneous normalization.
+ *
+ * @param[out] res			- the result of the test for each element.
+ * @param[in] a				- the elements to check.
+ * @param[in] n				- the number of elements.
+ * @return 1 if all elements are valid, 0 otherwise.
+ */
+int g2_is_valid_bn_batch(int *res, const g2_t *a, int n);
+
 /**
  * Checks if an element form G_t on BN curves is valid  (has the right order).
  *
  * @param[in] a             - the element to check.
  */
 int gt_is_valid_bn(const gt_t a);
+
+/**
+ * Checks if a triple of elements from G_1, G_2 and G_T on BN curves is valid
+ * (all elements have the right order). The curve parameter and its sparse
+ * form are fetched once for the [z]-multiplication chains in G_2 and G_T,
+ * and the cheap curve and cyclotomic tests run before both chains.
+ *
+ * @param[in] p				- the element from G_1 to check.
+ * @param[in] q				- the element from G_2 to check.
+ * @param[in] e				- the element from G_T to check.
+ * @return 1 if all elements are valid, 0 otherwise.
+ */
+int pc_validate_bn(const g1_t p, const g2_t q, const gt_t e);
+
 int g1_is_valid_bw13(const ep_t a);
 int g2_is_valid_bw13(const ep13_t a);
 int gt_is_valid_bw13(const fp13_t a);
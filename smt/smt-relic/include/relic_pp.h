@@ -41,6 +41,36 @@
 #include "relic_epx.h"
 #include "relic_types.h"
 
+/*============================================================================*/
+/* Constant definitions                                                       */
+/*============================================================================*/
+
+/**
+ * Maximum number of Miller loop steps stored in a precomputation table for
+ * pairings with embedding degree 13, enough for loop parameters of up to 14
+ * bits.
+ */
+#define RLC_PP_LINES_K13	12
+
+/**
+ * Number of extension field elements in a precomputation table for pairings
+ * with embedding degree 13.
+ */
+#define RLC_PP_TABLE_K13	(4 + 6 * RLC_PP_LINES_K13)
+
+/**
+ * Maximum number of line functions stored in a precomputation table for the
+ * optimal ate pairing with embedding degree 12, enough for BN and BLS12 curves
+ * with a loop parameter of about a quarter of the prime size.
+ */
+#define RLC_PP_LINES_K12	(3 * RLC_FP_BITS / 8 + 10)
+
+/**
+ * Number of quadratic extension field elements in a precomputation table for
+ * pairings with embedding degree 12.
+ */
+#define RLC_PP_TABLE_K12	(3 * RLC_PP_LINES_K12)
+
 /*============================================================================*/
 /* Macro definitions                                                          */
 /*============================================================================*/
@@ -976,6 +1006,19 @@ void pp_map_sim_weilp_k12(fp12_t r, const ep_t *p, const ep2_t *q, int m);
  */
 void pp_map_oatep_k12(fp12_t r, const ep_t p, const ep2_t q);
 
+/**
+ * Computes the Miller loop of the optimal ate multi-pairing in a parameterized
+ * elliptic curve with embedding degree 12, without the final exponentiation.
+ * Outputs for disjoint sets of pairs can be multiplied together before a
+ * single final exponentiation.
+ *
+ * @param[out] r			- the result.
+ * @param[in] q				- the first pairing arguments.
+ * @param[in] p				- the second pairing arguments.
+ * @param[in] m 			- the number of pairings to evaluate.
+ */
+void pp_mil_sim_oatep_k12(fp12_t r, const ep_t *p, const ep2_t *q, int m);
+
 /**
  * Computes the optimal ate multi-pairing of in a parameterized elliptic
  * curve with embedding degree 12.
@@ -987,6 +1030,107 @@ void pp_map_oatep_k12(fp12_t r, const ep_t p, const ep2_t q);
  */
 void pp_map_sim_oatep_k12(fp12_t r, const ep_t *p, const ep2_t *q, int m);
 
+/**
+ * Computes the optimal ate multi-pairing in a parameterized elliptic curve with
+ * embedding degree 12 using several threads. The pairs are split into n
+ * slices, the Miller loop of each slice runs in its own thread with a private
+ * copy of the library context, and the partial results are multiplied before
+ * a single final exponentiation. Threads are only spawned when the library is
+ * built with MULTI; otherwise the slices are computed in sequence.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first pairing arguments.
+ * @param[in] q				- the second pairing arguments.
+ * @param[in] m 			- the number of pairings to evaluate.
+ * @param[in] n 			- the number of threads.
+ */
+void pp_map_sim_par_k12(fp12_t r, const ep_t *p, const ep2_t *q, int m,
+		int n);
+
+/**
+ * Precomputes the line functions of the optimal ate pairing over curves of
+ * embedding degree 12 for a fixed point in G_2. The table has
+ * RLC_PP_TABLE_K12 elements and is all zero for the point at infinity.
+ *
+ * @param[out] t			- the precomputation table.
+ * @param[in] q				- the fixed elliptic curve point.
+ * @throw ERR_NO_BUFFER		- if the loop parameter needs a larger table.
+ */
+void pp_pre_k12(fp2_t *t, const ep2_t q);
+
+/**
+ * Computes the optimal ate pairing over curves of embedding degree 12 using
+ * precomputed line functions for the point in G_2.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the elliptic curve point in G_1.
+ * @param[in] t				- the precomputation table.
+ */
+void pp_map_pre_k12(fp12_t r, const ep_t p, fp2_t *t);
+
+/**
+ * Computes the optimal ate multi-pairing over curves of embedding degree 12
+ * using precomputed line functions for the points in G_2.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the elliptic curve points in G_1.
+ * @param[in] t				- the precomputation tables.
+ * @param[in] m 			- the number of pairings to evaluate.
+ */
+void pp_map_sim_pre_k12(fp12_t r, const ep_t *p, fp2_t **t, int m);
+
+/**
+ * Computes the optimal ate multi-pairing over curves of embedding degree 12
+ * when only some of the points in G_2 have precomputed line functions. All
+ * pairings share the Miller loop and the final exponentiation.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the G_1 points paired with points in G_2.
+ * @param[in] q				- the points in G_2.
+ * @param[in] m 			- the number of pairings with points in G_2.
+ * @param[in] s				- the G_1 points paired with precomputed tables.
+ * @param[in] t				- the precomputation tables.
+ * @param[in] n 			- the number of pairings with precomputed tables.
+ */
+void pp_map_sim_mix_k12(fp12_t r, const ep_t *p, const ep2_t *q, int m,
+		const ep_t *s, fp2_t **t, int n);
+
+/**
+ * Returns the number of bytes necessary to store a precomputation table for
+ * the optimal ate pairing over curves of embedding degree 12. Only the line
+ * functions used by the current curve are stored, so the serialized table can
+ * only be read back under the same curve.
+ *
+ * @param[in] t				- the precomputation table.
+ * @return the number of bytes.
+ */
+int pp_size_pre_k12(fp2_t *t);
+
+/**
+ * Writes a precomputation table for the optimal ate pairing over curves of
+ * embedding degree 12 to a byte vector.
+ *
+ * @param[out] bin			- the byte vector.
+ * @param[in] len			- the buffer capacity.
+ * @param[in] t				- the precomputation table.
+ * @throw ERR_NO_BUFFER		- if the buffer capacity is not correct.
+ */
+void pp_write_pre_k12(uint8_t *bin, int len, fp2_t *t);
+
+/**
+ * Reads a precomputation table for the optimal ate pairing over curves of
+ * embedding degree 12 from a byte vector. The line functions are not checked
+ * against the point they were computed from, so the byte vector must come
+ * from trusted storage.
+ *
+ * @param[out] t			- the precomputation table.
+ * @param[in] bin			- the byte vector.
+ * @param[in] len			- the buffer capacity.
+ * @throw ERR_NO_BUFFER		- if the buffer capacity is not correct.
+ * @throw ERR_NO_VALID		- if the encoded table is invalid.
+ */
+void pp_read_pre_k12(fp2_t *t, const uint8_t *bin, int len);
+
 /**
  * Computes the Optimal Ate pairing of two points in a parameterized elliptic
  * curve with embedding degree 24.
@@ -1097,4 +1241,60 @@ void pp_exp_bwk13(fp13_t c, fp13_t l1, fp13_t l2);
 
 void pp_map_sup_oatep_k13(fp13_t r, ep_t p, ep13_t q);
 
+/**
+ * Computes a multi-pairing using the super optimal ate pairing over curves of
+ * embedding degree 13, sharing the Miller loop and the final exponentiation.
+ * Computes r = \prod_i e(p_i, q_i).
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first pairing arguments.
+ * @param[in] q				- the second pairing arguments.
+ * @param[in] m 			- the number of pairings to evaluate.
+ */
+void pp_map_sim_k13(fp13_t r, ep_t *p, ep13_t *q, int m);
+
+/**
+ * Precomputes the line functions of the super optimal ate pairing over curves
+ * of embedding degree 13 for a fixed point in G_2. The table has
+ * RLC_PP_TABLE_K13 elements.
+ *
+ * @param[out] t			- the precomputation table.
+ * @param[in] q				- the fixed elliptic curve point.
+ * @throw ERR_NO_BUFFER		- if the loop parameter needs a larger table.
+ */
+void pp_pre_k13(fp13_t *t, ep13_t q);
+
+/**
+ * Computes the super optimal ate pairing over curves of embedding degree 13
+ * using precomputed line functions for the point in G_2.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the elliptic curve point in G_1.
+ * @param[in] t				- the precomputation table.
+ */
+void pp_map_pre_k13(fp13_t r, ep_t p, fp13_t *t);
+
+/**
+ * Writes a precomputation table for pairings with embedding degree 13 to a
+ * byte vector of RLC_PP_TABLE_K13 * 13 * RLC_FP_BYTES bytes.
+ *
+ * @param[out] bin			- the byte vector.
+ * @param[in] len			- the buffer capacity.
+ * @param[in] t				- the precomputation table.
+ * @throw ERR_NO_BUFFER		- if the buffer capacity is not correct.
+ */
+void pp_pre_write_k13(uint8_t *bin, int len, fp13_t *t);
+
+/**
+ * Reads a precomputation table for pairings with embedding degree 13 from a
+ * byte vector.
+ *
+ * @param[out] t			- the precomputation table.
+ * @param[in] bin			- the byte vector.
+ * @param[in] len			- the buffer capacity.
+ * @throw ERR_NO_BUFFER		- if the buffer capacity is not correct.
+ * @throw ERR_NO_VALID		- if the encoded field elements are invalid.
+ */
+void pp_pre_read_k13(fp13_t *t, const uint8_t *bin, int len);
+
 #endif /* !RLC_PP_H */
@@ -103,7 +103,7 @@ int cp_bls_ver(const g1_t s, const uint8_t *msg, size_t len, const g2_t q) {
 		g2_neg(r[1], r[1]);
 
 		pc_map_sim(e, p, r, 2);
-		if (gt_is_unity(e) && g2_is_valid(q)) {
+		if (gt_is_unity(e) && g1_is_valid(s) && g2_is_valid_cached(q)) {
 			result = 1;
 		}
 	}
@@ -119,3 +119,268 @@ int cp_bls_ver(const g1_t s, const uint8_t *msg, size_t len, const g2_t q) {
 	}
 	return result;
 }
+
+int cp_bls_agg_sig(g1_t s, const g1_t *sig, int n) {
+	int result = RLC_OK;
+
+	RLC_TRY {
+		g1_set_infty(s);
+		for (int i = 0; i < n; i++) {
+			g1_add(s, s, sig[i]);
+		}
+		g1_norm(s, s);
+	}
+	RLC_CATCH_ANY {
+		result = RLC_ERR;
+	}
+	return result;
+}
+
+int cp_bls_agg_ver(const g1_t s, const uint8_t *msg, size_t len,
+		const g2_t *q, int n) {
+	g1_t p[2];
+	g2_t r[2];
+	gt_t e;
+	int result = 1;
+
+	if (n < 1) {
+		return 0;
+	}
+
+	g1_null(p[0]);
+	g1_null(p[1]);
+	g2_null(r[0]);
+	g2_null(r[1]);
+	gt_null(e);
+
+	RLC_TRY {
+		g1_new(p[0]);
+		g1_new(p[1]);
+		g2_new(r[0]);
+		g2_new(r[1]);
+		gt_new(e);
+
+		/* All keys signed the same message, so add them up first. */
+		g2_set_infty(r[0]);
+		for (int i = 0; i < n; i++) {
+			if (!g2_is_valid_cached(q[i])) {
+				result = 0;
+				break;
+			}
+			g2_add(r[0], r[0], q[i]);
+		}
+
+		if (result == 1) {
+			g1_map(p[0], msg, len);
+			g1_copy(p[1], s);
+			g2_get_gen(r[1]);
+			g2_neg(r[1], r[1]);
+
+			pc_map_sim(e, p, r, 2);
+			result = gt_is_unity(e) && g1_is_valid(s);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		g1_free(p[0]);
+		g1_free(p[1]);
+		g2_free(r[0]);
+		g2_free(r[1]);
+		gt_free(e);
+	}
+	return result;
+}
+
+int cp_bls_bat_ver(const g1_t *s, const uint8_t **msg, const size_t *len,
+		const g2_t *q, int n) {
+	g1_t t, *p;
+	g2_t *r;
+	bn_t k;
+	gt_t e;
+	int i, result = 1;
+
+	if (n < 1) {
+		return 0;
+	}
+
+	p = RLC_ALLOCA(g1_t, n + 1);
+	r = RLC_ALLOCA(g2_t, n + 1);
+
+	bn_null(k);
+	g1_null(t);
+	gt_null(e);
+
+	RLC_TRY {
+		if (p == NULL || r == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		bn_new(k);
+		g1_new(t);
+		gt_new(e);
+		for (i = 0; i <= n; i++) {
+			g1_null(p[i]);
+			g2_null(r[i]);
+			g1_new(p[i]);
+			g2_new(r[i]);
+		}
+
+		/* Check \prod e([k_i]H(m_i), q_i) * e(-\sum [k_i]s_i, g) = 1 for
+		 * random 64-bit k_i, so that invalid signatures cannot cancel out. */
+		g1_set_infty(p[n]);
+		for (i = 0; i < n; i++) {
+			if (!g1_is_valid(s[i]) || !g2_is_valid_cached(q[i])) {
+				result = 0;
+				break;
+			}
+			do {
+				bn_rand(k, RLC_POS, 64);
+			} while (bn_is_zero(k));
+			g1_map(p[i], msg[i], len[i]);
+			g1_mul(p[i], p[i], k);
+			g1_mul(t, s[i], k);
+			g1_add(p[n], p[n], t);
+			g2_copy(r[i], q[i]);
+		}
+
+		if (result == 1) {
+			g1_norm(p[n], p[n]);
+			g2_get_gen(r[n]);
+			g2_neg(r[n], r[n]);
+			pc_map_sim_par(e, p, r, n + 1, CORES);
+			result = gt_is_unity(e);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(k);
+		g1_free(t);
+		gt_free(e);
+		if (p != NULL && r != NULL) {
+			for (i = 0; i <= n; i++) {
+				g1_free(p[i]);
+				g2_free(r[i]);
+			}
+		}
+		RLC_FREE(p);
+		RLC_FREE(r);
+	}
+	return result;
+}
+
+int cp_bls_ver_key(const g1_t s, const uint8_t *msg, size_t len,
+		const g2_key_t q) {
+	g1_t p[2];
+	g2_key_t k[2];
+	gt_t e;
+	int result = 0;
+
+	if (!q->valid || !g1_is_valid(s)) {
+		return 0;
+	}
+
+	g1_null(p[0]);
+	g1_null(p[1]);
+	gt_null(e);
+
+	RLC_TRY {
+		g1_new(p[0]);
+		g1_new(p[1]);
+		gt_new(e);
+
+		g1_map(p[0], msg, len);
+		g1_neg(p[1], s);
+		k[0] = q;
+		k[1] = g2_key_get_gen();
+
+		pc_map_sim_key(e, p, k, 2);
+		if (gt_is_unity(e)) {
+			result = 1;
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		g1_free(p[0]);
+		g1_free(p[1]);
+		gt_free(e);
+	}
+	return result;
+}
+
+int cp_bls_bat_ver_key(const g1_t *s, const uint8_t **msg, const size_t *len,
+		const g2_key_t *q, int n) {
+	g1_t t, *p;
+	g2_key_t *k;
+	bn_t r;
+	gt_t e;
+	int i, result = 1;
+
+	if (n < 1) {
+		return 0;
+	}
+
+	p = RLC_ALLOCA(g1_t, n + 1);
+	k = RLC_ALLOCA(g2_key_t, n + 1);
+
+	bn_null(r);
+	g1_null(t);
+	gt_null(e);
+
+	RLC_TRY {
+		if (p == NULL || k == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		bn_new(r);
+		g1_new(t);
+		gt_new(e);
+		for (i = 0; i <= n; i++) {
+			g1_null(p[i]);
+			g1_new(p[i]);
+		}
+
+		/* Same randomized check as cp_bls_bat_ver(), with prepared keys. */
+		g1_set_infty(p[n]);
+		for (i = 0; i < n; i++) {
+			if (!g1_is_valid(s[i]) || !q[i]->valid) {
+				result = 0;
+				break;
+			}
+			do {
+				bn_rand(r, RLC_POS, 64);
+			} while (bn_is_zero(r));
+			g1_map(p[i], msg[i], len[i]);
+			g1_mul(p[i], p[i], r);
+			g1_mul(t, s[i], r);
+			g1_sub(p[n], p[n], t);
+			k[i] = q[i];
+		}
+
+		if (result == 1) {
+			g1_norm(p[n], p[n]);
+			k[n] = g2_key_get_gen();
+			pc_map_sim_key(e, p, k, n + 1);
+			result = gt_is_unity(e);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(r);
+		g1_free(t);
+		gt_free(e);
+		if (p != NULL) {
+			for (i = 0; i <= n; i++) {
+				g1_free(p[i]);
+			}
+		}
+		RLC_FREE(p);
+		RLC_FREE(k);
+	}
+	return result;
+}
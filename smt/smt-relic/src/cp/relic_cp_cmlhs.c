@@ -29,8 +29,70 @@
  * @ingroup cp
  */
 
+#include <stdlib.h>
+
 #include "relic.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Computes the product of the G_T elements selected by the labels, each one
+ * raised to the corresponding coefficient of the linear functions.
+ *
+ * @param[out] c			- the result.
+ * @param[in] label			- the integer labels.
+ * @param[in] hs			- the hashes of the labels.
+ * @param[in] f				- the linear coefficients.
+ * @param[in] flen			- the number of coefficients of each function.
+ * @param[in] slen			- the number of linear functions.
+ */
+static void cp_cmlhs_exp(gt_t c, const int label[], const gt_t *hs[],
+		const dig_t *f[], const size_t flen[], size_t slen) {
+	size_t n = 0, k = 0;
+	gt_t *a;
+	bn_t *b;
+
+	for (int i = 0; i < slen; i++) {
+		n += flen[i];
+	}
+	a = (gt_t *)calloc(n + 1, sizeof(gt_t));
+	b = (bn_t *)calloc(n + 1, sizeof(bn_t));
+
+	RLC_TRY {
+		if (a == NULL || b == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (k = 0; k < n; k++) {
+			gt_null(a[k]);
+			bn_null(b[k]);
+			gt_new(a[k]);
+			bn_new(b[k]);
+		}
+
+		k = 0;
+		for (int i = 0; i < slen; i++) {
+			for (int j = 0; j < flen[i]; j++, k++) {
+				gt_copy(a[k], hs[i][label[j]]);
+				bn_set_dig(b[k], f[i][j]);
+			}
+		}
+		gt_exp_sim_lot(c, a, b, n);
+	} RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	} RLC_FINALLY {
+		if (a != NULL && b != NULL) {
+			for (k = 0; k < n; k++) {
+				gt_free(a[k]);
+				bn_free(b[k]);
+			}
+		}
+		free(a);
+		free(b);
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -258,13 +320,8 @@ int cp_cmlhs_ver(const g1_t r, const g2_t s, const g1_t sig[], const g2_t z[],
 		pc_map_sim(u, c, y, slen);
 		pc_map(v, r, g2);
 		gt_mul(u, u, v);
-
-		for (int i = 0; i < slen; i++) {
-			for (int j = 0; j < flen[i]; j++) {
-				gt_exp_dig(v, hs[i][label[j]], f[i][j]);
-				gt_mul(u, u, v);
-			}
-		}
+		cp_cmlhs_exp(v, label, hs, f, flen, slen);
+		gt_mul(u, u, v);
 		if (gt_cmp(e, u) != RLC_EQ) {
 			result = 0;
 		}
@@ -302,25 +359,7 @@ int cp_cmlhs_ver(const g1_t r, const g2_t s, const g1_t sig[], const g2_t z[],
 
 void cp_cmlhs_off(gt_t vk, const g1_t h, const int label[], const gt_t *hs[],
 		const dig_t *f[], const size_t flen[], size_t slen) {
-	gt_t v;
-
-	gt_null(v);
-
-	RLC_TRY {
-		gt_new(v);
-
-		gt_set_unity(vk);
-		for (int i = 0; i < slen; i++) {
-			for (int j = 0; j < flen[i]; j++) {
-				gt_exp_dig(v, hs[i][label[j]], f[i][j]);
-				gt_mul(vk, vk, v);
-			}
-		}
-	} RLC_CATCH_ANY {
-		RLC_THROW(ERR_CAUGHT);
-	} RLC_FINALLY {
-		gt_free(v);
-	}
+	cp_cmlhs_exp(vk, label, hs, f, flen, slen);
 }
 
 int cp_cmlhs_onv(const g1_t r, const g2_t s, const g1_t sig[], const g2_t z[],
@@ -708,6 +708,8 @@ static void ep_add_jacob_imp(ep_t r, const ep_t p, const ep_t q) {
 #if EP_ADD == BASIC || !defined(STRIP)
 
 void ep_add_basic(ep_t r, const ep_t p, const ep_t q) {
+	RLC_OPCNT(OP_EP_ADD);
+
 	if (ep_is_infty(p)) {
 		ep_copy(r, q);
 		return;
@@ -740,6 +742,8 @@ void ep_add_slp_basic(ep_t r, fp_t s, const ep_t p, const ep_t q) {
 #if EP_ADD == PROJC || !defined(STRIP)
 
 void ep_add_projc(ep_t r, const ep_t p, const ep_t q) {
+	RLC_OPCNT(OP_EP_ADD);
+
 	if (ep_is_infty(p)) {
 		ep_copy(r, q);
 		return;
@@ -758,6 +762,8 @@ void ep_add_projc(ep_t r, const ep_t p, const ep_t q) {
 #if EP_ADD == JACOB || !defined(STRIP)
 
 void ep_add_jacob(ep_t r, const ep_t p, const ep_t q) {
+	RLC_OPCNT(OP_EP_ADD);
+
 	if (ep_is_infty(p)) {
 		ep_copy(r, q);
 		return;
@@ -487,6 +487,8 @@ static void ep_dbl_jacob_imp(ep_t r, const ep_t p) {
 #if EP_ADD == BASIC || !defined(STRIP)
 
 void ep_dbl_basic(ep_t r, const ep_t p) {
+	RLC_OPCNT(OP_EP_DBL);
+
 	if (ep_is_infty(p)) {
 		ep_set_infty(r);
 		return;
@@ -508,6 +510,8 @@ void ep_dbl_slp_basic(ep_t r, fp_t s, const ep_t p) {
 #if EP_ADD == PROJC || !defined(STRIP)
 
 void ep_dbl_projc(ep_t r, const ep_t p) {
+	RLC_OPCNT(OP_EP_DBL);
+
 	if (ep_is_infty(p)) {
 		ep_set_infty(r);
 		return;
@@ -521,6 +525,8 @@ void ep_dbl_projc(ep_t r, const ep_t p) {
 #if EP_ADD == JACOB || !defined(STRIP)
 
 void ep_dbl_jacob(ep_t r, const ep_t p) {
+	RLC_OPCNT(OP_EP_DBL);
+
 	if (ep_is_infty(p)) {
 		ep_set_infty(r);
 		return;
@@ -80,7 +80,8 @@ void ep_map_from_field(ep_t p, const uint8_t *uniform_bytes, int len) {
 	bn_t k;
 	fp_t t;
 	ep_t q;
-	int neg;
+	int l, neg;
+	const int *b;
 	/* enough space for two field elements plus extra bytes for uniformity */
 	const int len_per_elm = (FP_PRIME + ep_param_level() + 7) / 8;
 
@@ -151,13 +152,10 @@ void ep_map_from_field(ep_t p, const uint8_t *uniform_bytes, int len) {
 				/* Multiply by (1-x) to get the correct group, as proven in
 				 * Piellard. https://eprint.iacr.org/2022/352.pdf */
 				fp_prime_get_par(k);
-				bn_neg(k, k);
-				bn_add_dig(k, k, 1);
-				if (bn_bits(k) < RLC_DIG) {
-					ep_mul_dig(p, p, k->dp[0]);
-				} else {
-					ep_mul(p, p, k);
-				}
+				b = fp_prime_get_par_sps(&l);
+				ep_mul_sps(q, p, b, l, bn_sign(k));
+				ep_sub(p, p, q);
+				ep_norm(p, p);
 				break;
 			default:
 				/* multiply by cofactor to get the correct group. */
@@ -764,3 +764,52 @@ void ep_mul_dig(ep_t r, const ep_t p, dig_t k) {
 		bn_free(_k);
 	}
 }
+
+void ep_mul_sps(ep_t r, const ep_t p, const int *b, int len, int sign) {
+	ep_t u, v;
+	int i, j, k;
+
+	if (len == 0 || ep_is_infty(p)) {
+		ep_set_infty(r);
+		return;
+	}
+
+	ep_null(u);
+	ep_null(v);
+
+	RLC_TRY {
+		ep_new(u);
+		ep_new(v);
+
+		/* The base is used as given, so additions are mixed whenever it is
+		 * already in affine coordinates. */
+		ep_neg(u, p);
+
+		/* Process the sparse digits from the most significant one. */
+		ep_copy(v, (b[len - 1] < 0 ? u : p));
+		for (i = len - 2; i >= 0; i--) {
+			k = (b[i + 1] < 0 ? -b[i + 1] : b[i + 1]);
+			k -= (b[i] < 0 ? -b[i] : b[i]);
+			for (j = 0; j < k; j++) {
+				ep_dbl(v, v);
+			}
+			ep_add(v, v, (b[i] < 0 ? u : p));
+		}
+		for (j = 0; j < (b[0] < 0 ? -b[0] : b[0]); j++) {
+			ep_dbl(v, v);
+		}
+
+		if (sign == RLC_NEG) {
+			ep_neg(r, v);
+		} else {
+			ep_copy(r, v);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		ep_free(u);
+		ep_free(v);
+	}
+}
@@ -0,0 +1,123 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (c) 2019 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+
+/**
+ * @file
+ *
+ * Implementation of the thread-parallel simultaneous multiplication of many
+ * prime elliptic curve points.
+ *
+ * @ingroup ep
+ */
+
+#include "relic_core.h"
+#include "relic_ep.h"
+#include "relic_util.h"
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Slice of a simultaneous multiplication assigned to one worker thread.
+ */
+typedef struct {
+	/** The partial sum. */
+	ep_t *r;
+	/** The points of this slice. */
+	const ep_t *p;
+	/** The scalars of this slice. */
+	const bn_t *k;
+	/** The number of points in this slice. */
+	int m;
+} ep_job_t;
+
+/**
+ * Computes the simultaneous multiplication of a slice of points.
+ *
+ * @param[in,out] arg		- the slice to compute.
+ */
+static void ep_mul_job(void *arg) {
+	ep_job_t *job = (ep_job_t *)arg;
+
+	ep_mul_sim_lot(*(job->r), job->p, job->k, job->m);
+}
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+void ep_mul_sim_par(ep_t r, const ep_t p[], const bn_t k[], int m, int n) {
+	ep_t *s;
+	ep_job_t *job;
+	int i;
+
+	if (n > m) {
+		n = m;
+	}
+	if (n <= 1) {
+		ep_mul_sim_lot(r, p, k, m);
+		return;
+	}
+
+	s = RLC_ALLOCA(ep_t, n);
+	job = RLC_ALLOCA(ep_job_t, n);
+
+	RLC_TRY {
+		if (s == NULL || job == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < n; i++) {
+			ep_null(s[i]);
+			ep_new(s[i]);
+			/* Slice i covers points [i * m / n, (i + 1) * m / n). */
+			job[i].r = &s[i];
+			job[i].p = p + ((long)i * m) / n;
+			job[i].k = k + ((long)i * m) / n;
+			job[i].m = ((long)(i + 1) * m) / n - ((long)i * m) / n;
+		}
+
+		if (core_run_par(ep_mul_job, job, sizeof(ep_job_t), n) != RLC_OK) {
+			RLC_THROW(ERR_CAUGHT);
+		} else {
+			/* Add the partial sums of the slices. */
+			for (i = 1; i < n; i++) {
+				ep_add(s[0], s[0], s[i]);
+			}
+			ep_norm(r, s[0]);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		if (s != NULL) {
+			for (i = 0; i < n; i++) {
+				ep_free(s[i]);
+			}
+		}
+		RLC_FREE(s);
+		RLC_FREE(job);
+	}
+}
@@ -30,6 +30,8 @@
  * @ingroup ep
  */
 
+#include <stdlib.h>
+
 #include "relic_core.h"
 
 /*============================================================================*/
@@ -642,6 +644,118 @@ void ep_mul_sim_lot_plain(ep_t r, const ep_t p[], const bn_t k[], int n) {
 
 #endif /* EP_SIM == INTER */
 
+/**
+ * Number of bucket additions that share a simultaneous inversion in the bucket
+ * method.
+ */
+#define EP_BUCKET_BATCH		256
+
+/**
+ * Minimum number of pending points for which the buckets are updated in affine
+ * coordinates, as fewer additions do not pay for an inversion.
+ */
+#define EP_BUCKET_AFFINE	16
+
+/**
+ * Chooses the window size of the bucket method that minimizes the number of
+ * point additions, estimated as (l/c + 1)(n + 2^c) for windows of c bits.
+ *
+ * @param[in] n				- the number of points.
+ * @param[in] l				- the length of the scalars in bits.
+ * @return the window size.
+ */
+static int ep_bucket_width(int n, int l) {
+	int c, w = 2;
+	ull_t cost, best = 0;
+
+	for (c = 2; c <= 16; c++) {
+		cost = (ull_t)(l / c + 1) * ((ull_t)n + ((ull_t)1 << c));
+		if (c == 2 || cost < best) {
+			best = cost;
+			w = c;
+		}
+	}
+	return w;
+}
+
+/**
+ * Extracts a window of bits from the absolute value of an integer.
+ *
+ * @param[in] k				- the integer.
+ * @param[in] b				- the position of the first bit.
+ * @param[in] c				- the number of bits, at most 16.
+ * @return the window of bits.
+ */
+static int ep_bucket_bits(const bn_t k, int b, int c) {
+	int i = b >> RLC_DIG_LOG, s = b - (i << RLC_DIG_LOG), f = 0;
+	ull_t w = 0;
+
+	while (f < c && i < k->used) {
+		w |= (ull_t)(k->dp[i] >> s) << f;
+		f += RLC_DIG - s;
+		s = 0;
+		i++;
+	}
+	return (int)(w & (((ull_t)1 << c) - 1));
+}
+
+/**
+ * Adds points in affine coordinates to buckets in affine coordinates, sharing
+ * a single inversion among all the additions. The buckets must be distinct
+ * and different from the points and their negations.
+ *
+ * @param[in,out] b			- the buckets.
+ * @param[in] p				- the points.
+ * @param[in] d				- the signed digits selecting a bucket for each point.
+ * @param[in] s				- the indices of the points to add.
+ * @param[in,out] t			- the differences between the abscissae.
+ * @param[in] m				- the number of additions.
+ */
+static void ep_bucket_add(ep_t *b, const ep_t *p, const int *d, const int *s,
+		fp_t *t, int m) {
+	int i, j, e;
+	fp_t l, x, y;
+
+	fp_null(l);
+	fp_null(x);
+	fp_null(y);
+
+	RLC_TRY {
+		fp_new(l);
+		fp_new(x);
+		fp_new(y);
+
+		fp_inv_sim(t, (const fp_t *)t, m);
+		for (j = 0; j < m; j++) {
+			i = s[j];
+			e = (d[i] > 0 ? d[i] : -d[i]) - 1;
+			/* Compute the slope with the point negated if the digit is. */
+			if (d[i] > 0) {
+				fp_sub(l, p[i]->y, b[e]->y);
+			} else {
+				fp_add(l, p[i]->y, b[e]->y);
+				fp_neg(l, l);
+			}
+			fp_mul(l, l, t[j]);
+			fp_sqr(x, l);
+			fp_sub(x, x, b[e]->x);
+			fp_sub(x, x, p[i]->x);
+			fp_sub(y, b[e]->x, x);
+			fp_mul(y, y, l);
+			fp_sub(b[e]->y, y, b[e]->y);
+			fp_copy(b[e]->x, x);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp_free(l);
+		fp_free(x);
+		fp_free(y);
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -1022,6 +1136,212 @@ void ep_mul_sim_dig(ep_t r, const ep_t p[], const dig_t k[], int n) {
 	}
 }
 
+void ep_mul_sim_bucket(ep_t r, const ep_t p[], const bn_t k[], int n) {
+	int i, j, e, c, l, m, w, nb, cnt, len, nxt, defer, round = 0;
+	int *id = NULL, *d = NULL, *q = NULL, *mark = NULL, s[EP_BUCKET_BATCH];
+	int8_t *carry = NULL;
+	ep_t t, *_p = NULL, *b = NULL, *o = NULL, *sum = NULL;
+	fp_t den[EP_BUCKET_BATCH];
+
+	l = 0;
+	for (i = 0; i < n; i++) {
+		l = RLC_MAX(l, bn_bits(k[i]));
+	}
+	if (n == 0 || l == 0) {
+		ep_set_infty(r);
+		return;
+	}
+
+	c = ep_bucket_width(n, l);
+	nb = 1 << (c - 1);
+	w = l / c + 1;
+
+	ep_null(t);
+	for (i = 0; i < EP_BUCKET_BATCH; i++) {
+		fp_null(den[i]);
+	}
+
+	RLC_TRY {
+		/* Arrays indexed by point are allocated on the heap, as n is large. */
+		_p = (ep_t *)calloc(n, sizeof(ep_t));
+		id = (int *)malloc(n * sizeof(int));
+		d = (int *)malloc(n * sizeof(int));
+		q = (int *)malloc(n * sizeof(int));
+		carry = (int8_t *)calloc(n, sizeof(int8_t));
+		b = (ep_t *)calloc(nb, sizeof(ep_t));
+		o = (ep_t *)calloc(nb, sizeof(ep_t));
+		mark = (int *)malloc(nb * sizeof(int));
+		sum = (ep_t *)calloc(w, sizeof(ep_t));
+		if (_p == NULL || id == NULL || d == NULL || q == NULL ||
+				carry == NULL || b == NULL || o == NULL || mark == NULL ||
+				sum == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < n; i++) {
+			ep_null(_p[i]);
+			ep_new(_p[i]);
+		}
+		for (i = 0; i < nb; i++) {
+			ep_null(b[i]);
+			ep_null(o[i]);
+			ep_new(b[i]);
+			ep_new(o[i]);
+			ep_set_infty(b[i]);
+			ep_set_infty(o[i]);
+			mark[i] = -1;
+		}
+		for (i = 0; i < w; i++) {
+			ep_null(sum[i]);
+			ep_new(sum[i]);
+		}
+		for (i = 0; i < EP_BUCKET_BATCH; i++) {
+			fp_new(den[i]);
+		}
+		ep_new(t);
+
+		/* Keep the nontrivial terms, with the sign of the scalar in the point. */
+		m = 0;
+		for (i = 0; i < n; i++) {
+			if (!bn_is_zero(k[i]) && !ep_is_infty(p[i])) {
+				ep_copy(_p[m], p[i]);
+				if (bn_sign(k[i]) == RLC_NEG) {
+					ep_neg(_p[m], _p[m]);
+				}
+				id[m++] = i;
+			}
+		}
+		/* Convert the points to affine coordinates, a batch at a time. */
+		for (i = 0; i < m; i += EP_BUCKET_BATCH) {
+			cnt = RLC_MIN(EP_BUCKET_BATCH, m - i);
+			for (j = 0; j < cnt && _p[i + j]->coord == BASIC; j++);
+			if (j < cnt) {
+				ep_norm_sim(_p + i, (const ep_t *)(_p + i), cnt);
+			}
+		}
+
+		for (j = 0; j < w; j++) {
+			/* Recode window j into signed digits in [-2^(c-1) + 1, 2^(c-1)]. */
+			len = 0;
+			for (i = 0; i < m; i++) {
+				d[i] = ep_bucket_bits(k[id[i]], j * c, c) + carry[i];
+				carry[i] = (d[i] > nb);
+				if (carry[i]) {
+					d[i] -= 2 * nb;
+				}
+				if (d[i] != 0) {
+					q[len++] = i;
+				}
+			}
+
+			/* Points hitting a bucket already updated in the current batch are
+			 * deferred to the next pass, while that halves the pending ones. */
+			defer = 1;
+			while (len > 0) {
+				cnt = nxt = 0;
+				for (l = 0; l < len; l++) {
+					i = q[l];
+					e = (d[i] > 0 ? d[i] : -d[i]) - 1;
+					if (ep_is_infty(b[e])) {
+						ep_copy(b[e], _p[i]);
+						if (d[i] < 0) {
+							ep_neg(b[e], b[e]);
+						}
+					} else if (mark[e] == round && defer) {
+						q[nxt++] = i;
+					} else if (len < EP_BUCKET_AFFINE || mark[e] == round ||
+							fp_cmp(b[e]->x, _p[i]->x) == RLC_EQ) {
+						/* Accumulate in projective coordinates when there are
+						 * few points, deferring stalls or the affine addition
+						 * degenerates. */
+						if (d[i] > 0) {
+							ep_add(o[e], o[e], _p[i]);
+						} else {
+							ep_sub(o[e], o[e], _p[i]);
+						}
+					} else {
+						mark[e] = round;
+						fp_sub(den[cnt], _p[i]->x, b[e]->x);
+						s[cnt++] = i;
+						if (cnt == EP_BUCKET_BATCH) {
+							ep_bucket_add(b, (const ep_t *)_p, d, s, den, cnt);
+							cnt = 0;
+							round++;
+						}
+					}
+				}
+				if (cnt > 0) {
+					ep_bucket_add(b, (const ep_t *)_p, d, s, den, cnt);
+					round++;
+				}
+				defer = (2 * nxt <= len);
+				len = nxt;
+			}
+
+			/* Compute sum_e (e + 1) * bucket_e with a running sum. */
+			ep_set_infty(t);
+			ep_set_infty(sum[j]);
+			for (e = nb - 1; e >= 0; e--) {
+				if (!ep_is_infty(b[e])) {
+					ep_add(t, t, b[e]);
+					ep_set_infty(b[e]);
+				}
+				if (!ep_is_infty(o[e])) {
+					ep_add(t, t, o[e]);
+					ep_set_infty(o[e]);
+				}
+				ep_add(sum[j], sum[j], t);
+			}
+		}
+
+		ep_set_infty(t);
+		for (j = w - 1; j >= 0; j--) {
+			for (i = 0; i < c; i++) {
+				ep_dbl(t, t);
+			}
+			ep_add(t, t, sum[j]);
+		}
+		ep_norm(r, t);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		if (_p != NULL) {
+			for (i = 0; i < n; i++) {
+				ep_free(_p[i]);
+			}
+		}
+		if (b != NULL) {
+			for (i = 0; i < nb; i++) {
+				ep_free(b[i]);
+			}
+		}
+		if (o != NULL) {
+			for (i = 0; i < nb; i++) {
+				ep_free(o[i]);
+			}
+		}
+		if (sum != NULL) {
+			for (i = 0; i < w; i++) {
+				ep_free(sum[i]);
+			}
+		}
+		for (i = 0; i < EP_BUCKET_BATCH; i++) {
+			fp_free(den[i]);
+		}
+		ep_free(t);
+		free(_p);
+		free(id);
+		free(d);
+		free(q);
+		free(carry);
+		free(b);
+		free(o);
+		free(mark);
+		free(sum);
+	}
+}
+
 void ep_mul_sim_lot(ep_t r, const ep_t p[], const bn_t k[], int n) {
 	int flag = 0;
 
@@ -1030,6 +1350,11 @@ void ep_mul_sim_lot(ep_t r, const ep_t p[], const bn_t k[], int n) {
 		return;
 	}
 
+	if (n >= RLC_EP_BUCKET) {
+		ep_mul_sim_bucket(r, p, k, n);
+		return;
+	}
+
 #if defined(EP_ENDOM)
 	if (ep_curve_is_endom()) {
 		ep_mul_sim_lot_endom(r, p, k, n);
@@ -356,6 +356,8 @@ static void ep13_add_projc_imp(ep13_t r, ep13_t p, ep13_t q) {
 #if EP_ADD == BASIC || !defined(STRIP)
 
 void ep13_add_basic(ep13_t r, ep13_t p, ep13_t q) {
+	RLC_OPCNT(OP_EP13_ADD);
+
 	if (ep13_is_infty(p)) {
 		ep13_copy(r, q);
 		return;
@@ -388,6 +390,8 @@ void ep13_add_slp_basic(ep13_t r, fp13_t s, ep13_t p, ep13_t q) {
 #if EP_ADD == PROJC || !defined(STRIP)
 
 void ep13_add_projc(ep13_t r, ep13_t p, ep13_t q) {
+	RLC_OPCNT(OP_EP13_ADD);
+
 	if (ep13_is_infty(p)) {
 		ep13_copy(r, q);
 		return;
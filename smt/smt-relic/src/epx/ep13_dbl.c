@@ -240,6 +240,8 @@ static void ep13_dbl_projc_imp(ep13_t r, ep13_t p) {
 #if EP_ADD == BASIC || !defined(STRIP)
 
 void ep13_dbl_basic(ep13_t r, ep13_t p) {
+	RLC_OPCNT(OP_EP13_DBL);
+
 	if (ep13_is_infty(p)) {
 		ep13_set_infty(r);
 		return;
@@ -262,6 +264,8 @@ void ep13_dbl_slp_basic(ep13_t r, fp13_t s, ep13_t p) {
 #if EP_ADD == PROJC || !defined(STRIP)
 
 void ep13_dbl_projc(ep13_t r, ep13_t p) {
+	RLC_OPCNT(OP_EP13_DBL);
+
 	if (ep13_is_infty(p)) {
 		ep13_set_infty(r);
 		return;
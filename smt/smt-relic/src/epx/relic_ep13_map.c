@@ -1,8 +1,6 @@
-#include <stdio.h>
-#include "relic.h"
 /*
  * RELIC is an Efficient LIbrary for Cryptography
- * Copyright (c) 2012 RELIC Authors
+ * Copyright (c) 2014 RELIC Authors
  *
  * This file is part of RELIC. RELIC is legal property of its developers,
  * whose names are not listed here. Please refer to the COPYRIGHT file
@@ -31,149 +29,229 @@
  *
  * @ingroup epx
  */
+
+#include "relic_core.h"
+#include "relic_md.h"
+
 /*============================================================================*/
 /* Private definitions                                                        */
 /*============================================================================*/
-static void ep13_sw_bw(ep13_t p, const fp_t t) {
-	fp_t u0,  srm3;
-    fp13_t t0, t1, t2, t3, t4, t5;
-	int a1, a2, a3;
-     fp_null(u0);
-	 fp_null(srm3);
-     fp13_null(t0);
-     fp13_null(t1);
-	 fp13_null(t2);
-     fp13_null(t3);
-	
-  
-     RLC_TRY {
- 		 fp_new(u0);
-	 	 fp_new(srm3);
-         fp13_new(t0);
-         fp13_new(t1);
-         fp13_new(t2);
-		 fp13_new(t3);
-
-		 fp13_zero(t0);
-		 fp_copy(t0[1], t);
-         fp13_sqr(t3, t0);
-         fp_add(t3[0], t3[0], ep_curve_get_b());
-         fp_add_dig(t3[0], t3[0], 1);
-		 fp13_inv(t3, t3);
-		 fp_copy(srm3, core_get()->sr3);
-         fp_sub_dig(u0, srm3, 1);
-         fp_hlv(u0, u0);//j
-
-		 fp13_mul(t3, t3, t0);
-         for(int i=0; i<13; i++)fp_mul(t3[i], t3[i], srm3);//w
-		 fp13_mul(t1, t0, t3);
-		 fp13_neg(t1, t1);
-		 fp_add(t1[0], t1[0], u0);
-		 fp13_neg(t2, t1);
-		 fp_sub_dig(t2[0], t2[0], 1);
-		 fp13_sqr(t3, t3);
-		 fp13_inv(t3, t3);
-		 fp_add_dig(t3[0], t3[0], 1);
-		 fp13_sqr(t0, t1);
-		 fp13_mul(t0, t0, t1);
-		 fp_add(t0[0], t0[0], ep_curve_get_b());
-
-		 fp13_sqr(t4, t2);
-		 fp13_mul(t4, t4, t2);
-		 fp_add(t4[0], t4[0], ep_curve_get_b());
-        
-		
-		fp_rand(u0);
-		 fp_sqr(u0, u0);
-		 for(int i=0; i<13; i++)fp_mul(t5[i], t0[i], u0);
-		 a1=fp13_is_square(t0);
-		fp_rand(u0);
-		 fp_sqr(u0, u0);
-		 for(int i=0; i<13; i++)fp_mul(t5[i], t4[i], u0);
-		 a2=fp13_is_square(t4);
-		 a3=(a1-1)*a2;
-		 a3= a3 % 3;
-		 if(a3 < 0)a3 = a3 + 3;
-		 a3=a3 +1;
-		 switch(a3){
-			 case 1:
-			 	fp13_copy(p->x, t1);
-			 	fp13_srt(p->y, t0);
-				fp_rand(u0);
-		 		fp_sqr(u0, u0);
-				 fp_mul(u0, u0, t);
-				 if(!fp_srt(u0, u0))fp13_neg(p->y, p->y);
-				fp13_zero(p->z);
-          		fp_set_dig(p->z[0], 1);
-                break;
-			case 2:
-			 	fp13_copy(p->x, t2);
-			 	fp13_srt(p->y, t4);
-				 fp_sqr(u0, u0);
-				 fp_mul(u0, u0, t);
-				 if(!fp_srt(u0, u0))fp13_neg(p->y, p->y);
-				fp13_zero(p->z);
-          		fp_set_dig(p->z[0], 1);
-				break;
-			case 3:
-				fp13_copy(p->x, t3);
-			    fp13_sqr(t0, t3);
-		        fp13_mul(t3, t0, t3);
-		        fp_add(t3[0], t3[0], ep_curve_get_b());
-			 	fp13_srt(p->y, t3);
-				 fp_sqr(u0, u0);
-				 fp_mul(u0, u0, t);
-				 if(!fp_srt(u0, u0))fp13_neg(p->y, p->y);
-				fp13_zero(p->z);
-          		fp_set_dig(p->z[0], 1); 
-				break;
-
-		 }
-     }
-     RLC_CATCH_ANY {
-         RLC_THROW(ERR_CAUGHT);
-     }
-     RLC_FINALLY {
-     	fp_free(u0);
-		fp_free(srm3);
-     	fp13_free(t0);
-     	fp13_free(t1);
-	 	fp13_free(t2);
-     	fp13_free(t3);
-     }
- }
-  
+
+/**
+ * Conditionally copies a 13-th extension field element in constant time.
+ */
+#define EP13_MAP_COPY_COND(O, I, C)											\
+	do {																	\
+		for (int _j = 0; _j < 13; _j++) {									\
+			dv_copy_cond(O[_j], I[_j], RLC_FP_DIGS, C);						\
+		}																	\
+	} while (0)
+
+/**
+ * Computes the sign of a 13-th extension field element as the parity of its
+ * first non-zero coefficient, in constant time.
+ *
+ * @param[in] a				- the 13-th extension field element.
+ * @param[in] k				- an auxiliary integer, which is overwritten.
+ * @return the sign of the element.
+ */
+static int ep13_sgn0(fp13_t a, bn_t k) {
+	int s = 0, z = 1;
+
+	for (int i = 0; i < 13; i++) {
+		fp_prime_back(k, a[i]);
+		s |= z & bn_get_bit(k, 0);
+		z &= fp_is_zero(a[i]);
+	}
+	return s;
+}
+
+/**
+ * Maps an element of the 13-th extension to a point in the curve using the
+ * Shallue-van de Woestijne encoding in the form of Fouque and Tibouchi. Each of
+ * the three candidates is kept as a fraction x = n/d, so no inversions are
+ * needed. The point is returned in Jacobian coordinates (nd, ds, d) with
+ * s^2 = d(n^3 + bd^3), and the candidate is chosen in constant time. The sign
+ * of s follows the sign of u, so that the map is odd. Exceptional inputs are
+ * mapped to the point at infinity.
+ *
+ * @param[out] p			- the result.
+ * @param[in] u				- the element to map.
+ */
+static void ep13_map_sw(ep13_t p, fp13_t u) {
+	fp13_t t, d, e, n, g, h;
+	fp_t c;
+	bn_t k;
+	int b1, b2;
+
+	fp13_null(t);
+	fp13_null(d);
+	fp13_null(e);
+	fp13_null(n);
+	fp13_null(g);
+	fp13_null(h);
+	fp_null(c);
+	bn_null(k);
+
+	RLC_TRY {
+		fp13_new(t);
+		fp13_new(d);
+		fp13_new(e);
+		fp13_new(n);
+		fp13_new(g);
+		fp13_new(h);
+		fp_new(c);
+		bn_new(k);
+
+		/* d = 1 + b + u^2, t = sqrt(-3) * u^2 and c = (sqrt(-3) - 1)/2. */
+		fp13_sqr(e, u);
+		for (int i = 0; i < 13; i++) {
+			fp_mul(t[i], e[i], core_get()->sr3);
+		}
+		fp13_copy(d, e);
+		fp_add(d[0], d[0], ep_curve_get_b());
+		fp_add_dig(d[0], d[0], 1);
+		fp_sub_dig(c, core_get()->sr3, 1);
+		fp_hlv(c, c);
+
+		/* Third candidate x3 = (3u^2 - d^2)/(3u^2), kept in (n, e, g). */
+		fp13_dbl(n, e);
+		fp13_add(e, n, e);
+		fp13_sqr(n, d);
+		fp13_sub(n, e, n);
+		fp13_sqr(g, e);
+		fp13_mul(g, g, e);
+		for (int i = 0; i < 13; i++) {
+			fp_mul(g[i], g[i], ep_curve_get_b());
+		}
+		fp13_sqr(h, n);
+		fp13_mul(h, h, n);
+		fp13_add(g, g, h);
+		fp13_mul(g, g, e);
+
+		/* First candidate x1 = (cd - t)/d, kept in (u', d, t). */
+		fp13_sqr(h, d);
+		fp13_mul(h, h, d);
+		for (int i = 0; i < 13; i++) {
+			fp_mul(h[i], h[i], ep_curve_get_b());
+			fp_mul(p->x[i], d[i], c);
+		}
+		fp13_sub(p->x, p->x, t);
+		/* Second candidate x2 = -1 - x1 = (-d - (cd - t))/d. */
+		fp13_add(p->y, p->x, d);
+		fp13_neg(p->y, p->y);
+
+		fp13_sqr(t, p->y);
+		fp13_mul(t, t, p->y);
+		fp13_add(t, t, h);
+		fp13_mul(t, t, d);
+		b2 = (fp13_is_square(t) == 1);
+		EP13_MAP_COPY_COND(n, p->y, b2);
+		EP13_MAP_COPY_COND(e, d, b2);
+		EP13_MAP_COPY_COND(g, t, b2);
+
+		fp13_sqr(t, p->x);
+		fp13_mul(t, t, p->x);
+		fp13_add(t, t, h);
+		fp13_mul(t, t, d);
+		b1 = (fp13_is_square(t) == 1);
+		EP13_MAP_COPY_COND(n, p->x, b1);
+		EP13_MAP_COPY_COND(e, d, b1);
+		EP13_MAP_COPY_COND(g, t, b1);
+
+		/* Extract the square root with the same sign as u. */
+		fp13_srt(g, g);
+		fp13_neg(t, g);
+		b1 = ep13_sgn0(u, k) ^ ep13_sgn0(g, k);
+		EP13_MAP_COPY_COND(g, t, b1);
+
+		fp13_mul(p->x, n, e);
+		fp13_mul(p->y, g, e);
+		fp13_copy(p->z, e);
+		p->coord = PROJC;
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp13_free(t);
+		fp13_free(d);
+		fp13_free(e);
+		fp13_free(n);
+		fp13_free(g);
+		fp13_free(h);
+		fp_free(c);
+		bn_free(k);
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
- void ep13_map(ep13_t p, const uint8_t *msg, int len) {
-     bn_t k, pm1o2;
-     fp_t t;
-     uint8_t digest[RLC_MD_LEN];
-     bn_null(k);
-     bn_null(pm1o2);
-     fp_null(t);
-  
-     RLC_TRY {
-         bn_new(k);
-         bn_new(pm1o2);
-         fp_new(t);
-         pm1o2->sign = RLC_POS;
-         pm1o2->used = RLC_FP_DIGS;
-         dv_copy(pm1o2->dp, fp_prime_get(), RLC_FP_DIGS);
-         bn_hlv(pm1o2, pm1o2);
-         md_map(digest, msg, len);
-         bn_read_bin(k, digest, RLC_MIN(RLC_FP_BYTES, RLC_MD_LEN));
-         fp_prime_conv(t, k);
-         ep13_sw_bw(p, t);
-		 //ep13_cof(p, p);
-     }
-     RLC_CATCH_ANY {
-         RLC_THROW(ERR_CAUGHT);
-     }
-     RLC_FINALLY {
-         bn_free(k);
-         bn_free(pm1o2);
-         fp_free(t);
-     }
- }
\ No newline at end of file
+
+void ep13_map_from_field(ep13_t p, const uint8_t *uniform_bytes, int len) {
+	bn_t k;
+	fp13_t u;
+	ep13_t q;
+	/* Enough space for two extension field elements plus extra bytes. */
+	const int len_per_elm = (FP_PRIME + ep_param_level() + 7) / 8;
+
+	bn_null(k);
+	fp13_null(u);
+	ep13_null(q);
+
+	RLC_TRY {
+		if (len != 26 * len_per_elm) {
+			RLC_THROW(ERR_NO_VALID);
+		}
+
+		bn_new(k);
+		fp13_new(u);
+		ep13_new(q);
+
+		for (int i = 0; i < 13; i++) {
+			bn_read_bin(k, uniform_bytes + i * len_per_elm, len_per_elm);
+			fp_prime_conv(u[i], k);
+		}
+		ep13_map_sw(p, u);
+		for (int i = 0; i < 13; i++) {
+			bn_read_bin(k, uniform_bytes + (13 + i) * len_per_elm,
+					len_per_elm);
+			fp_prime_conv(u[i], k);
+		}
+		ep13_map_sw(q, u);
+
+		ep13_add(p, p, q);
+		ep13_cof(p, p);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(k);
+		fp13_free(u);
+		ep13_free(q);
+	}
+}
+
+void ep13_map_dst(ep13_t p, const uint8_t *msg, int len, const uint8_t *dst,
+		int dst_len) {
+	/* Enough space for two extension field elements plus extra bytes. */
+	const int len_per_elm = (FP_PRIME + ep_param_level() + 7) / 8;
+	uint8_t *pseudo_random_bytes = RLC_ALLOCA(uint8_t, 26 * len_per_elm);
+
+	RLC_TRY {
+		md_xmd(pseudo_random_bytes, 26 * len_per_elm, msg, len, dst, dst_len);
+		ep13_map_from_field(p, pseudo_random_bytes, 26 * len_per_elm);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		RLC_FREE(pseudo_random_bytes);
+	}
+}
+
+void ep13_map(ep13_t p, const uint8_t *msg, int len) {
+	ep13_map_dst(p, msg, len, (const uint8_t *)"RELIC", 5);
+}
@@ -40,61 +40,108 @@
 
 #if defined(EP_ENDOM)
 
-static void ep13_mul_glv_imp(ep13_t r, ep13_t p, bn_t k) {
-	int i, j, l, _l[24];
-	bn_t n, _k[24], u;
-	int8_t naf[24][RLC_FP_BITS + 1];
-	ep13_t q[24];
+/**
+ * Multiplies a G2 point by an integer using the 24-dimensional decomposition
+ * induced by psi. The scalar is written in base u = -x with non-negative
+ * digits, which are then balanced to signed digits of absolute value at most
+ * u/2 by propagating carries, and the point is multiplied by the interleaved
+ * w-NAF forms of the signed digits.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the point to multiply.
+ * @param[in] k				- the integer.
+ */
+static void ep13_mul_glv_imp(ep13_t r, ep13_t p, const bn_t k) {
+	int i, j, l, s, neg = 0, w = 1 << (EP_WIDTH - 2);
+	int len[RLC_EP13_SUB], sgn[RLC_EP13_SUB];
+	int8_t naf[RLC_EP13_SUB][RLC_DIG + 2];
+	dig_t c, d, h;
+	bn_t _k[RLC_EP13_SUB], n, u, t;
+	ep13_t q[RLC_EP13_SUB << (EP_WIDTH - 2)];
 
 	bn_null(n);
 	bn_null(u);
+	bn_null(t);
 
 	RLC_TRY {
 		bn_new(n);
 		bn_new(u);
-		for (i = 0; i < 24; i++) {
+		bn_new(t);
+		for (i = 0; i < RLC_EP13_SUB; i++) {
 			bn_null(_k[i]);
-			ep13_null(q[i]);
 			bn_new(_k[i]);
+		}
+		for (i = 0; i < (RLC_EP13_SUB << (EP_WIDTH - 2)); i++) {
+			ep13_null(q[i]);
 			ep13_new(q[i]);
 		}
 
 		ep_curve_get_ord(n);
 		fp_prime_get_par(u);
-		bn_neg(u,u);
-		bn_mod(_k[0], k, n);
-		bn_rec_frb(_k, 24, _k[0], u, n, ep_curve_is_pairf() == EP_BW13);
-		for (i = 0; i < 24; i++)bn_print(_k[i]);
-
-		ep13_norm(q[0], p);
-		for (i = 1; i < 24; i++)ep13_psi(q[i], q[i-1], 1);
+		bn_neg(u, u);
+		bn_mod(t, k, n);
+
+		/* Either t or n - t is smaller than u^24 since n < 2u^24. */
+		bn_sqr(_k[0], u);
+		bn_mul(_k[0], _k[0], u);
+		bn_sqr(_k[0], _k[0]);
+		bn_sqr(_k[0], _k[0]);
+		bn_sqr(_k[0], _k[0]);
+		if (bn_cmp(t, _k[0]) != RLC_LT) {
+			bn_sub(t, n, t);
+			neg = 1;
+		}
+		bn_rec_frb(_k, RLC_EP13_SUB, t, u, n, 0);
 
+		/* Balance the digits to the range [-u/2, u/2], except the last. */
+		bn_get_dig(&h, u);
+		c = 0;
 		l = 0;
-		for (i = 0; i < 24; i++) {
-			if (bn_sign(_k[i]) == RLC_NEG) {
-				ep13_neg(q[i], q[i]);
+		for (i = 0; i < RLC_EP13_SUB; i++) {
+			bn_get_dig(&d, _k[i]);
+			d += c;
+			c = (i < RLC_EP13_SUB - 1 && d > (h >> 1));
+			sgn[i] = c;
+			bn_set_dig(_k[i], c ? h - d : d);
+			len[i] = 0;
+			if (!bn_is_zero(_k[i])) {
+				len[i] = RLC_DIG + 2;
+				bn_rec_naf(naf[i], &len[i], _k[i], EP_WIDTH);
+			}
+			l = RLC_MAX(l, len[i]);
+		}
+
+		/* Compute the odd multiples of P and their images under psi. */
+		ep13_norm(r, p);
+		ep13_tab(q, r, EP_WIDTH);
+		for (i = 1; i < RLC_EP13_SUB; i++) {
+			for (j = 0; j < w; j++) {
+				ep13_psi(q[i * w + j], q[(i - 1) * w + j], 1);
 			}
-			_l[i] = RLC_FP_BITS + 1;
-			bn_rec_naf(naf[i], &_l[i], _k[i], 2);
-			l = RLC_MAX(l, _l[i]);
 		}
 
 		ep13_set_infty(r);
 		for (j = l - 1; j >= 0; j--) {
 			ep13_dbl(r, r);
-
-			for (i = 0; i < 24; i++) {
-				if (naf[i][j] > 0) {
-					ep13_add(r, r, q[i]);
+			for (i = 0; i < RLC_EP13_SUB; i++) {
+				s = (j < len[i] ? naf[i][j] : 0);
+				if (sgn[i]) {
+					s = -s;
 				}
-				if (naf[i][j] < 0) {
-					ep13_sub(r, r, q[i]);
+				if (s > 0) {
+					ep13_add(r, r, q[i * w + s / 2]);
+				}
+				if (s < 0) {
+					ep13_sub(r, r, q[i * w - s / 2]);
 				}
 			}
 		}
 
 		/* Convert r to affine coordinates. */
 		ep13_norm(r, r);
+		if (neg) {
+			ep13_neg(r, r);
+		}
 	}
 	RLC_CATCH_ANY {
 		RLC_THROW(ERR_CAUGHT);
@@ -102,11 +149,13 @@ static void ep13_mul_glv_imp(ep13_t r, ep13_t p, bn_t k) {
 	RLC_FINALLY {
 		bn_free(n);
 		bn_free(u);
-		for (i = 0; i < 24; i++) {
+		bn_free(t);
+		for (i = 0; i < RLC_EP13_SUB; i++) {
 			bn_free(_k[i]);
+		}
+		for (i = 0; i < (RLC_EP13_SUB << (EP_WIDTH - 2)); i++) {
 			ep13_free(q[i]);
 		}
-
 	}
 }
 
@@ -302,27 +351,78 @@ void ep13_mul_lwnaf(ep13_t r, ep13_t p, const bn_t k) {
 }
 
 #endif
-void  ep13_rand_mul_u(ep13_t r, ep13_t q) {
-		RLC_TRY {
-		 ep13_dbl(r,q);
-		 ep13_dbl(r,r);
-		 ep13_dbl(r,r);
-		 ep13_dbl(r,r);
-		 ep13_add(r,r,q);
-		 ep13_dbl(r,r);
-		 ep13_dbl(r,r);
-		 ep13_add(r,r,q);
- 		 ep13_dbl(r,r);
-		 ep13_add(r,r,q);
-		 ep13_dbl(r,r);
-		 ep13_dbl(r,r);
-		 ep13_dbl(r,r);
-		 ep13_dbl(r,r);
-		 ep13_neg(r, r);
-		
+
+void ep13_mul_sps(ep13_t r, ep13_t p, const int *b, int len, int sign) {
+	ep13_t t, u, v;
+	int i, j, k;
+
+	if (len == 0 || ep13_is_infty(p)) {
+		ep13_set_infty(r);
+		return;
+	}
+
+	ep13_null(t);
+	ep13_null(u);
+	ep13_null(v);
+
+	RLC_TRY {
+		ep13_new(t);
+		ep13_new(u);
+		ep13_new(v);
+
+		/* Inversion in the extension goes through the norm to the prime
+		 * field, so normalizing the base costs less than the savings of
+		 * mixed additions for the curve parameter. */
+		ep13_norm(t, p);
+		ep13_neg(u, t);
+
+		/* Process the sparse digits from the most significant one. */
+		ep13_copy(v, (b[len - 1] < 0 ? u : t));
+		for (i = len - 2; i >= 0; i--) {
+			k = (b[i + 1] < 0 ? -b[i + 1] : b[i + 1]);
+			k -= (b[i] < 0 ? -b[i] : b[i]);
+			for (j = 0; j < k; j++) {
+				ep13_dbl(v, v);
+			}
+			ep13_add(v, v, (b[i] < 0 ? u : t));
+		}
+		for (j = 0; j < (b[0] < 0 ? -b[0] : b[0]); j++) {
+			ep13_dbl(v, v);
+		}
+
+		if (sign == RLC_NEG) {
+			ep13_neg(r, v);
+		} else {
+			ep13_copy(r, v);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		ep13_free(t);
+		ep13_free(u);
+		ep13_free(v);
+	}
+}
+
+void ep13_rand_mul_u(ep13_t r, ep13_t q) {
+	bn_t z;
+	const int *b;
+	int l;
+
+	bn_null(z);
+
+	RLC_TRY {
+		bn_new(z);
+
+		fp_prime_get_par(z);
+		b = fp_prime_get_par_sps(&l);
+		ep13_mul_sps(r, q, b, l, bn_sign(z));
 	} RLC_CATCH_ANY {
 		RLC_THROW(ERR_CAUGHT);
 	} RLC_FINALLY {
+		bn_free(z);
 	}
 }
 
@@ -336,10 +436,7 @@ void  ep13_cof(ep13_t r, ep13_t p) {
 	  ep13_null(q);
 
 		RLC_TRY {
-		fp13_frb(q->x, p->x, 1);
-		fp13_frb(q->y, p->y, 1);
-		fp13_zero(q->z);
-		fp_set_dig(q->z[0], 1);
+		ep13_frb(q, p, 1);
 		ep13_sub(q, q, p);
 
 		ep13_dbl(R[14], q);
@@ -0,0 +1,287 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (c) 2012 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+
+/**
+ * @file
+ *
+ * Implementation of fixed point multiplication on a prime elliptic curve over
+ * a 13-th extension.
+ *
+ * @ingroup epx
+ */
+
+#include "relic_core.h"
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Recodes a scalar in RLC_EP13_SUB non-negative subscalars such that
+ * k = sum k_i u^i mod n, where u = -x is the eigenvalue of psi on G2. Since
+ * the group order is smaller than 2u^24, either k or n - k is smaller than
+ * u^24 and has such a decomposition, and the second case negates the result.
+ *
+ * @param[out] ki			- the recoded subscalars.
+ * @param[in] k				- the integer.
+ * @return 1 if the result must be negated, 0 otherwise.
+ */
+static int ep13_rec_psi(bn_t *ki, const bn_t k) {
+	int neg = 0;
+	bn_t n, u, t;
+
+	bn_null(n);
+	bn_null(u);
+	bn_null(t);
+
+	RLC_TRY {
+		bn_new(n);
+		bn_new(u);
+		bn_new(t);
+
+		ep_curve_get_ord(n);
+		fp_prime_get_par(u);
+		bn_neg(u, u);
+		bn_mod(t, k, n);
+
+		/* Compute u^24 to check if the decomposition covers t. */
+		bn_sqr(ki[0], u);
+		bn_mul(ki[0], ki[0], u);
+		bn_sqr(ki[0], ki[0]);
+		bn_sqr(ki[0], ki[0]);
+		bn_sqr(ki[0], ki[0]);
+		if (bn_cmp(t, ki[0]) != RLC_LT) {
+			bn_sub(t, n, t);
+			neg = 1;
+		}
+		bn_rec_frb(ki, RLC_EP13_SUB, t, u, n, 0);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(n);
+		bn_free(u);
+		bn_free(t);
+	}
+	return neg;
+}
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+#if EP_FIX == COMBS || EP_FIX == BASIC || EP_FIX == COMBD || !defined(STRIP)
+
+void ep13_mul_pre_combs(ep13_t *t, ep13_t p) {
+	int i, j, l, m;
+	ep13_t q, *s;
+
+	if (ep13_is_infty(p)) {
+		for (i = 0; i < RLC_EP13_TABLE_COMBS; i++) {
+			ep13_set_infty(t[i]);
+		}
+		return;
+	}
+
+	ep13_null(q);
+
+	RLC_TRY {
+		ep13_new(q);
+
+		ep13_norm(q, p);
+		/* Each group of EP_DEPTH teeth holds the sums of psi^i(P). */
+		for (s = t; s < t + RLC_EP13_TABLE_COMBS; s += (1 << EP_DEPTH)) {
+			ep13_set_infty(s[0]);
+			m = RLC_MIN(EP_DEPTH, RLC_EP13_SUB - (s - t) / (1 << EP_DEPTH) *
+					EP_DEPTH);
+			for (j = 0; j < m; j++) {
+				if (s != t || j > 0) {
+					ep13_psi(q, q, 1);
+				}
+				ep13_copy(s[1 << j], q);
+				for (l = 1; l < (1 << j); l++) {
+					ep13_add(s[(1 << j) + l], s[l], q);
+				}
+			}
+#if defined(EP_MIXED)
+			ep13_norm_sim(s + 1, s + 1, (1 << m) - 1);
+#endif
+			/* The last group may be incomplete, fill it for consistency. */
+			for (i = (1 << m); i < (1 << EP_DEPTH); i++) {
+				ep13_copy(s[i], s[i & ((1 << m) - 1)]);
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		ep13_free(q);
+	}
+}
+
+void ep13_mul_fix_combs(ep13_t r, ep13_t *t, const bn_t k) {
+	int i, j, l, m, w, neg;
+	dig_t d[RLC_EP13_SUB];
+	bn_t _k[RLC_EP13_SUB];
+
+	if (bn_is_zero(k)) {
+		ep13_set_infty(r);
+		return;
+	}
+
+	RLC_TRY {
+		for (i = 0; i < RLC_EP13_SUB; i++) {
+			bn_null(_k[i]);
+			bn_new(_k[i]);
+		}
+
+		neg = ep13_rec_psi(_k, k);
+		l = 0;
+		for (i = 0; i < RLC_EP13_SUB; i++) {
+			bn_get_dig(&d[i], _k[i]);
+			l = RLC_MAX(l, util_bits_dig(d[i]));
+		}
+
+		ep13_set_infty(r);
+		for (j = l - 1; j >= 0; j--) {
+			ep13_dbl(r, r);
+			for (i = 0; i < RLC_EP13_SUB; i += EP_DEPTH) {
+				w = 0;
+				for (m = RLC_MIN(EP_DEPTH, RLC_EP13_SUB - i) - 1; m >= 0; m--) {
+					w = (w << 1) | ((d[i + m] >> j) & 1);
+				}
+				if (w > 0) {
+					ep13_add(r, r, t[(i / EP_DEPTH << EP_DEPTH) + w]);
+				}
+			}
+		}
+		ep13_norm(r, r);
+		if (neg) {
+			ep13_neg(r, r);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		for (i = 0; i < RLC_EP13_SUB; i++) {
+			bn_free(_k[i]);
+		}
+	}
+}
+
+#endif
+
+#if EP_FIX == LWNAF || EP_FIX == GLV || !defined(STRIP)
+
+void ep13_mul_pre_lwnaf(ep13_t *t, ep13_t p) {
+	int i, j, w = 1 << (EP_DEPTH - 2);
+	ep13_t q;
+
+	if (ep13_is_infty(p)) {
+		for (i = 0; i < RLC_EP13_TABLE_LWNAF; i++) {
+			ep13_set_infty(t[i]);
+		}
+		return;
+	}
+
+	ep13_null(q);
+
+	RLC_TRY {
+		ep13_new(q);
+
+		ep13_norm(q, p);
+		ep13_tab(t, q, EP_DEPTH);
+		for (i = 1; i < RLC_EP13_SUB; i++) {
+			for (j = 0; j < w; j++) {
+				ep13_psi(t[i * w + j], t[(i - 1) * w + j], 1);
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		ep13_free(q);
+	}
+}
+
+void ep13_mul_fix_lwnaf(ep13_t r, ep13_t *t, const bn_t k) {
+	int i, j, l, n, neg, len[RLC_EP13_SUB];
+	int8_t naf[RLC_EP13_SUB][RLC_DIG + 1];
+	bn_t _k[RLC_EP13_SUB];
+
+	if (bn_is_zero(k)) {
+		ep13_set_infty(r);
+		return;
+	}
+
+	RLC_TRY {
+		for (i = 0; i < RLC_EP13_SUB; i++) {
+			bn_null(_k[i]);
+			bn_new(_k[i]);
+		}
+
+		neg = ep13_rec_psi(_k, k);
+		l = 0;
+		for (i = 0; i < RLC_EP13_SUB; i++) {
+			len[i] = 0;
+			if (!bn_is_zero(_k[i])) {
+				len[i] = RLC_DIG + 1;
+				bn_rec_naf(naf[i], &len[i], _k[i], EP_DEPTH);
+			}
+			l = RLC_MAX(l, len[i]);
+		}
+
+		ep13_set_infty(r);
+		for (j = l - 1; j >= 0; j--) {
+			ep13_dbl(r, r);
+			for (i = 0; i < RLC_EP13_SUB; i++) {
+				n = (j < len[i] ? naf[i][j] : 0);
+				if (n > 0) {
+					ep13_add(r, r, t[(i << (EP_DEPTH - 2)) + n / 2]);
+				}
+				if (n < 0) {
+					ep13_sub(r, r, t[(i << (EP_DEPTH - 2)) - n / 2]);
+				}
+			}
+		}
+		ep13_norm(r, r);
+		if (neg) {
+			ep13_neg(r, r);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		for (i = 0; i < RLC_EP13_SUB; i++) {
+			bn_free(_k[i]);
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,119 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (c) 2014 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of point compression on prime elliptic curves over a 13-th
+ * extension.
+ *
+ * @ingroup epx
+ */
+
+#include "relic_core.h"
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Computes the sign of a 13-th extension field element, defined as the sign
+ * of its last non-zero coefficient, that is, if it is larger than (p - 1)/2.
+ *
+ * @param[in] a				- the 13-th extension field element.
+ * @return the sign of the element.
+ */
+static int ep13_sgn(fp13_t a) {
+	bn_t h, t;
+	int i, r = 0;
+
+	bn_null(h);
+	bn_null(t);
+
+	RLC_TRY {
+		bn_new(h);
+		bn_new(t);
+
+		h->used = RLC_FP_DIGS;
+		dv_copy(h->dp, fp_prime_get(), RLC_FP_DIGS);
+		bn_trim(h);
+		bn_hlv(h, h);
+
+		for (i = 12; i > 0 && fp_is_zero(a[i]); i--);
+		fp_prime_back(t, a[i]);
+		r = (bn_cmp(t, h) == RLC_GT);
+	} RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	} RLC_FINALLY {
+		bn_free(h);
+		bn_free(t);
+	}
+	return r;
+}
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+void ep13_pck(ep13_t r, ep13_t p) {
+	int b = ep13_sgn(p->y);
+
+	fp13_copy(r->x, p->x);
+	fp13_zero(r->y);
+	fp_set_bit(r->y[0], 0, b);
+	fp13_set_dig(r->z, 1);
+	r->coord = BASIC;
+}
+
+int ep13_upk(ep13_t r, ep13_t p) {
+	fp13_t t;
+	int result = 0;
+
+	fp13_null(t);
+
+	RLC_TRY {
+		fp13_new(t);
+
+		ep13_rhs(t, p);
+
+		/* t = sqrt(x^3 + b), with the sign given by the compressed bit. */
+		result = fp13_srt(t, t);
+
+		if (result) {
+			if (ep13_sgn(t) != fp_get_bit(p->y[0], 0)) {
+				fp13_neg(t, t);
+			}
+			fp13_copy(r->x, p->x);
+			fp13_copy(r->y, t);
+			fp13_set_dig(r->z, 1);
+			r->coord = BASIC;
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp13_free(t);
+	}
+	return result;
+}
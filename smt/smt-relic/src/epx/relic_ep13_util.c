@@ -139,6 +139,112 @@ void ep13_tab(ep13_t *t, ep13_t p, int w) {
 	ep13_copy(t[0], p);
 }
 
+int ep13_size_bin(ep13_t a, int pack) {
+	if (ep13_is_infty(a)) {
+		return 1;
+	}
+	if (pack) {
+		return 1 + 13 * RLC_FP_BYTES;
+	}
+	return 1 + 26 * RLC_FP_BYTES;
+}
+
+void ep13_read_bin(ep13_t a, const uint8_t *bin, int len) {
+	if (len == 1) {
+		if (bin[0] == 0) {
+			ep13_set_infty(a);
+			return;
+		} else {
+			RLC_THROW(ERR_NO_BUFFER);
+			return;
+		}
+	}
+
+	if (len != (13 * RLC_FP_BYTES + 1) && len != (26 * RLC_FP_BYTES + 1)) {
+		RLC_THROW(ERR_NO_BUFFER);
+		return;
+	}
+
+	a->coord = BASIC;
+	fp13_set_dig(a->z, 1);
+	fp13_read_bin(a->x, bin + 1, 13 * RLC_FP_BYTES);
+	if (len == 13 * RLC_FP_BYTES + 1) {
+		switch (bin[0]) {
+			case 2:
+				fp13_zero(a->y);
+				break;
+			case 3:
+				fp13_zero(a->y);
+				fp_set_bit(a->y[0], 0, 1);
+				break;
+			default:
+				RLC_THROW(ERR_NO_VALID);
+				return;
+		}
+		if (!ep13_upk(a, a)) {
+			RLC_THROW(ERR_NO_VALID);
+			return;
+		}
+	}
+
+	if (len == 26 * RLC_FP_BYTES + 1) {
+		if (bin[0] == 4) {
+			fp13_read_bin(a->y, bin + 13 * RLC_FP_BYTES + 1, 13 * RLC_FP_BYTES);
+		} else {
+			RLC_THROW(ERR_NO_VALID);
+			return;
+		}
+	}
+
+	if (!ep13_on_curve(a)) {
+		RLC_THROW(ERR_NO_VALID);
+	}
+}
+
+void ep13_write_bin(uint8_t *bin, int len, ep13_t a, int pack) {
+	ep13_t t;
+
+	ep13_null(t);
+
+	memset(bin, 0, len);
+
+	if (ep13_is_infty(a)) {
+		if (len < 1) {
+			RLC_THROW(ERR_NO_BUFFER);
+		}
+		return;
+	}
+
+	RLC_TRY {
+		ep13_new(t);
+
+		ep13_norm(t, a);
+
+		if (pack) {
+			if (len < 13 * RLC_FP_BYTES + 1) {
+				RLC_THROW(ERR_NO_BUFFER);
+			} else {
+				ep13_pck(t, t);
+				bin[0] = 2 | fp_get_bit(t->y[0], 0);
+				fp13_write_bin(bin + 1, 13 * RLC_FP_BYTES, t->x, 0);
+			}
+		} else {
+			if (len < 26 * RLC_FP_BYTES + 1) {
+				RLC_THROW(ERR_NO_BUFFER);
+			} else {
+				bin[0] = 4;
+				fp13_write_bin(bin + 1, 13 * RLC_FP_BYTES, t->x, 0);
+				fp13_write_bin(bin + 13 * RLC_FP_BYTES + 1, 13 * RLC_FP_BYTES,
+						t->y, 0);
+			}
+		}
+	} RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	} RLC_FINALLY {
+		ep13_free(t);
+	}
+}
+
 
 
 
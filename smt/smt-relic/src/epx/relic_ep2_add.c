@@ -356,6 +356,8 @@ static void ep2_add_projc_imp(ep2_t r, const ep2_t p, const ep2_t q) {
 #if EP_ADD == BASIC || !defined(STRIP)
 
 void ep2_add_basic(ep2_t r, const ep2_t p, const ep2_t q) {
+	RLC_OPCNT(OP_EP2_ADD);
+
 	if (ep2_is_infty(p)) {
 		ep2_copy(r, q);
 		return;
@@ -388,6 +390,8 @@ void ep2_add_slp_basic(ep2_t r, fp2_t s, const ep2_t p, const ep2_t q) {
 #if EP_ADD == PROJC || !defined(STRIP)
 
 void ep2_add_projc(ep2_t r, const ep2_t p, const ep2_t q) {
+	RLC_OPCNT(OP_EP2_ADD);
+
 	if (ep2_is_infty(p)) {
 		ep2_copy(r, q);
 		return;
@@ -240,6 +240,8 @@ static void ep2_dbl_projc_imp(ep2_t r, const ep2_t p) {
 #if EP_ADD == BASIC || !defined(STRIP)
 
 void ep2_dbl_basic(ep2_t r, const ep2_t p) {
+	RLC_OPCNT(OP_EP2_DBL);
+
 	if (ep2_is_infty(p)) {
 		ep2_set_infty(r);
 		return;
@@ -262,6 +264,8 @@ void ep2_dbl_slp_basic(ep2_t r, fp2_t s, const ep2_t p) {
 #if EP_ADD == PROJC || !defined(STRIP)
 
 void ep2_dbl_projc(ep2_t r, const ep2_t p) {
+	RLC_OPCNT(OP_EP2_DBL);
+
 	if (ep2_is_infty(p)) {
 		ep2_set_infty(r);
 		return;
@@ -428,3 +428,52 @@ void ep2_mul_dig(ep2_t r, const ep2_t p, const dig_t k) {
 		bn_free(_k);
 	}
 }
+
+void ep2_mul_sps(ep2_t r, const ep2_t p, const int *b, int len, int sign) {
+	ep2_t u, v;
+	int i, j, k;
+
+	if (len == 0 || ep2_is_infty(p)) {
+		ep2_set_infty(r);
+		return;
+	}
+
+	ep2_null(u);
+	ep2_null(v);
+
+	RLC_TRY {
+		ep2_new(u);
+		ep2_new(v);
+
+		/* The base is used as given, so additions are mixed whenever it is
+		 * already in affine coordinates. */
+		ep2_neg(u, p);
+
+		/* Process the sparse digits from the most significant one. */
+		ep2_copy(v, (b[len - 1] < 0 ? u : p));
+		for (i = len - 2; i >= 0; i--) {
+			k = (b[i + 1] < 0 ? -b[i + 1] : b[i + 1]);
+			k -= (b[i] < 0 ? -b[i] : b[i]);
+			for (j = 0; j < k; j++) {
+				ep2_dbl(v, v);
+			}
+			ep2_add(v, v, (b[i] < 0 ? u : p));
+		}
+		for (j = 0; j < (b[0] < 0 ? -b[0] : b[0]); j++) {
+			ep2_dbl(v, v);
+		}
+
+		if (sign == RLC_NEG) {
+			ep2_neg(r, v);
+		} else {
+			ep2_copy(r, v);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		ep2_free(u);
+		ep2_free(v);
+	}
+}
@@ -46,6 +46,8 @@
  */
 static void ep2_mul_cof_bn(ep2_t r, const ep2_t p) {
 	bn_t x;
+	const int *b;
+	int l;
 	ep2_t t0, t1, t2;
 
 	ep2_null(t0);
@@ -60,9 +62,10 @@ static void ep2_mul_cof_bn(ep2_t r, const ep2_t p) {
 		bn_new(x);
 
 		fp_prime_get_par(x);
+		b = fp_prime_get_par_sps(&l);
 
 		/* Compute t0 = xP. */
-		ep2_mul_basic(t0, p, x);
+		ep2_mul_sps(t0, p, b, l, bn_sign(x));
 
 		/* Compute t1 = \psi(3xP). */
 		ep2_dbl(t1, t0);
@@ -99,6 +102,8 @@ static void ep2_mul_cof_bn(ep2_t r, const ep2_t p) {
  */
 static void ep2_mul_cof_b12(ep2_t r, const ep2_t p) {
 	bn_t x;
+	const int *b;
+	int l;
 	ep2_t t0, t1, t2, t3;
 
 	ep2_null(t0);
@@ -115,11 +120,12 @@ static void ep2_mul_cof_b12(ep2_t r, const ep2_t p) {
 		bn_new(x);
 
 		fp_prime_get_par(x);
+		b = fp_prime_get_par_sps(&l);
 
 		/* Compute t0 = xP. */
-		ep2_mul_basic(t0, p, x);
+		ep2_mul_sps(t0, p, b, l, bn_sign(x));
 		/* Compute t1 = [x^2]P. */
-		ep2_mul_basic(t1, t0, x);
+		ep2_mul_sps(t1, t0, b, l, bn_sign(x));
 
 		/* t2 = (x^2 - x - 1)P = x^2P - x*P - P. */
 		ep2_sub(t2, t1, t0);
@@ -30,6 +30,8 @@
  * @ingroup epx
  */
 
+#include <stdlib.h>
+
 #include "relic_core.h"
 
 /*============================================================================*/
@@ -251,6 +253,118 @@ static void ep2_mul_sim_plain(ep2_t r, const ep2_t p, const bn_t k, const ep2_t
 
 #endif /* EP_SIM == INTER */
 
+/**
+ * Number of bucket additions that share a simultaneous inversion in the bucket
+ * method.
+ */
+#define EP_BUCKET_BATCH		256
+
+/**
+ * Minimum number of pending points for which the buckets are updated in affine
+ * coordinates, as fewer additions do not pay for an inversion.
+ */
+#define EP_BUCKET_AFFINE	16
+
+/**
+ * Chooses the window size of the bucket method that minimizes the number of
+ * point additions, estimated as (l/c + 1)(n + 2^c) for windows of c bits.
+ *
+ * @param[in] n				- the number of points.
+ * @param[in] l				- the length of the scalars in bits.
+ * @return the window size.
+ */
+static int ep2_bucket_width(int n, int l) {
+	int c, w = 2;
+	ull_t cost, best = 0;
+
+	for (c = 2; c <= 16; c++) {
+		cost = (ull_t)(l / c + 1) * ((ull_t)n + ((ull_t)1 << c));
+		if (c == 2 || cost < best) {
+			best = cost;
+			w = c;
+		}
+	}
+	return w;
+}
+
+/**
+ * Extracts a window of bits from the absolute value of an integer.
+ *
+ * @param[in] k				- the integer.
+ * @param[in] b				- the position of the first bit.
+ * @param[in] c				- the number of bits, at most 16.
+ * @return the window of bits.
+ */
+static int ep2_bucket_bits(const bn_t k, int b, int c) {
+	int i = b >> RLC_DIG_LOG, s = b - (i << RLC_DIG_LOG), f = 0;
+	ull_t w = 0;
+
+	while (f < c && i < k->used) {
+		w |= (ull_t)(k->dp[i] >> s) << f;
+		f += RLC_DIG - s;
+		s = 0;
+		i++;
+	}
+	return (int)(w & (((ull_t)1 << c) - 1));
+}
+
+/**
+ * Adds points in affine coordinates to buckets in affine coordinates, sharing
+ * a single inversion among all the additions. The buckets must be distinct
+ * and different from the points and their negations.
+ *
+ * @param[in,out] b			- the buckets.
+ * @param[in] p				- the points.
+ * @param[in] d				- the signed digits selecting a bucket for each point.
+ * @param[in] s				- the indices of the points to add.
+ * @param[in,out] t			- the differences between the abscissae.
+ * @param[in] m				- the number of additions.
+ */
+static void ep2_bucket_add(ep2_t *b, const ep2_t *p, const int *d, const int *s,
+		fp2_t *t, int m) {
+	int i, j, e;
+	fp2_t l, x, y;
+
+	fp2_null(l);
+	fp2_null(x);
+	fp2_null(y);
+
+	RLC_TRY {
+		fp2_new(l);
+		fp2_new(x);
+		fp2_new(y);
+
+		fp2_inv_sim(t, (const fp2_t *)t, m);
+		for (j = 0; j < m; j++) {
+			i = s[j];
+			e = (d[i] > 0 ? d[i] : -d[i]) - 1;
+			/* Compute the slope with the point negated if the digit is. */
+			if (d[i] > 0) {
+				fp2_sub(l, p[i]->y, b[e]->y);
+			} else {
+				fp2_add(l, p[i]->y, b[e]->y);
+				fp2_neg(l, l);
+			}
+			fp2_mul(l, l, t[j]);
+			fp2_sqr(x, l);
+			fp2_sub(x, x, b[e]->x);
+			fp2_sub(x, x, p[i]->x);
+			fp2_sub(y, b[e]->x, x);
+			fp2_mul(y, y, l);
+			fp2_sub(b[e]->y, y, b[e]->y);
+			fp2_copy(b[e]->x, x);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp2_free(l);
+		fp2_free(x);
+		fp2_free(y);
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -630,16 +744,228 @@ void ep2_mul_sim_dig(ep2_t r, const ep2_t p[], const dig_t k[], int len) {
 	}
 }
 
+void ep2_mul_sim_bucket(ep2_t r, const ep2_t p[], const bn_t k[], int n) {
+	int i, j, e, c, l, m, w, nb, cnt, len, nxt, defer, round = 0;
+	int *id = NULL, *d = NULL, *q = NULL, *mark = NULL, s[EP_BUCKET_BATCH];
+	int8_t *carry = NULL;
+	ep2_t t, *_p = NULL, *b = NULL, *o = NULL, *sum = NULL;
+	fp2_t den[EP_BUCKET_BATCH];
+
+	l = 0;
+	for (i = 0; i < n; i++) {
+		l = RLC_MAX(l, bn_bits(k[i]));
+	}
+	if (n == 0 || l == 0) {
+		ep2_set_infty(r);
+		return;
+	}
+
+	c = ep2_bucket_width(n, l);
+	nb = 1 << (c - 1);
+	w = l / c + 1;
+
+	ep2_null(t);
+	for (i = 0; i < EP_BUCKET_BATCH; i++) {
+		fp2_null(den[i]);
+	}
+
+	RLC_TRY {
+		/* Arrays indexed by point are allocated on the heap, as n is large. */
+		_p = (ep2_t *)calloc(n, sizeof(ep2_t));
+		id = (int *)malloc(n * sizeof(int));
+		d = (int *)malloc(n * sizeof(int));
+		q = (int *)malloc(n * sizeof(int));
+		carry = (int8_t *)calloc(n, sizeof(int8_t));
+		b = (ep2_t *)calloc(nb, sizeof(ep2_t));
+		o = (ep2_t *)calloc(nb, sizeof(ep2_t));
+		mark = (int *)malloc(nb * sizeof(int));
+		sum = (ep2_t *)calloc(w, sizeof(ep2_t));
+		if (_p == NULL || id == NULL || d == NULL || q == NULL ||
+				carry == NULL || b == NULL || o == NULL || mark == NULL ||
+				sum == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < n; i++) {
+			ep2_null(_p[i]);
+			ep2_new(_p[i]);
+		}
+		for (i = 0; i < nb; i++) {
+			ep2_null(b[i]);
+			ep2_null(o[i]);
+			ep2_new(b[i]);
+			ep2_new(o[i]);
+			ep2_set_infty(b[i]);
+			ep2_set_infty(o[i]);
+			mark[i] = -1;
+		}
+		for (i = 0; i < w; i++) {
+			ep2_null(sum[i]);
+			ep2_new(sum[i]);
+		}
+		for (i = 0; i < EP_BUCKET_BATCH; i++) {
+			fp2_new(den[i]);
+		}
+		ep2_new(t);
+
+		/* Keep the nontrivial terms, with the sign of the scalar in the point. */
+		m = 0;
+		for (i = 0; i < n; i++) {
+			if (!bn_is_zero(k[i]) && !ep2_is_infty(p[i])) {
+				ep2_copy(_p[m], p[i]);
+				if (bn_sign(k[i]) == RLC_NEG) {
+					ep2_neg(_p[m], _p[m]);
+				}
+				id[m++] = i;
+			}
+		}
+		/* Convert the points to affine coordinates, a batch at a time. */
+		for (i = 0; i < m; i += EP_BUCKET_BATCH) {
+			cnt = RLC_MIN(EP_BUCKET_BATCH, m - i);
+			for (j = 0; j < cnt && _p[i + j]->coord == BASIC; j++);
+			if (j < cnt) {
+				ep2_norm_sim(_p + i, (const ep2_t *)(_p + i), cnt);
+			}
+		}
+
+		for (j = 0; j < w; j++) {
+			/* Recode window j into signed digits in [-2^(c-1) + 1, 2^(c-1)]. */
+			len = 0;
+			for (i = 0; i < m; i++) {
+				d[i] = ep2_bucket_bits(k[id[i]], j * c, c) + carry[i];
+				carry[i] = (d[i] > nb);
+				if (carry[i]) {
+					d[i] -= 2 * nb;
+				}
+				if (d[i] != 0) {
+					q[len++] = i;
+				}
+			}
+
+			/* Points hitting a bucket already updated in the current batch are
+			 * deferred to the next pass, while that halves the pending ones. */
+			defer = 1;
+			while (len > 0) {
+				cnt = nxt = 0;
+				for (l = 0; l < len; l++) {
+					i = q[l];
+					e = (d[i] > 0 ? d[i] : -d[i]) - 1;
+					if (ep2_is_infty(b[e])) {
+						ep2_copy(b[e], _p[i]);
+						if (d[i] < 0) {
+							ep2_neg(b[e], b[e]);
+						}
+					} else if (mark[e] == round && defer) {
+						q[nxt++] = i;
+					} else if (len < EP_BUCKET_AFFINE || mark[e] == round ||
+							fp2_cmp(b[e]->x, _p[i]->x) == RLC_EQ) {
+						/* Accumulate in projective coordinates when there are
+						 * few points, deferring stalls or the affine addition
+						 * degenerates. */
+						if (d[i] > 0) {
+							ep2_add(o[e], o[e], _p[i]);
+						} else {
+							ep2_sub(o[e], o[e], _p[i]);
+						}
+					} else {
+						mark[e] = round;
+						fp2_sub(den[cnt], _p[i]->x, b[e]->x);
+						s[cnt++] = i;
+						if (cnt == EP_BUCKET_BATCH) {
+							ep2_bucket_add(b, (const ep2_t *)_p, d, s, den, cnt);
+							cnt = 0;
+							round++;
+						}
+					}
+				}
+				if (cnt > 0) {
+					ep2_bucket_add(b, (const ep2_t *)_p, d, s, den, cnt);
+					round++;
+				}
+				defer = (2 * nxt <= len);
+				len = nxt;
+			}
+
+			/* Compute sum_e (e + 1) * bucket_e with a running sum. */
+			ep2_set_infty(t);
+			ep2_set_infty(sum[j]);
+			for (e = nb - 1; e >= 0; e--) {
+				if (!ep2_is_infty(b[e])) {
+					ep2_add(t, t, b[e]);
+					ep2_set_infty(b[e]);
+				}
+				if (!ep2_is_infty(o[e])) {
+					ep2_add(t, t, o[e]);
+					ep2_set_infty(o[e]);
+				}
+				ep2_add(sum[j], sum[j], t);
+			}
+		}
+
+		ep2_set_infty(t);
+		for (j = w - 1; j >= 0; j--) {
+			for (i = 0; i < c; i++) {
+				ep2_dbl(t, t);
+			}
+			ep2_add(t, t, sum[j]);
+		}
+		ep2_norm(r, t);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		if (_p != NULL) {
+			for (i = 0; i < n; i++) {
+				ep2_free(_p[i]);
+			}
+		}
+		if (b != NULL) {
+			for (i = 0; i < nb; i++) {
+				ep2_free(b[i]);
+			}
+		}
+		if (o != NULL) {
+			for (i = 0; i < nb; i++) {
+				ep2_free(o[i]);
+			}
+		}
+		if (sum != NULL) {
+			for (i = 0; i < w; i++) {
+				ep2_free(sum[i]);
+			}
+		}
+		for (i = 0; i < EP_BUCKET_BATCH; i++) {
+			fp2_free(den[i]);
+		}
+		ep2_free(t);
+		free(_p);
+		free(id);
+		free(d);
+		free(q);
+		free(carry);
+		free(b);
+		free(o);
+		free(mark);
+		free(sum);
+	}
+}
+
 void ep2_mul_sim_lot(ep2_t r, const ep2_t p[], const bn_t k[], int n) {
 	const int len = RLC_FP_BITS + 1;
 	int i, j, m, l, _l[4];
 	bn_t _k[4], q, x;
-	int8_t ptr, *naf = RLC_ALLOCA(int8_t, 4 * n * len);
+	int8_t ptr, *naf;
 
 	if (n == 0) {
 		ep2_set_infty(r);
 		return;
 	}
+	if (n >= RLC_EP2_BUCKET) {
+		ep2_mul_sim_bucket(r, p, k, n);
+		return;
+	}
+
+	naf = RLC_ALLOCA(int8_t, 4 * n * len);
 
 	bn_null(q);
 	bn_null(x);
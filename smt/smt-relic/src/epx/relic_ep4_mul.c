@@ -447,3 +447,52 @@ void ep4_mul_dig(ep4_t r, const ep4_t p, const dig_t k) {
 		ep4_free(t);
 	}
 }
+
+void ep4_mul_sps(ep4_t r, const ep4_t p, const int *b, int len, int sign) {
+	ep4_t u, v;
+	int i, j, k;
+
+	if (len == 0 || ep4_is_infty(p)) {
+		ep4_set_infty(r);
+		return;
+	}
+
+	ep4_null(u);
+	ep4_null(v);
+
+	RLC_TRY {
+		ep4_new(u);
+		ep4_new(v);
+
+		/* The base is used as given, so additions are mixed whenever it is
+		 * already in affine coordinates. */
+		ep4_neg(u, p);
+
+		/* Process the sparse digits from the most significant one. */
+		ep4_copy(v, (b[len - 1] < 0 ? u : p));
+		for (i = len - 2; i >= 0; i--) {
+			k = (b[i + 1] < 0 ? -b[i + 1] : b[i + 1]);
+			k -= (b[i] < 0 ? -b[i] : b[i]);
+			for (j = 0; j < k; j++) {
+				ep4_dbl(v, v);
+			}
+			ep4_add(v, v, (b[i] < 0 ? u : p));
+		}
+		for (j = 0; j < (b[0] < 0 ? -b[0] : b[0]); j++) {
+			ep4_dbl(v, v);
+		}
+
+		if (sign == RLC_NEG) {
+			ep4_neg(r, v);
+		} else {
+			ep4_copy(r, v);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		ep4_free(u);
+		ep4_free(v);
+	}
+}
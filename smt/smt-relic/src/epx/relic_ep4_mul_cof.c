@@ -40,6 +40,8 @@
 
 void ep4_mul_cof(ep4_t r, const ep4_t p) {
 	bn_t z;
+	const int *b;
+	int l;
 	ep4_t t0, t1, t2, t3;
 
 	ep4_null(t0);
@@ -55,11 +57,12 @@ void ep4_mul_cof(ep4_t r, const ep4_t p) {
 		ep4_new(t3);
 
 		fp_prime_get_par(z);
+		b = fp_prime_get_par_sps(&l);
 
-		ep4_mul_basic(t0, p, z);
-		ep4_mul_basic(t1, t0, z);
-		ep4_mul_basic(t2, t1, z);
-		ep4_mul_basic(t3, t2, z);
+		ep4_mul_sps(t0, p, b, l, bn_sign(z));
+		ep4_mul_sps(t1, t0, b, l, bn_sign(z));
+		ep4_mul_sps(t2, t1, b, l, bn_sign(z));
+		ep4_mul_sps(t3, t2, b, l, bn_sign(z));
 
 		ep4_sub(t3, t3, t2);
 		ep4_sub(t3, t3, p);
@@ -42,6 +42,8 @@
 void fp_inv_basic(fp_t c, const fp_t a) {
 	bn_t e;
 
+	RLC_OPCNT(OP_FP_INV);
+
 	bn_null(e);
 
 	if (fp_is_zero(a)) {
@@ -73,6 +75,8 @@ void fp_inv_basic(fp_t c, const fp_t a) {
 void fp_inv_binar(fp_t c, const fp_t a) {
 	bn_t u, v, g1, g2, p;
 
+	RLC_OPCNT(OP_FP_INV);
+
 	bn_null(u);
 	bn_null(v);
 	bn_null(g1);
@@ -193,6 +197,8 @@ void fp_inv_monty(fp_t c, const fp_t a) {
 	dig_t carry;
 	int i, k, flag = 0;
 
+	RLC_OPCNT(OP_FP_INV);
+
 	bn_null(_a);
 	bn_null(_p);
 	bn_null(u);
@@ -333,6 +339,8 @@ void fp_inv_monty(fp_t c, const fp_t a) {
 void fp_inv_exgcd(fp_t c, const fp_t a) {
 	bn_t u, v, g1, g2, p, q, r;
 
+	RLC_OPCNT(OP_FP_INV);
+
 	bn_null(u);
 	bn_null(v);
 	bn_null(g1);
@@ -413,6 +421,8 @@ void fp_inv_divst(fp_t c, const fp_t a) {
 	bn_t _t;
 	fp_t f, g, t, u, v, r;
 
+	RLC_OPCNT(OP_FP_INV);
+
 	bn_null(_t);
 	fp_null(f);
 	fp_null(g);
@@ -559,6 +569,8 @@ void fp_inv_jmpds(fp_t c, const fp_t a) {
 	dv_t f, g, t, p, t0, t1, u0, u1, v0, v1, p01, p11;
 	fp_t pre;
 
+	RLC_OPCNT(OP_FP_INV);
+
 	if (fp_is_zero(a)) {
 		RLC_THROW(ERR_NO_VALID);
 		return;
@@ -804,6 +816,8 @@ void fp_inv_jmpds(fp_t c, const fp_t a) {
 #if FP_INV == LOWER || !defined(STRIP)
 
 void fp_inv_lower(fp_t c, const fp_t a) {
+	RLC_OPCNT(OP_FP_INV);
+
 	if (fp_is_zero(a)) {
 		RLC_THROW(ERR_NO_VALID);
 		return;
@@ -183,6 +183,8 @@ void fp_mul_basic(fp_t c, const fp_t a, const fp_t b) {
 	dv_t t;
 	dig_t carry;
 
+	RLC_OPCNT(OP_FP_MUL);
+
 	dv_null(t);
 
 	RLC_TRY {
@@ -211,6 +213,8 @@ void fp_mul_basic(fp_t c, const fp_t a, const fp_t b) {
 void fp_mul_comba(fp_t c, const fp_t a, const fp_t b) {
 	dv_t t;
 
+	RLC_OPCNT(OP_FP_MUL);
+
 	dv_null(t);
 
 	RLC_TRY {
@@ -233,6 +237,7 @@ void fp_mul_comba(fp_t c, const fp_t a, const fp_t b) {
 #if FP_MUL == INTEG || !defined(STRIP)
 
 void fp_mul_integ(fp_t c, const fp_t a, const fp_t b) {
+	RLC_OPCNT(OP_FP_MUL);
 	fp_mulm_low(c, a, b);
 }
 
@@ -243,6 +248,8 @@ void fp_mul_integ(fp_t c, const fp_t a, const fp_t b) {
 void fp_mul_karat(fp_t c, const fp_t a, const fp_t b) {
 	dv_t t;
 
+	RLC_OPCNT(OP_FP_MUL);
+
 	dv_null(t);
 
 	RLC_TRY {
@@ -656,6 +656,8 @@ int fp_param_set_any_tower(void) {
 	fp_param_set(BN_254);
 #elif FP_PRIME == 256
 	fp_param_set(BN_256);
+#elif FP_PRIME == 310
+	fp_param_set(BW13_310);
 #elif FP_PRIME == 381
 	fp_param_set(B12_381);
 #elif FP_PRIME == 382
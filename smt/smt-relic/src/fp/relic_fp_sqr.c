@@ -166,6 +166,8 @@ void fp_sqr_basic(fp_t c, const fp_t a) {
 	int i;
 	dv_t t;
 
+	RLC_OPCNT(OP_FP_SQR);
+
 	dv_null(t);
 
 	RLC_TRY {
@@ -195,6 +197,8 @@ void fp_sqr_basic(fp_t c, const fp_t a) {
 void fp_sqr_comba(fp_t c, const fp_t a) {
 	dv_t t;
 
+	RLC_OPCNT(OP_FP_SQR);
+
 	dv_null(t);
 
 	RLC_TRY {
@@ -216,6 +220,7 @@ void fp_sqr_comba(fp_t c, const fp_t a) {
 #if FP_SQR == INTEG || !defined(STRIP)
 
 void fp_sqr_integ(fp_t c, const fp_t a) {
+	RLC_OPCNT(OP_FP_SQR);
 	fp_sqrm_low(c, a);
 }
 
@@ -226,6 +231,8 @@ void fp_sqr_integ(fp_t c, const fp_t a) {
 void fp_sqr_karat(fp_t c, const fp_t a) {
 	dv_t t;
 
+	RLC_OPCNT(OP_FP_SQR);
+
 	dv_null(t);
 
 	RLC_TRY {
@@ -99,6 +99,8 @@ inline static void fp6_mul_dxs_unr_lazyr(dv6_t c, const fp6_t a, const fp6_t b)
 void fp12_mul_basic(fp12_t c, const fp12_t a, const fp12_t b) {
 	fp6_t t0, t1, t2;
 
+	RLC_OPCNT(OP_FP12_MUL);
+
 	fp6_null(t0);
 	fp6_null(t1);
 	fp6_null(t2);
@@ -280,6 +282,8 @@ void fp12_mul_unr(dv12_t c, const fp12_t a, const fp12_t b) {
 void fp12_mul_lazyr(fp12_t c, const fp12_t a, const fp12_t b) {
 	dv12_t t;
 
+	RLC_OPCNT(OP_FP12_MUL);
+
 	dv12_null(t);
 
 	RLC_TRY {
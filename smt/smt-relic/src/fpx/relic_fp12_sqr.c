@@ -42,6 +42,8 @@
 void fp12_sqr_basic(fp12_t c, const fp12_t a) {
 	fp6_t t0, t1;
 
+	RLC_OPCNT(OP_FP12_SQR);
+
 	fp6_null(t0);
 	fp6_null(t1);
 
@@ -69,6 +71,8 @@ void fp12_sqr_basic(fp12_t c, const fp12_t a) {
 void fp12_sqr_cyc_basic(fp12_t c, const fp12_t a) {
 	fp2_t t0, t1, t2, t3, t4, t5, t6;
 
+	RLC_OPCNT(OP_FP12_CYC);
+
 	fp2_null(t0);
 	fp2_null(t1);
 	fp2_null(t2);
@@ -340,6 +344,8 @@ void fp12_sqr_unr(dv12_t c, const fp12_t a) {
 void fp12_sqr_lazyr(fp12_t c, const fp12_t a) {
 	dv12_t t;
 
+	RLC_OPCNT(OP_FP12_SQR);
+
 	dv12_null(t);
 
 	RLC_TRY {
@@ -360,6 +366,8 @@ void fp12_sqr_cyc_lazyr(fp12_t c, const fp12_t a) {
 	fp2_t t0, t1, t2;
 	dv2_t u0, u1, u2, u3;
 
+	RLC_OPCNT(OP_FP12_CYC);
+
 	fp2_null(t0);
 	fp2_null(t1);
 	fp2_null(t2);
@@ -24,288 +24,170 @@
 /**
  * @file
  *
- * Implementation of multiplication in a quadratic extension of a prime field.
+ * Implementation of multiplication in a 13-th extension of a prime field.
  *
  * @ingroup fpx
  */
-#include"relic_core.h"
-#include"relic_fp.h"
-#include"relic_fp_low.h"
-#include"relic_fpx_low.h"
+#include "relic_core.h"
+#include "relic_fp.h"
+#include "relic_fp_low.h"
+#include "relic_fpx_low.h"
 
 /*============================================================================*/
 /* Private definitions                                                        */
 /*============================================================================*/
 
 /**
- * Given a=a[0]+a[1]x and  b=b[0]+ b[1]x. compute a*b
- *
- * @param[out] c			- the result.
- * @param[in] a			- the first element.
- * @param[in] b			- the second element.
- */
-static void fp_mul_level2(dv_t* c, const fp_t* a, const fp_t* b) {
-      dig_t k0[2 * RLC_FP_DIGS], k1[2 * RLC_FP_DIGS];
-
-      fp_muln_low(c[0], a[0], b[0]);
-
-      fp_muln_low(c[2], a[1], b[1]);
-
-      fp_addn_low(k0, a[0], a[1]);
-      fp_addn_low(k1, b[0], b[1]);
-      fp_muln_low(c[1], k0, k1);
-      fp_subd_low(c[1], c[1], c[0]);
-      fp_subd_low(c[1], c[1], c[2]);
-}
-/**
- * Given a=a[0]+a[1]x+a[2]x^2 and  b=b[0]+ b[1]x+b[2]x^2. compute a*b
- *
- * @param[out] c			- the result.
- * @param[in] a			- the first element.
- * @param[in] b			- the second element.
- */
-static void fp_mul_level3(dv_t* c, const fp_t* a, const fp_t* b) {
-      dig_t k0[2 * RLC_FP_DIGS], k1[2 * RLC_FP_DIGS], k2[2 * RLC_FP_DIGS];
-     // for(int i = 0; i<3; i++)dv_null(k[i]);
-     // for(int i = 0; i<3; i++)dv_new(k[i]);
-      for(int i = 0; i<3;i++)fp_muln_low(c[2*i],a[i],b[i]);
-      fp_addn_low(k0, a[0], a[1]);
-      fp_addn_low(k1, b[0], b[1]);
-      fp_muln_low(c[1], k0, k1);
-      fp_subd_low(c[1], c[1], c[0]);
-      fp_subd_low(c[1], c[1], c[2]);
-
-      fp_addn_low(k0, a[1], a[2]);
-      fp_addn_low(k1, b[1], b[2]);
-      fp_muln_low(c[3], k0, k1);
-      fp_subd_low(c[3], c[3], c[2]);
-      fp_subd_low(c[3], c[3], c[4]);
-
-      fp_addn_low(k0, a[0], a[2]);
-      fp_addn_low(k1, b[0], b[2]);
-      fp_muln_low(k2, k0, k1);
-      fp_addd_low(c[2], c[2], k2);
-      fp_subd_low(c[2], c[2], c[0]);
-      fp_subd_low(c[2], c[2], c[4]);
-
-}
-/**
- * Given a=a[0]+a[1]x+a[2]x^2+a[3]x^3 and  b=b[0]+ b[1]x+b[2]x^2+b[3]x^3.
- *  compute a*b
- *
- * @param[out] c			- the result.
- * @param[in] a			- the first element.
- * @param[in] b			- the second element.
+ * Number of coefficients at or below which polynomial products are computed
+ * with schoolbook multiplication instead of Karatsuba.
  */
-static void fp_mul_level4(dv_t* c, const fp_t* a, const fp_t* b) {
-      fp2_t u,uu;
-      dv_t m[3],mm[3], mmm[3];  
-  
-      fp_mul_level2(m, a, b);
+#ifndef FP13_MUL_SB
+#define FP13_MUL_SB		1
+#endif
 
-      fp_mul_level2(mm, a+2, b+2); 
-
-      fp_addn_low(u[0],a[0],a[2]);
-      fp_addn_low(u[1],a[1],a[3]); 
-      fp_addn_low(uu[0],b[0],b[2]);
-      fp_addn_low(uu[1],b[1],b[3]); 
-      fp_mul_level2(mmm, u, uu); 
-
-      for(int i = 0; i <3; i++){
-	fp_subd_low(mmm[i],mmm[i],m[i]); 
-	fp_subd_low(mmm[i],mmm[i],mm[i]);   
-      }
- 
-      dv_copy(c[0],m[0],10);
-      dv_copy(c[1],m[1],10);
-      dv_copy(c[3],mmm[1],10);
-      dv_copy(c[5],mm[1],10);
-      dv_copy(c[6],mm[2],10);
-
-      fp_addd_low(c[2],m[2],mmm[0]);
-      fp_addd_low(c[4],mm[0],mmm[2]);
-      for(int i = 0; i <3; i++){
-	dv_free(m[i]);
-	dv_free(mm[i]);	
-	dv_free(mmm[i]);	
-      }
-     fp2_free(u);
-     fp2_free(uu);
-}
 /**
- * Given a=a[0]+a[1]x+...+a[5]x^5 and  b=b[0]+ b[1]x+...+b[5]x^5.
- *  compute a*b
- *
- * @param[out] c			- the result.
- * @param[in] a			- the first element.
- * @param[in] b			- the second element.
+ * Maximum number of coefficients of the upper half of an operand.
  */
-static void fp_mul_level6(dv_t* c, const fp_t* a, const fp_t* b) {
+#define HALF			7
 
-      fp_t u[3];
-      fp_t uu[3];
-      dv_t m[5],mm[5],mmm[5];  
-      for(int i = 0;i<3; i++){
-         fp_addn_low(u[i],a[i],a[i+3]);
-         fp_addn_low(uu[i],b[i],b[i+3]);
-      }
-       fp_mul_level3(m,a,b);
-       fp_mul_level3(mm,a+3,b+3);
-       fp_mul_level3(mmm,u,uu);
-      for(int i = 0;i<5; i++){
-         fp_subd_low(mmm[i],mmm[i],m[i]);
-         fp_subd_low(mmm[i],mmm[i],mm[i]);
-      }
-      for(int i = 0;i<3; i++){ 
-       dv_copy(c[i], m[i],10);
-      }
-      dv_copy(c[5],mmm[2],10);
-      for(int i = 0;i<3; i++){ 
-       dv_copy(c[i+8], mm[i+2],10);
-      }
-
-      fp_addd_low(c[3],m[3],mmm[0]);
-      fp_addd_low(c[4],m[4],mmm[1]);
-
-      fp_addd_low(c[7],mm[1],mmm[4]);
-      fp_addd_low(c[6],mm[0],mmm[3]);
-      for(int i = 0; i < 5; i++){
-	dv_free(m[i]);
-	dv_free(mm[i]);	
-	dv_free(mmm[i]);	
-      }
-      for(int i = 0; i < 3; i++){
-	fp_free(u[i]);
-	fp_free(uu[i]);	
-      }
-}
 /**
- * Given a=a[0]+a[1]x+...+a[6]x^6 and  b=b[0]+ b[1]x+...+b[6]x^6.
- *  compute a*b
+ * Multiplies two polynomials of n coefficients over the prime field without
+ * reducing the 2n - 1 coefficients of the result. Polynomials with more than
+ * three coefficients are split in a lower half of floor(n/2) coefficients and
+ * an upper half with the remainder, so a 13-coefficient product costs 66
+ * base field multiplications. All coefficients remain non-negative, so the
+ * intermediate values only use the spare bits of the top digit.
  *
  * @param[out] c			- the result.
- * @param[in] a			- the first element.
- * @param[in] b			- the second element.
+ * @param[in] a				- the first polynomial.
+ * @param[in] b				- the second polynomial.
+ * @param[in] n				- the number of coefficients.
  */
-static void fp_mul_level7(dv_t* c, const fp_t* a, const fp_t* b) {
-
-      fp_t u[4];
-      fp_t uu[4];
-      dv_t m[5],mm[7],mmm[7];  
-      for(int i = 0;i<3; i++){
-         fp_addn_low(u[i],a[i],a[i+3]);
-         fp_addn_low(uu[i],b[i],b[i+3]);
-      }
-      fp_copy(u[3],a[6]);
-      fp_copy(uu[3],b[6]);
-       fp_mul_level3(m,a,b);
-       fp_mul_level4(mm,a+3,b+3);
-       fp_mul_level4(mmm,u,uu);
-      for(int i = 0;i<5; i++){
-         fp_subd_low(mmm[i],mmm[i],m[i]);
-         fp_subd_low(mmm[i],mmm[i],mm[i]);
-      }
-     fp_subd_low(mmm[5],mmm[5],mm[5]);
-     fp_subd_low(mmm[6],mmm[6],mm[6]);
-     for(int i = 0;i<3; i++){
-        dv_copy(c[i],m[i],10);
-      }
-     fp_addd_low(c[3],m[3],mmm[0]);
-     fp_addd_low(c[4],m[4],mmm[1]);
-     dv_copy(c[5],mmm[2],10);
-     fp_addd_low(c[6],mm[0],mmm[3]);
-     fp_addd_low(c[7],mm[1],mmm[4]);
-     fp_addd_low(c[8],mm[2],mmm[5]);
-     fp_addd_low(c[9],mm[3],mmm[6]);
-     for(int i = 0;i<3; i++){
-        dv_copy(c[10+i],mm[i+4],10);
-      }   
-   for(int i = 0; i <5; i++)dv_free(m[i]);
-   for(int i = 0; i <7; i++){
-	dv_free(mm[i]);	
-	dv_free(mmm[i]);	
-      }
-   for(int i = 0; i < 4; i++){
-	fp_free(u[i]);
-	fp_free(uu[i]);	
-      }
+static void fp_mulk_low(dig_t c[][2 * RLC_FP_DIGS], dig_t a[][RLC_FP_DIGS],
+		dig_t b[][RLC_FP_DIGS], int n) {
+	dig_t u[HALF][RLC_FP_DIGS], v[HALF][RLC_FP_DIGS];
+	dig_t t[2 * HALF - 1][2 * RLC_FP_DIGS];
+	int i, j, h;
+
+	if (n <= FP13_MUL_SB) {
+		for (i = 0; i < 2 * n - 1; i++) {
+			dv_zero(c[i], 2 * RLC_FP_DIGS);
+		}
+		for (i = 0; i < n; i++) {
+			for (j = 0; j < n; j++) {
+				fp_muln_low(t[0], a[i], b[j]);
+				fp_addd_low(c[i + j], c[i + j], t[0]);
+			}
+		}
+		return;
+	}
+
+	if (n == 2) {
+		fp_muln_low(c[0], a[0], b[0]);
+		fp_muln_low(c[2], a[1], b[1]);
+		fp_addn_low(u[0], a[0], a[1]);
+		fp_addn_low(v[0], b[0], b[1]);
+		fp_muln_low(c[1], u[0], v[0]);
+		fp_subd_low(c[1], c[1], c[0]);
+		fp_subd_low(c[1], c[1], c[2]);
+		return;
+	}
+
+	if (n == 3) {
+		for (i = 0; i < 3; i++) {
+			fp_muln_low(c[2 * i], a[i], b[i]);
+		}
+		fp_addn_low(u[0], a[0], a[1]);
+		fp_addn_low(v[0], b[0], b[1]);
+		fp_muln_low(c[1], u[0], v[0]);
+		fp_subd_low(c[1], c[1], c[0]);
+		fp_subd_low(c[1], c[1], c[2]);
+
+		fp_addn_low(u[0], a[1], a[2]);
+		fp_addn_low(v[0], b[1], b[2]);
+		fp_muln_low(c[3], u[0], v[0]);
+		fp_subd_low(c[3], c[3], c[2]);
+		fp_subd_low(c[3], c[3], c[4]);
+
+		fp_addn_low(u[0], a[0], a[2]);
+		fp_addn_low(v[0], b[0], b[2]);
+		fp_muln_low(t[0], u[0], v[0]);
+		fp_addd_low(c[2], c[2], t[0]);
+		fp_subd_low(c[2], c[2], c[0]);
+		fp_subd_low(c[2], c[2], c[4]);
+		return;
+	}
+
+	h = n >> 1;
+	/* Compute lower and upper products, leaving c[2h - 1] empty. */
+	fp_mulk_low(c, a, b, h);
+	fp_mulk_low(c + 2 * h, a + h, b + h, n - h);
+	dv_zero(c[2 * h - 1], 2 * RLC_FP_DIGS);
+
+	for (i = 0; i < h; i++) {
+		fp_addn_low(u[i], a[i], a[i + h]);
+		fp_addn_low(v[i], b[i], b[i + h]);
+	}
+	if (n - h > h) {
+		dv_copy(u[h], a[n - 1], RLC_FP_DIGS);
+		dv_copy(v[h], b[n - 1], RLC_FP_DIGS);
+	}
+	fp_mulk_low(t, u, v, n - h);
+
+	for (i = 0; i < 2 * h - 1; i++) {
+		fp_subd_low(t[i], t[i], c[i]);
+	}
+	for (i = 0; i < 2 * (n - h) - 1; i++) {
+		fp_subd_low(t[i], t[i], c[i + 2 * h]);
+		fp_addd_low(c[i + h], c[i + h], t[i]);
+	}
 }
 
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
 
-void fp13_muln_low(dv13_t c, fp13_t a, fp13_t b){
-     fp_t u[7],uu[7];
-     dv_t m[11],mm[13],mmm[13];	
-     fp_mul_level6(m,a,b);
-     fp_mul_level7(mm,a+6,b+6);
-     for(int i = 0;i<6; i++){
-        fp_addn_low(u[i],a[i],a[i+6]);
-        fp_addn_low(uu[i],b[i],b[i+6]);
-      }       
-     fp_copy(u[6],a[12]);
-     fp_copy(uu[6],b[12]);
-     fp_mul_level7(mmm,u,uu);
-     for(int i = 0;i<11; i++){
-         fp_subd_low(mmm[i],mmm[i],m[i]);
-         fp_subd_low(mmm[i],mmm[i],mm[i]);
-      }
-     fp_subd_low(mmm[11],mmm[11],mm[11]);
-     fp_subd_low(mmm[12],mmm[12],mm[12]);
-
-
-      for(int i = 0;i<6; i++){   
-        fp_addd_low(c[i],mm[i+1],mmm[i+7]);
-        fp_addd_low(c[i],c[i],c[i]);
-	fp_subc_low(c[i],m[i],c[i]);
-     }
-     for(int i = 0;i<5; i++){ 
-        fp_addd_low(c[i+6], mm[i+7], mm[i+7]);
-	fp_addd_low(m[0], m[i+6], mmm[i]);
-        fp_subc_low(c[i+6], m[0], c[i+6]);
-     }
-    fp_addd_low(c[11], mm[12], mm[12]);
-    fp_subc_low(c[11], mmm[5], c[11]);
-    fp_addd_low(c[12], mm[0], mmm[6]);
-    for(int i = 0; i <7; i++){
-	fp_free(u[i]);
-	fp_free(uu[i]);
-    }
-   for(int i = 0; i <11; i++)dv_free(m[i]);
-   for(int i = 0; i <13; i++){
-	dv_free(mm[i]);	
-	dv_free(mmm[i]);	
-      }
- 
+void fp13_muln_low(dv13_t c, fp13_t a, fp13_t b) {
+	dig_t u[13][RLC_FP_DIGS], v[13][RLC_FP_DIGS], t[25][2 * RLC_FP_DIGS];
+
+	for (int i = 0; i < 13; i++) {
+		dv_copy(u[i], a[i], RLC_FP_DIGS);
+		dv_copy(v[i], b[i], RLC_FP_DIGS);
+	}
+	fp_mulk_low(t, u, v, 13);
+
+	/* Fold the upper half using w^13 = -2. */
+	for (int i = 0; i < 12; i++) {
+		fp_addd_low(c[i], t[i + 13], t[i + 13]);
+		fp_subc_low(c[i], t[i], c[i]);
+	}
+	dv_copy(c[12], t[12], 2 * RLC_FP_DIGS);
 }
 
-void fp13_mul_lazyr(fp13_t d, fp13_t a, fp13_t b){
-     dv13_t c;
-     for(int i = 0; i<13; i++)dv_null(c[i]);
-     for(int i = 0; i<13; i++)dv_new(c[i]);
-     fp13_muln_low(c,a, b);
-     for(int i = 0; i<13;i++)fp_rdc(d[i],c[i]);  
-     dv13_free(c);
+void fp13_rdcn_low(fp13_t c, dv13_t a) {
+	for (int i = 0; i < 13; i++) {
+#if FP_RDC == MONTY
+		fp_rdcn_low(c[i], a[i]);
+#else
+		fp_rdc(c[i], a[i]);
+#endif
+	}
 }
 
+void fp13_mul_lazyr(fp13_t c, fp13_t a, fp13_t b) {
+	dv13_t t;
 
+	RLC_OPCNT(OP_FP13_MUL);
 
+	dv13_null(t);
 
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
+	RLC_TRY {
+		dv13_new(t);
+		fp13_muln_low(t, a, b);
+		fp13_rdcn_low(c, t);
+	} RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	} RLC_FINALLY {
+		dv13_free(t);
+	}
+}
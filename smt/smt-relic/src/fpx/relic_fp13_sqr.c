@@ -24,257 +24,125 @@
 /**
  * @file
  *
- * Implementation of multiplication in a quadratic extension of a prime field.
+ * Implementation of squaring in a 13-th extension of a prime field.
  *
  * @ingroup fpx
  */
-#include"relic_core.h"
-#include"relic_fp.h"
-#include"relic_fp_low.h"
-#include"relic_fpx_low.h"
+#include "relic_core.h"
+#include "relic_fp.h"
+#include "relic_fp_low.h"
+#include "relic_fpx_low.h"
 
 /*============================================================================*/
 /* Private definitions                                                        */
 /*============================================================================*/
-/**
- * Given a=a[0]+a[1]x and compute a^2
- *
- * @param[out] c			- the result.
- * @param[in] a			- the first element.
- * @param[in] b			- the second element.
- */
 
-static void fp_sqr_level2(dv_t* c, const fp_t* a){
-      fp_addn_low(c[0],a[0],a[1]);
-      fp_sqrn_low(c[1],c[0]);
-      fp_sqrn_low(c[0],a[0]);
-      fp_sqrn_low(c[2],a[1]);
-      fp_subd_low(c[1],c[1],c[0]);
-      fp_subd_low(c[1],c[1],c[2]);
-}
 /**
- * Given a=a[0]+a[1]x+a[2]x^2 and compute a^2
- *
- * @param[out] c			- the result.
- * @param[in] a			- the first element.
- * @param[in] b			- the second element.
+ * Number of coefficients at or below which polynomial squares are computed
+ * with schoolbook squaring instead of Karatsuba.
  */
-static void fp_sqr_level3(dv_t* c, const fp_t* a) {
-      dig_t k0[2 * RLC_FP_DIGS], k1[2 * RLC_FP_DIGS];
-      for(int i = 0; i<3;i++)fp_sqrn_low(c[2*i],a[i]);
+#ifndef FP13_SQR_SB
+#define FP13_SQR_SB		7
+#endif
 
-      fp_addn_low(k0,a[0],a[1]);
-      fp_sqrn_low(c[1],k0);
-      fp_subd_low(c[1],c[1],c[0]);
-      fp_subd_low(c[1],c[1],c[2]);
-
-      fp_addn_low(k0,a[1],a[2]);
-      fp_sqrn_low(c[3],k0);
-      fp_subd_low(c[3],c[3],c[2]);
-      fp_subd_low(c[3],c[3],c[4]);
-
-      fp_addn_low(k0,a[0],a[2]);
-      fp_sqrn_low(k1,k0);       //
-      fp_addd_low(c[2],c[2],k1);
-      fp_subd_low(c[2],c[2],c[0]);
-      fp_subd_low(c[2],c[2],c[4]);
-
-}
 /**
- * Given a=a[0]+a[1]x+a[2]x^2+a[3]x^3 and compute a^2
- *
- * @param[out] c			- the result.
- * @param[in] a			- the first element.
- * @param[in] b			- the second element.
+ * Maximum number of coefficients of the upper half of an operand.
  */
-static void fp_sqr_level4(dv_t* c, const fp_t* a) {
-      fp2_t u;
-      dv_t m[3],mm[3], mmm[3];  
-  
-      fp_sqr_level2(m, a);
-      fp_sqr_level2(mm, a+2); 
+#define HALF			7
 
-      fp_addn_low(u[0],a[0],a[2]);
-      fp_addn_low(u[1],a[1],a[3]); 
-      fp_sqr_level2(mmm, u); 
-
-      for(int i = 0; i <3; i++){
-	fp_subd_low(mmm[i],mmm[i],m[i]); 
-	fp_subd_low(mmm[i],mmm[i],mm[i]);   
-      }
- 
-      dv_copy(c[0],m[0],10);
-      dv_copy(c[1],m[1],10);
-      dv_copy(c[3],mmm[1],10);
-      dv_copy(c[5],mm[1],10);
-      dv_copy(c[6],mm[2],10);
-
-      fp_addd_low(c[2],m[2],mmm[0]);
-      fp_addd_low(c[4],mm[0],mmm[2]);
-      fp2_free(u);
-      for(int i = 0; i <3; i++){
-	 dv_free(m[i]);
-	 dv_free(mm[i]);	
-	 dv_free(mmm[i]);	
-      }
-}
 /**
- * Given a=a[0]+a[1]x+...+a[5]x^5 and compute a^2
+ * Squares a polynomial of n coefficients over the prime field without
+ * reducing the 2n - 1 coefficients of the result. Squaring has cheaper base
+ * cases than multiplication, so by default a single Karatsuba level is applied
+ * over schoolbook squares of 6 and 7 coefficients. All coefficients remain
+ * non-negative, as in fp13_muln_low().
  *
  * @param[out] c			- the result.
- * @param[in] a			- the first element.
- * @param[in] b			- the second element.
+ * @param[in] a				- the polynomial to square.
+ * @param[in] n				- the number of coefficients.
  */
-static void fp_sqr_level6(dv_t* c, const fp_t* a) {
-
-      fp_t u[3];
-
-      dv_t m[5],mm[5],mmm[5];  
-      for(int i = 0;i<3; i++)fp_addn_low(u[i],a[i],a[i+3]);
-     
-      fp_sqr_level3(m,a);
-      fp_sqr_level3(mm,a+3);
-      fp_sqr_level3(mmm,u);
-
-      for(int i = 0;i<5; i++){
-         fp_subd_low(mmm[i],mmm[i],m[i]);
-         fp_subd_low(mmm[i],mmm[i],mm[i]);
-      }
-
-      for(int i = 0;i<3; i++){ 
-       dv_copy(c[i], m[i],10);
-      }
-      dv_copy(c[5],mmm[2],10);
-      for(int i = 0;i<3; i++){ 
-       dv_copy(c[i+8], mm[i+2],10);
-      }
-
-      fp_addd_low(c[3],m[3],mmm[0]);
-      fp_addd_low(c[4],m[4],mmm[1]);
-
-      fp_addd_low(c[7],mm[1],mmm[4]);
-      fp_addd_low(c[6],mm[0],mmm[3]);
-      for(int i = 0; i < 3; i++)fp_free(u[i]);
-      for(int i = 0; i < 5; i++){
-	 dv_free(m[i]);
-	 dv_free(mm[i]);	
-	 dv_free(mmm[i]);	
-      }
-}
-/**
- * Compute a^2, where a=a[0]+a[1]x+...+a[6]x^6
- *
- * @param[out] c			- the result.
- * @param[in] a			- the first element.
- * @param[in] b			- the second element.
- */
-static void fp_sqr_level7(dv_t* c, const fp_t* a) {
-
-      fp_t u[4];
-      dv_t m[5],mm[7],mmm[7];  
-      for(int i = 0;i<3; i++)fp_addn_low(u[i],a[i],a[i+3]);
-      
-      fp_copy(u[3],a[6]);
-      fp_sqr_level3(m,a);
-      fp_sqr_level4(mm,a+3);
-      fp_sqr_level4(mmm,u);
-      for(int i = 0;i<5; i++){
-         fp_subd_low(mmm[i],mmm[i],m[i]);
-         fp_subd_low(mmm[i],mmm[i],mm[i]);
-      }
-     fp_subd_low(mmm[5],mmm[5],mm[5]);
-     fp_subd_low(mmm[6],mmm[6],mm[6]);
-     for(int i = 0;i<3; i++){
-        dv_copy(c[i],m[i],10);
-      }
-     fp_addd_low(c[3],m[3],mmm[0]);
-     fp_addd_low(c[4],m[4],mmm[1]);
-     dv_copy(c[5],mmm[2],10);
-     fp_addd_low(c[6],mm[0],mmm[3]);
-     fp_addd_low(c[7],mm[1],mmm[4]);
-     fp_addd_low(c[8],mm[2],mmm[5]);
-     fp_addd_low(c[9],mm[3],mmm[6]);
-     for(int i = 0;i<3; i++){
-        dv_copy(c[10+i],mm[i+4],10);
-      }   
-     for(int i = 0; i < 4; i++)fp_free(u[i]);
-     for(int i = 0; i < 5; i++)dv_free(m[i]);
-     for(int i = 0; i < 7; i++){
-	 dv_free(mm[i]);	
-	 dv_free(mmm[i]);	
-     }
+static void fp_sqrk_low(dig_t c[][2 * RLC_FP_DIGS], dig_t a[][RLC_FP_DIGS],
+		int n) {
+	dig_t u[HALF][RLC_FP_DIGS], t[2 * HALF - 1][2 * RLC_FP_DIGS];
+	int i, j, h;
+
+	if (n <= FP13_SQR_SB) {
+		for (i = 0; i < 2 * n - 1; i++) {
+			dv_zero(c[i], 2 * RLC_FP_DIGS);
+		}
+		for (i = 0; i < n; i++) {
+			for (j = i + 1; j < n; j++) {
+				fp_muln_low(t[0], a[i], a[j]);
+				fp_addd_low(c[i + j], c[i + j], t[0]);
+			}
+		}
+		for (i = 1; i < 2 * n - 2; i++) {
+			fp_addd_low(c[i], c[i], c[i]);
+		}
+		for (i = 0; i < n; i++) {
+			fp_sqrn_low(t[0], a[i]);
+			fp_addd_low(c[2 * i], c[2 * i], t[0]);
+		}
+		return;
+	}
+
+	h = n >> 1;
+	/* Compute lower and upper squares, leaving c[2h - 1] empty. */
+	fp_sqrk_low(c, a, h);
+	fp_sqrk_low(c + 2 * h, a + h, n - h);
+	dv_zero(c[2 * h - 1], 2 * RLC_FP_DIGS);
+
+	for (i = 0; i < h; i++) {
+		fp_addn_low(u[i], a[i], a[i + h]);
+	}
+	if (n - h > h) {
+		dv_copy(u[h], a[n - 1], RLC_FP_DIGS);
+	}
+	fp_sqrk_low(t, u, n - h);
+
+	for (i = 0; i < 2 * h - 1; i++) {
+		fp_subd_low(t[i], t[i], c[i]);
+	}
+	for (i = 0; i < 2 * (n - h) - 1; i++) {
+		fp_subd_low(t[i], t[i], c[i + 2 * h]);
+		fp_addd_low(c[i + h], c[i + h], t[i]);
+	}
 }
 
-
-
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
-void fp13_sqrn_low(dv13_t c, fp13_t a){
-     fp_t u[7];
-     dv_t m[11],mm[13],mmm[13];	
-     fp_sqr_level6(m,a);
-     fp_sqr_level7(mm,a+6);
-     for(int i = 0;i<6; i++)fp_addn_low(u[i],a[i],a[i+6]);
-   
-     fp_copy(u[6],a[12]);
-     fp_sqr_level7(mmm,u);
-     for(int i = 0;i<11; i++){
-         fp_subd_low(mmm[i],mmm[i],m[i]);
-         fp_subd_low(mmm[i],mmm[i],mm[i]);
-      }
-     fp_subd_low(mmm[11],mmm[11],mm[11]);
-     fp_subd_low(mmm[12],mmm[12],mm[12]);
 
+void fp13_sqrn_low(dv13_t c, fp13_t a) {
+	dig_t u[13][RLC_FP_DIGS], t[25][2 * RLC_FP_DIGS];
 
-      for(int i = 0;i<6; i++){   
-        fp_addd_low(c[i],mm[i+1],mmm[i+7]);
-        fp_addd_low(c[i],c[i],c[i]);
-	fp_subc_low(c[i],m[i],c[i]);
-     }
-     for(int i = 0;i<5; i++){ 
-        fp_addd_low(c[i+6], mm[i+7], mm[i+7]);
-	fp_addd_low(m[0], m[i+6], mmm[i]);
-        fp_subc_low(c[i+6], m[0], c[i+6]);
-     }
-     
-    fp_addd_low(c[11],mm[12],mm[12]);
-    fp_subc_low(c[11],mmm[5],c[11]);
-    fp_addd_low(c[12],mm[0],mmm[6]);
-   for(int i = 0; i <7; i++)fp_free(u[i]);
-   for(int i = 0; i <11; i++)dv_free(m[i]);
-   for(int i = 0; i <13; i++){
-	dv_free(mm[i]);	
-	dv_free(mmm[i]);	
-      }
-}
+	for (int i = 0; i < 13; i++) {
+		dv_copy(u[i], a[i], RLC_FP_DIGS);
+	}
+	fp_sqrk_low(t, u, 13);
 
-void fp13_sqr_lazyr(fp13_t d, fp13_t a){
-     dv13_t c;
-     for(int i = 0; i<13; i++)dv_null(c[i]);
-     for(int i = 0; i<13; i++)dv_new(c[i]);
-     fp13_sqrn_low(c,a);
-     fp13_rdc(d,c);
-     dv13_free(c);
+	/* Fold the upper half using w^13 = -2. */
+	for (int i = 0; i < 12; i++) {
+		fp_addd_low(c[i], t[i + 13], t[i + 13]);
+		fp_subc_low(c[i], t[i], c[i]);
+	}
+	dv_copy(c[12], t[12], 2 * RLC_FP_DIGS);
 }
 
+void fp13_sqr_lazyr(fp13_t c, fp13_t a) {
+	dv13_t t;
 
+	RLC_OPCNT(OP_FP13_SQR);
 
+	dv13_null(t);
 
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
+	RLC_TRY {
+		dv13_new(t);
+		fp13_sqrn_low(t, a);
+		fp13_rdcn_low(c, t);
+	} RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	} RLC_FINALLY {
+		dv13_free(t);
+	}
+}
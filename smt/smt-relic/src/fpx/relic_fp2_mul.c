@@ -42,6 +42,8 @@
 void fp2_mul_basic(fp2_t c, const fp2_t a, const fp2_t b) {
 	dv_t t0, t1, t2, t3, t4;
 
+	RLC_OPCNT(OP_FP2_MUL);
+
 	dv_null(t0);
 	dv_null(t1);
 	dv_null(t2);
@@ -164,6 +166,7 @@ void fp2_mul_nor_basic(fp2_t c, const fp2_t a) {
 #if FPX_QDR == INTEG || !defined(STRIP)
 
 void fp2_mul_integ(fp2_t c, const fp2_t a, const fp2_t b) {
+	RLC_OPCNT(OP_FP2_MUL);
 	fp2_mulm_low(c, a, b);
 }
 
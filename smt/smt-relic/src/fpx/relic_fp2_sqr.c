@@ -41,6 +41,8 @@
 void fp2_sqr_basic(fp2_t c, const fp2_t a) {
 	fp_t t0, t1, t2;
 
+	RLC_OPCNT(OP_FP2_SQR);
+
 	fp_null(t0);
 	fp_null(t1);
 	fp_null(t2);
@@ -104,6 +106,7 @@ void fp2_sqr_basic(fp2_t c, const fp2_t a) {
 #if FPX_QDR == INTEG || !defined(STRIP)
 
 void fp2_sqr_integ(fp2_t c, const fp2_t a) {
+	RLC_OPCNT(OP_FP2_SQR);
 	fp2_sqrm_low(c, a);
 }
 
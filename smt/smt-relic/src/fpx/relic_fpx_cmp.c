@@ -114,19 +114,11 @@ int fp13_cmp(const fp13_t a, const fp13_t b)
 		&& (fp_cmp(a[12], b[12]) == RLC_EQ) ? RLC_EQ : RLC_NE;
 }
 int fp13_cmp_dig(const fp13_t a, dig_t b) {
-	return (fp_cmp_dig(a[0], b) == RLC_EQ) && fp_is_zero(a[1]) ?
-			RLC_EQ : RLC_NE && fp_is_zero(a[2]) ?
-			RLC_EQ : RLC_NE && fp_is_zero(a[3]) ?
-			RLC_EQ : RLC_NE && fp_is_zero(a[4]) ?
-			RLC_EQ : RLC_NE && fp_is_zero(a[5]) ?
-			RLC_EQ : RLC_NE && fp_is_zero(a[6]) ?
-			RLC_EQ : RLC_NE && fp_is_zero(a[7]) ?
-			RLC_EQ : RLC_NE && fp_is_zero(a[8]) ?
-			RLC_EQ : RLC_NE && fp_is_zero(a[9]) ?
-			RLC_EQ : RLC_NE && fp_is_zero(a[10]) ?
-			RLC_EQ : RLC_NE && fp_is_zero(a[11]) ?
-			RLC_EQ : RLC_NE && fp_is_zero(a[12]) ?
-			RLC_EQ : RLC_NE;
+	int r = (fp_cmp_dig(a[0], b) == RLC_EQ);
+	for (int i = 1; i < 13; i++) {
+		r &= fp_is_zero(a[i]);
+	}
+	return r ? RLC_EQ : RLC_NE;
 }
 
 int fp18_cmp(const fp18_t a, const fp18_t b) {
@@ -30,8 +30,374 @@
  * @ingroup fpx
  */
 
+#include <stdlib.h>
+#include <string.h>
+
 #include "relic_core.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Width of the w-NAF used by the interleaved multi-exponentiation.
+ */
+#define FP12_SIM_WIDTH		4
+
+/**
+ * Number of compressed powers decompressed together.
+ */
+#define FP12_SIM_BATCH		256
+
+/**
+ * Decides if an exponent is sparse enough to be processed with compressed
+ * squarings, using the criterion of fp12_exp_cyc(). Short exponents are left
+ * out because they are cheaper when sharing squarings with the other ones.
+ *
+ * @param[in] b				- the exponent.
+ * @return 1 if the exponent should use compressed squarings, 0 otherwise.
+ */
+static int fp12_exp_sim_sps(const bn_t b) {
+	return (bn_bits(b) > RLC_DIG) && ((bn_ham(b) << 3) <= bn_bits(b));
+}
+
+/**
+ * Returns the window width minimizing the cost of the bucket method.
+ *
+ * @param[in] l				- the length of the exponents in bits.
+ * @param[in] m				- the number of bases.
+ * @return the window width.
+ */
+static int fp12_exp_sim_win(int l, int m) {
+	int j, w = 2, cost, best = (l / 2 + 1) * (m + 4);
+
+	for (j = 3; j <= 8; j++) {
+		cost = (l / j + 1) * (m + (1 << j));
+		if (cost < best) {
+			best = cost;
+			w = j;
+		}
+	}
+	return w;
+}
+
+/**
+ * Computes the product of powers of cyclotomic elements by the exponents
+ * accepted by fp12_exp_sim_sps() with compressed squarings, decompressing the
+ * powers of all bases together.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the bases.
+ * @param[in] b				- the exponents.
+ * @param[in] n				- the number of bases.
+ */
+static void fp12_exp_sim_pck(fp12_t c, const fp12_t a[], const bn_t b[],
+		int n) {
+	int i, j, k;
+	fp12_t t, *u = (fp12_t *)calloc(FP12_SIM_BATCH, sizeof(fp12_t));
+
+	fp12_null(t);
+
+	RLC_TRY {
+		if (u == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		fp12_new(t);
+		for (k = 0; k < FP12_SIM_BATCH; k++) {
+			fp12_null(u[k]);
+			fp12_new(u[k]);
+		}
+
+		fp12_set_dig(c, 1);
+		for (k = 0, i = 0; i < n; i++) {
+			/* The unity has no compressed form that can be decompressed. */
+			if (bn_is_zero(b[i]) || fp12_cmp_dig(a[i], 1) == RLC_EQ ||
+					!fp12_exp_sim_sps(b[i])) {
+				continue;
+			}
+			if (bn_get_bit(b[i], 0)) {
+				if (bn_sign(b[i]) == RLC_NEG) {
+					fp12_inv_cyc(t, a[i]);
+					fp12_mul(c, c, t);
+				} else {
+					fp12_mul(c, c, a[i]);
+				}
+			}
+			fp12_copy(t, a[i]);
+			for (j = 1; j < bn_bits(b[i]); j++) {
+				fp12_sqr_pck(t, t);
+				if (bn_get_bit(b[i], j)) {
+					if (bn_sign(b[i]) == RLC_NEG) {
+						fp12_inv_cyc(u[k++], t);
+					} else {
+						fp12_copy(u[k++], t);
+					}
+				}
+				if (k == FP12_SIM_BATCH) {
+					fp12_back_cyc_sim(u, u, k);
+					while (k > 0) {
+						fp12_mul(c, c, u[--k]);
+					}
+				}
+			}
+		}
+		fp12_back_cyc_sim(u, u, k);
+		while (k > 0) {
+			fp12_mul(c, c, u[--k]);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp12_free(t);
+		if (u != NULL) {
+			for (k = 0; k < FP12_SIM_BATCH; k++) {
+				fp12_free(u[k]);
+			}
+		}
+		free(u);
+	}
+}
+
+/**
+ * Computes the product of powers of cyclotomic elements by interleaving the
+ * w-NAF representations of the exponents. Bases that are the Frobenius image
+ * of the previous one have their precomputation tables derived by the
+ * Frobenius map.
+ *
+ * @param[out] c			- the result.
+ * @param[in] t				- the bases.
+ * @param[in] e				- the absolute values of the exponents.
+ * @param[in] s				- the signs of the exponents.
+ * @param[in] m				- the number of bases.
+ * @param[in] q				- the flags of bases that are Frobenius images.
+ */
+static void fp12_exp_sim_int(fp12_t c, const fp12_t t[], const bn_t e[],
+		const int *s, const int *q, int m) {
+	int i, j, k, l, d, f, z, h = 1 << (FP12_SIM_WIDTH - 2);
+	fp12_t v, *u = (fp12_t *)calloc((size_t)m * h, sizeof(fp12_t));
+	int8_t *naf = NULL;
+	int *len = (int *)malloc(m * sizeof(int));
+
+	fp12_null(v);
+
+	for (z = 0, k = 0; k < m; k++) {
+		z = RLC_MAX(z, bn_bits(e[k]) + 1);
+	}
+	naf = (int8_t *)malloc((size_t)m * z);
+
+	RLC_TRY {
+		if (u == NULL || naf == NULL || len == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		fp12_new(v);
+		for (k = 0; k < m * h; k++) {
+			fp12_null(u[k]);
+			fp12_new(u[k]);
+		}
+
+		/* Compute the odd powers of each base, or their Frobenius images. */
+		for (l = 0, k = 0; k < m; k++) {
+			if (!q[k]) {
+				fp12_copy(u[k * h], t[k]);
+				fp12_sqr_cyc(v, t[k]);
+				for (j = 1; j < h; j++) {
+					fp12_mul(u[k * h + j], u[k * h + j - 1], v);
+				}
+			} else {
+				for (j = 0; j < h; j++) {
+					fp12_frb(u[k * h + j], u[(k - 1) * h + j], 1);
+				}
+			}
+			len[k] = 0;
+			if (!bn_is_zero(e[k])) {
+				len[k] = z;
+				bn_rec_naf(naf + k * z, &len[k], e[k], FP12_SIM_WIDTH);
+			}
+			l = RLC_MAX(l, len[k]);
+		}
+
+		f = 0;
+		fp12_set_dig(c, 1);
+		for (i = l - 1; i >= 0; i--) {
+			if (f) {
+				fp12_sqr_cyc(c, c);
+			}
+			for (k = 0; k < m; k++) {
+				d = (i < len[k] ? naf[k * z + i] : 0);
+				if (d == 0) {
+					continue;
+				}
+				if (s[k] == RLC_NEG) {
+					d = -d;
+				}
+				if (d > 0) {
+					fp12_copy(v, u[k * h + d / 2]);
+				} else {
+					fp12_inv_cyc(v, u[k * h - d / 2]);
+				}
+				if (f) {
+					fp12_mul(c, c, v);
+				} else {
+					fp12_copy(c, v);
+					f = 1;
+				}
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp12_free(v);
+		if (u != NULL) {
+			for (k = 0; k < m * h; k++) {
+				fp12_free(u[k]);
+			}
+		}
+		free(u);
+		free(naf);
+		free(len);
+	}
+}
+
+/**
+ * Computes the product of powers of cyclotomic elements with the bucket
+ * method, collecting the bases by signed window digits.
+ *
+ * @param[out] c			- the result.
+ * @param[in] t				- the bases.
+ * @param[in] e				- the absolute values of the exponents.
+ * @param[in] s				- the signs of the exponents.
+ * @param[in] m				- the number of bases.
+ * @param[in] w				- the window width.
+ */
+static void fp12_exp_sim_bkt(fp12_t c, const fp12_t t[], const bn_t e[],
+		const int *s, int m, int w) {
+	int i, j, k, l, d, f, g, h;
+	fp12_t v, r, *u = NULL;
+	int8_t *dig = NULL;
+	uint8_t *win = NULL;
+	int *set = NULL;
+
+	fp12_null(v);
+	fp12_null(r);
+
+	for (l = 0, k = 0; k < m; k++) {
+		l = RLC_MAX(l, bn_bits(e[k]));
+	}
+	h = 1 << (w - 1);
+	l = l / w + 2;
+
+	RLC_TRY {
+		u = (fp12_t *)calloc(h, sizeof(fp12_t));
+		set = (int *)malloc(h * sizeof(int));
+		dig = (int8_t *)malloc((size_t)m * l);
+		win = (uint8_t *)malloc(l);
+		if (u == NULL || set == NULL || dig == NULL || win == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		fp12_new(v);
+		fp12_new(r);
+		for (j = 0; j < h; j++) {
+			fp12_null(u[j]);
+			fp12_new(u[j]);
+		}
+
+		/* Recode the exponents in signed windows, the last absorbs carries. */
+		for (k = 0; k < m; k++) {
+			memset(win, 0, l);
+			if (!bn_is_zero(e[k])) {
+				i = l;
+				bn_rec_win(win, &i, e[k], w);
+			}
+			for (g = 0, i = 0; i < l; i++) {
+				d = win[i] + g;
+				g = (d > h);
+				if (g) {
+					d -= 2 * h;
+				}
+				dig[k * l + i] = (s[k] == RLC_NEG ? -d : d);
+			}
+		}
+
+		f = 0;
+		fp12_set_dig(c, 1);
+		for (i = l - 1; i >= 0; i--) {
+			if (f) {
+				for (j = 0; j < w; j++) {
+					fp12_sqr_cyc(c, c);
+				}
+			}
+			for (j = 0; j < h; j++) {
+				set[j] = 0;
+			}
+			for (k = 0; k < m; k++) {
+				d = dig[k * l + i];
+				if (d == 0) {
+					continue;
+				}
+				if (d > 0) {
+					fp12_copy(v, t[k]);
+				} else {
+					fp12_inv_cyc(v, t[k]);
+					d = -d;
+				}
+				if (set[d - 1]) {
+					fp12_mul(u[d - 1], u[d - 1], v);
+				} else {
+					fp12_copy(u[d - 1], v);
+					set[d - 1] = 1;
+				}
+			}
+			/* Compute \prod_j u_j^(j + 1) with running products. */
+			for (g = 0, d = 0, j = h - 1; j >= 0; j--) {
+				if (set[j]) {
+					if (g) {
+						fp12_mul(v, v, u[j]);
+					} else {
+						fp12_copy(v, u[j]);
+						g = 1;
+					}
+				}
+				if (g) {
+					if (d) {
+						fp12_mul(r, r, v);
+					} else {
+						fp12_copy(r, v);
+						d = 1;
+					}
+				}
+			}
+			if (d) {
+				if (f) {
+					fp12_mul(c, c, r);
+				} else {
+					fp12_copy(c, r);
+					f = 1;
+				}
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp12_free(v);
+		fp12_free(r);
+		if (u != NULL) {
+			for (j = 0; j < h; j++) {
+				fp12_free(u[j]);
+			}
+		}
+		free(u);
+		free(set);
+		free(dig);
+		free(win);
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -820,6 +1186,123 @@ void fp12_exp_cyc_sim(fp12_t e, const fp12_t a, const bn_t b, const fp12_t c, co
 	}
 }
 
+void fp12_exp_cyc_sim_lot(fp12_t c, const fp12_t a[], const bn_t b[], int n) {
+	int i, j, k, l, m, w, g, *s = NULL, *q = NULL;
+	fp12_t v, *t = NULL;
+	bn_t x, ord, *e = NULL, _b[4];
+
+	if (n <= 0) {
+		fp12_set_dig(c, 1);
+		return;
+	}
+
+	/* Count the terms of the dense exponents after the decomposition. */
+	for (m = 0, i = 0; i < n; i++) {
+		if (!bn_is_zero(b[i]) && fp12_cmp_dig(a[i], 1) != RLC_EQ &&
+				!fp12_exp_sim_sps(b[i])) {
+			m += (ep_curve_is_pairf() && bn_bits(b[i]) > RLC_DIG ? 4 : 1);
+		}
+	}
+
+	fp12_null(v);
+	bn_null(x);
+	bn_null(ord);
+
+	RLC_TRY {
+		fp12_new(v);
+		bn_new(x);
+		bn_new(ord);
+		for (j = 0; j < 4; j++) {
+			bn_null(_b[j]);
+			bn_new(_b[j]);
+		}
+		if (m > 0) {
+			t = (fp12_t *)calloc(m, sizeof(fp12_t));
+			e = (bn_t *)calloc(m, sizeof(bn_t));
+			s = (int *)malloc(m * sizeof(int));
+			q = (int *)malloc(m * sizeof(int));
+			if (t == NULL || e == NULL || s == NULL || q == NULL) {
+				RLC_THROW(ERR_NO_MEMORY);
+			}
+			for (k = 0; k < m; k++) {
+				fp12_null(t[k]);
+				fp12_new(t[k]);
+				bn_null(e[k]);
+				bn_new(e[k]);
+			}
+		}
+
+		fp12_exp_sim_pck(c, a, b, n);
+
+		if (m > 0) {
+			ep_curve_get_ord(ord);
+			fp_prime_get_par(x);
+			for (k = 0, i = 0; i < n; i++) {
+				if (bn_is_zero(b[i]) || fp12_cmp_dig(a[i], 1) == RLC_EQ ||
+						fp12_exp_sim_sps(b[i])) {
+					continue;
+				}
+				if (ep_curve_is_pairf() && bn_bits(b[i]) > RLC_DIG) {
+					g = 4;
+					bn_rec_frb(_b, g, b[i], x, ord,
+							ep_curve_is_pairf() == EP_BN);
+				} else {
+					g = 1;
+					bn_copy(_b[0], b[i]);
+				}
+				for (j = 0; j < g; j++, k++) {
+					if (j == 0) {
+						fp12_copy(t[k], a[i]);
+					} else {
+						fp12_frb(t[k], t[k - 1], 1);
+					}
+					bn_abs(e[k], _b[j]);
+					s[k] = bn_sign(_b[j]);
+					q[k] = (j > 0);
+				}
+			}
+
+			/* Compare the costs of interleaving and of the bucket method. */
+			for (l = 0, k = 0; k < m; k++) {
+				l = RLC_MAX(l, bn_bits(e[k]));
+			}
+			w = fp12_exp_sim_win(l, m);
+			if (m * (l / (FP12_SIM_WIDTH + 1) + (1 << (FP12_SIM_WIDTH - 2))) <=
+					(l / w + 1) * (m + (1 << w))) {
+				fp12_exp_sim_int(v, t, e, s, q, m);
+			} else {
+				fp12_exp_sim_bkt(v, t, e, s, m, w);
+			}
+			fp12_mul(c, c, v);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp12_free(v);
+		bn_free(x);
+		bn_free(ord);
+		for (j = 0; j < 4; j++) {
+			bn_free(_b[j]);
+		}
+		if (t != NULL) {
+			for (k = 0; k < m; k++) {
+				fp12_free(t[k]);
+			}
+		}
+		if (e != NULL) {
+			for (k = 0; k < m; k++) {
+				bn_free(e[k]);
+			}
+		}
+		free(t);
+		free(e);
+		free(s);
+		free(q);
+	}
+}
+
 void fp12_exp_cyc_sps(fp12_t c, const fp12_t a, const int *b, int len, int sign) {
 	int i, j, k, w = len;
     fp12_t t, *u = RLC_ALLOCA(fp12_t, w);
@@ -899,6 +1382,314 @@ void fp12_exp_cyc_sps(fp12_t c, const fp12_t a, const int *b, int len, int sign)
 	}
 }
 
+void fp12_exp_cyc_pre(fp2_t *t, const fp12_t a) {
+	int i, j, k, h = 1 << (RLC_FP12_WIDTH - 1);
+	fp12_t b, u;
+
+	fp12_null(b);
+	fp12_null(u);
+
+	RLC_TRY {
+		fp12_new(b);
+		fp12_new(u);
+
+		fp12_copy(b, a);
+		for (i = 0; i < RLC_FP12_WINDS; i++) {
+			/* Store u = b^j for j = 1, ..., 2^(w - 1) in compressed form. */
+			fp12_copy(u, b);
+			for (j = 0; j < h; j++) {
+				if (j == 1) {
+					fp12_sqr_cyc(u, b);
+				} else if (j > 1) {
+					fp12_mul(u, u, b);
+				}
+				k = 4 * (i * h + j);
+				fp2_copy(t[k], u[1][0]);
+				fp2_copy(t[k + 1], u[0][2]);
+				fp2_copy(t[k + 2], u[0][1]);
+				fp2_copy(t[k + 3], u[1][2]);
+			}
+			/* Move to the next window, b = b^(2^w) = u^2. */
+			fp12_sqr_cyc(b, u);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp12_free(b);
+		fp12_free(u);
+	}
+}
+
+void fp12_exp_cyc_fix(fp12_t c, const fp2_t *t, const bn_t b) {
+	int i, j, k, d, l, s, h = 1 << (RLC_FP12_WIDTH - 1);
+	uint8_t win[RLC_FP12_WINDS];
+	fp12_t *u;
+
+	if (bn_is_zero(b)) {
+		fp12_set_dig(c, 1);
+		return;
+	}
+
+	if (bn_bits(b) > RLC_FP_BITS) {
+		RLC_THROW(ERR_NO_BUFFER);
+		return;
+	}
+
+	u = RLC_ALLOCA(fp12_t, RLC_FP12_WINDS);
+
+	RLC_TRY {
+		if (u == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < RLC_FP12_WINDS; i++) {
+			fp12_null(u[i]);
+			fp12_new(u[i]);
+		}
+
+		/* The last window is left empty to absorb the final carry. */
+		l = RLC_FP12_WINDS;
+		bn_rec_win(win, &l, b, RLC_FP12_WIDTH);
+
+		/* Gather the compressed powers selected by the signed digits. */
+		for (k = 0, s = 0, i = 0; i < RLC_FP12_WINDS; i++) {
+			d = win[i] + s;
+			s = (d > h);
+			if (s) {
+				d -= 2 * h;
+			}
+			if (d == 0) {
+				continue;
+			}
+			j = 4 * (i * h + (d < 0 ? -d : d) - 1);
+			/* A zero entry is the compressed form of the unity. */
+			if (fp2_is_zero(t[j]) && fp2_is_zero(t[j + 1]) &&
+					fp2_is_zero(t[j + 2]) && fp2_is_zero(t[j + 3])) {
+				continue;
+			}
+			fp2_zero(u[k][0][0]);
+			fp2_copy(u[k][0][1], t[j + 2]);
+			fp2_copy(u[k][0][2], t[j + 1]);
+			fp2_copy(u[k][1][0], t[j]);
+			fp2_zero(u[k][1][1]);
+			fp2_copy(u[k][1][2], t[j + 3]);
+			if (d < 0) {
+				fp12_inv_cyc(u[k], u[k]);
+			}
+			k++;
+		}
+
+		fp12_back_cyc_sim(u, u, k);
+
+		fp12_set_dig(c, 1);
+		for (i = 0; i < k; i++) {
+			fp12_mul(c, c, u[i]);
+		}
+
+		if (bn_sign(b) == RLC_NEG) {
+			fp12_inv_cyc(c, c);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		if (u != NULL) {
+			for (i = 0; i < RLC_FP12_WINDS; i++) {
+				fp12_free(u[i]);
+			}
+		}
+		RLC_FREE(u);
+	}
+}
+
+int fp13_test_cyc(fp13_t a) {
+	fp_t t;
+	int r = 0;
+
+	fp_null(t);
+
+	RLC_TRY {
+		fp_new(t);
+
+		fp13_norm(t, a);
+		r = (fp_cmp_dig(t, 1) == RLC_EQ);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp_free(t);
+	}
+	return r;
+}
+
+void fp13_exp_cyc(fp13_t c, fp13_t a, const bn_t b) {
+	int i, j, l;
+	uint8_t *win;
+	fp13_t r, t[1 << (FP_WIDTH - 1)];
+
+	if (bn_is_zero(b)) {
+		fp13_set_dig(c, 1);
+		return;
+	}
+
+	fp13_null(r);
+
+	if (bn_bits(b) <= RLC_DIG) {
+		/* Short exponents such as the curve parameter do not pay off the
+		 * table, so use plain square-and-multiply. */
+		RLC_TRY {
+			fp13_new(r);
+
+			fp13_copy(r, a);
+			for (i = bn_bits(b) - 2; i >= 0; i--) {
+				fp13_sqr_cyc(r, r);
+				if (bn_get_bit(b, i)) {
+					fp13_mul(r, r, a);
+				}
+			}
+
+			if (bn_sign(b) == RLC_NEG) {
+				fp13_inv_uni(c, r);
+			} else {
+				fp13_copy(c, r);
+			}
+		}
+		RLC_CATCH_ANY {
+			RLC_THROW(ERR_CAUGHT);
+		}
+		RLC_FINALLY {
+			fp13_free(r);
+		}
+		return;
+	}
+
+	l = bn_bits(b) + 1;
+	win = RLC_ALLOCA(uint8_t, l);
+	for (i = 0; i < (1 << (FP_WIDTH - 1)); i++) {
+		fp13_null(t[i]);
+	}
+
+	RLC_TRY {
+		if (win == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < (1 << (FP_WIDTH - 1)); i++) {
+			fp13_new(t[i]);
+		}
+		fp13_new(r);
+
+		/* Precompute the odd powers a, a^3, ..., a^(2^(w - 1) - 1). */
+		fp13_copy(t[0], a);
+		fp13_sqr_cyc(r, a);
+		for (i = 1; i < (1 << (FP_WIDTH - 1)); i++) {
+			fp13_mul(t[i], t[i - 1], r);
+		}
+
+		fp13_set_dig(r, 1);
+		bn_rec_slw(win, &l, b, FP_WIDTH);
+		for (i = 0; i < l; i++) {
+			if (win[i] == 0) {
+				fp13_sqr_cyc(r, r);
+			} else {
+				for (j = 0; j < util_bits_dig(win[i]); j++) {
+					fp13_sqr_cyc(r, r);
+				}
+				fp13_mul(r, r, t[win[i] >> 1]);
+			}
+		}
+
+		if (bn_sign(b) == RLC_NEG) {
+			fp13_inv_uni(c, r);
+		} else {
+			fp13_copy(c, r);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		for (i = 0; i < (1 << (FP_WIDTH - 1)); i++) {
+			fp13_free(t[i]);
+		}
+		fp13_free(r);
+		RLC_FREE(win);
+	}
+}
+
+void fp13_exp_cyc_sps(fp13_t c, fp13_t a, const int *b, int len, int sign) {
+	int i, j, k, p = 0, n = 0;
+	fp13_t t, u, v;
+
+	if (len == 0) {
+		fp13_set_dig(c, 1);
+		return;
+	}
+
+	fp13_null(t);
+	fp13_null(u);
+	fp13_null(v);
+
+	RLC_TRY {
+		fp13_new(t);
+		fp13_new(u);
+		fp13_new(v);
+
+		/* Inversion is not a conjugation in F_{p^13}, so we accumulate the
+		 * positive digits in u and the negative ones in v. */
+		fp13_copy(t, a);
+		for (j = 0, i = 0; i < len; i++) {
+			k = (b[i] < 0 ? -b[i] : b[i]);
+			for (; j < k; j++) {
+				fp13_sqr_cyc(t, t);
+			}
+			if (b[i] < 0) {
+				if (n++ == 0) {
+					fp13_copy(v, t);
+				} else {
+					fp13_mul(v, v, t);
+				}
+			} else {
+				if (p++ == 0) {
+					fp13_copy(u, t);
+				} else {
+					fp13_mul(u, u, t);
+				}
+			}
+		}
+
+		/* Compute c = u/v or c = v/u with a single unitary inversion. */
+		if (sign == RLC_NEG) {
+			fp13_copy(t, u);
+			fp13_copy(u, v);
+			fp13_copy(v, t);
+			k = p;
+			p = n;
+			n = k;
+		}
+		if (n == 0) {
+			fp13_copy(c, u);
+		} else {
+			fp13_inv_uni(v, v);
+			if (p == 0) {
+				fp13_copy(c, v);
+			} else {
+				fp13_mul(c, u, v);
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp13_free(t);
+		fp13_free(u);
+		fp13_free(v);
+	}
+}
+
 void fp24_conv_cyc(fp24_t c, const fp24_t a) {
 	fp24_t t;
 
@@ -326,26 +326,67 @@ void fp12_exp(fp12_t c, const fp12_t a, const bn_t b) {
 	}
 }
 
-void fp13_exp(fp13_t c,fp13_t a,bn_t b){
-	fp13_t t;
-	fp13_null(t);
-
-	RLC_TRY{
-		fp13_new(t);	
-		fp13_copy(t, a);
-		for(int i = bn_bits(b) - 2; i >= 0; i--){
-			fp13_sqr(t, t);
-			if(bn_get_bit(b,i)){
-				fp13_mul(t, t, a);
+void fp13_exp(fp13_t c, fp13_t a, bn_t b) {
+	int i, j, l;
+	uint8_t *win;
+	fp13_t r, t[1 << (FP_WIDTH - 1)];
+
+	if (bn_is_zero(b)) {
+		fp13_set_dig(c, 1);
+		return;
+	}
+
+	l = bn_bits(b) + 1;
+	win = RLC_ALLOCA(uint8_t, l);
+	fp13_null(r);
+	for (i = 0; i < (1 << (FP_WIDTH - 1)); i++) {
+		fp13_null(t[i]);
+	}
+
+	RLC_TRY {
+		if (win == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < (1 << (FP_WIDTH - 1)); i++) {
+			fp13_new(t[i]);
+		}
+		fp13_new(r);
+
+		/* Precompute the odd powers a, a^3, ..., a^(2^w - 1). */
+		fp13_copy(t[0], a);
+		fp13_sqr(r, a);
+		for (i = 1; i < (1 << (FP_WIDTH - 1)); i++) {
+			fp13_mul(t[i], t[i - 1], r);
+		}
+
+		fp13_set_dig(r, 1);
+		bn_rec_slw(win, &l, b, FP_WIDTH);
+		for (i = 0; i < l; i++) {
+			if (win[i] == 0) {
+				fp13_sqr(r, r);
+			} else {
+				for (j = 0; j < util_bits_dig(win[i]); j++) {
+					fp13_sqr(r, r);
+				}
+				fp13_mul(r, r, t[win[i] >> 1]);
 			}
 		}
-		fp13_copy(c, t);
+
+		if (bn_sign(b) == RLC_NEG) {
+			fp13_inv(c, r);
+		} else {
+			fp13_copy(c, r);
+		}
 	}
-	RLC_CATCH_ANY{
-		RLC_THROW(ERR_CAUGHT);	
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
 	}
-	RLC_FINALLY{
-		fp13_free(t);
+	RLC_FINALLY {
+		for (i = 0; i < (1 << (FP_WIDTH - 1)); i++) {
+			fp13_free(t[i]);
+		}
+		fp13_free(r);
+		RLC_FREE(win);
 	}
 }
 
@@ -379,7 +420,7 @@ void fp12_exp_dig(fp12_t c, const fp12_t a, dig_t b) {
 			l = RLC_DIG + 1;
 			bn_rec_naf(naf, &l, _b, 2);
 
-			for (int i = bn_bits(_b) - 2; i >= 0; i--) {
+			for (int i = l - 2; i >= 0; i--) {
 				fp12_sqr_cyc(t, t);
 
 				u = naf[i];
@@ -511,7 +552,7 @@ void fp24_exp_dig(fp24_t c, const fp24_t a, dig_t b) {
 			l = RLC_DIG + 1;
 			bn_rec_naf(naf, &l, _b, 2);
 
-			for (int i = bn_bits(_b) - 2; i >= 0; i--) {
+			for (int i = l - 2; i >= 0; i--) {
 				fp24_sqr_cyc(t, t);
 
 				u = naf[i];
@@ -611,7 +652,7 @@ void fp48_exp_dig(fp48_t c, const fp48_t a, dig_t b) {
 			l = RLC_DIG + 1;
 			bn_rec_naf(naf, &l, _b, 2);
 
-			for (int i = bn_bits(_b) - 2; i >= 0; i--) {
+			for (int i = l - 2; i >= 0; i--) {
 				fp48_sqr_cyc(t, t);
 
 				u = naf[i];
@@ -707,7 +748,7 @@ void fp54_exp_dig(fp54_t c, const fp54_t a, dig_t b) {
 			l = RLC_DIG + 1;
 			bn_rec_naf(naf, &l, _b, 2);
 
-			for (int i = bn_bits(_b) - 2; i >= 0; i--) {
+			for (int i = l - 2; i >= 0; i--) {
 				fp54_sqr_cyc(t, t);
 
 				u = naf[i];
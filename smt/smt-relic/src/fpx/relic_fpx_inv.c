@@ -39,6 +39,8 @@
 void fp2_inv(fp2_t c, const fp2_t a) {
 	fp_t t0, t1;
 
+	RLC_OPCNT(OP_FP2_INV);
+
 	fp_null(t0);
 	fp_null(t1);
 
@@ -613,6 +615,7 @@ void fp13_inv(fp13_t c,fp13_t a){
 	dv_t u0, u1;
 	fp_t t;	
 	fp13_t t0, t1;
+	RLC_OPCNT(OP_FP13_INV);
 	fp13_null(t0);
 	fp13_null(t1);
 	fp_null(t);
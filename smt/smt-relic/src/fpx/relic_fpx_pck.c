@@ -220,3 +220,99 @@ int fp54_upk(fp54_t c, const fp54_t a) {
 		return 1;
 	}
 }
+
+int fp13_pck(fp13_t c, fp13_t a) {
+	int i, j, k;
+	fp13_t t, u, v[13];
+	fp_t s;
+
+	if (!fp13_test_cyc(a)) {
+		fp13_copy(c, a);
+		return 0;
+	}
+
+	fp13_null(t);
+	fp13_null(u);
+	fp_null(s);
+
+	RLC_TRY {
+		fp13_new(t);
+		fp13_new(u);
+		fp_new(s);
+		for (i = 0; i < 13; i++) {
+			fp13_null(v[i]);
+			fp13_new(v[i]);
+		}
+
+		/* By Hilbert 90, a = b/b^p for some b unique up to a factor in F_p. We
+		 * compute b = sum v_k * e^(p^k) with v_k = a * a^p * ... * a^(p^(k-1)),
+		 * which satisfies a * b^p = b because the norm of a is one. The first
+		 * basis element e = w^j for which b is not zero is chosen. */
+		fp13_set_dig(v[0], 1);
+		fp13_copy(v[1], a);
+		for (k = 2; k < 13; k++) {
+			fp13_frb(t, v[k - 1], 1);
+			fp13_mul(v[k], t, a);
+		}
+		fp13_zero(c);
+		for (j = 0; j < 13 && fp13_is_zero(c); j++) {
+			fp13_zero(u);
+			fp_set_dig(u[j], 1);
+			for (k = 0; k < 13; k++) {
+				if (j == 0) {
+					fp13_add(c, c, v[k]);
+				} else {
+					fp13_mul(t, v[k], u);
+					fp13_add(c, c, t);
+					fp13_frb(u, u, 1);
+				}
+			}
+		}
+
+		/* Normalize b so that its first non-zero coefficient is one. */
+		for (i = 0; fp_is_zero(c[i]); i++);
+		fp_inv(s, c[i]);
+		for (j = i + 1; j < 13; j++) {
+			fp_mul(c[j], c[j], s);
+		}
+		fp_set_dig(c[i], 1);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp13_free(t);
+		fp13_free(u);
+		fp_free(s);
+		for (i = 0; i < 13; i++) {
+			fp13_free(v[i]);
+		}
+	}
+	return 1;
+}
+
+int fp13_upk(fp13_t c, fp13_t a) {
+	fp13_t t;
+
+	if (fp13_is_zero(a)) {
+		return 0;
+	}
+
+	fp13_null(t);
+
+	RLC_TRY {
+		fp13_new(t);
+
+		/* Recover a = b/b^p, which always has norm one. */
+		fp13_frb(t, a, 1);
+		fp13_inv(t, t);
+		fp13_mul(c, a, t);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp13_free(t);
+	}
+	return 1;
+}
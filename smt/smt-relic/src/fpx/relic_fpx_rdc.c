@@ -70,7 +70,7 @@ void fp3_rdc_integ(fp3_t c, dv3_t a) {
 }
 
 void fp13_rdc(fp13_t c, dv13_t a){
-	fp13_do_2(fp_rdc, c, a);
+	fp13_rdcn_low(c, a);
 }
 
 #endif
@@ -297,14 +297,15 @@ int fp4_srt(fp4_t c, const fp4_t a) {
 
 int fp13_srt(fp13_t c, fp13_t a) {
 	int r = 0;
-	fp13_t t0, t1, t2, t3;
+	fp_t n, s;
+	fp13_t t0, t1, t2;
 	bn_t e;
 
+	fp_null(n);
+	fp_null(s);
 	fp13_null(t0);
 	fp13_null(t1);
 	fp13_null(t2);
-	fp13_null(t3);
-
 	bn_null(e);
 
 	if (fp13_is_zero(a)) {
@@ -313,41 +314,52 @@ int fp13_srt(fp13_t c, fp13_t a) {
 	}
 
 	RLC_TRY {
+		fp_new(n);
+		fp_new(s);
 		fp13_new(t0);
 		fp13_new(t1);
 		fp13_new(t2);
-		fp13_new(t3);
-
 		bn_new(e);
+
+		/* Since p = 3 mod 4 and the degree is odd, sqrt(a) = a^((q + 1)/4)
+		 * with (q + 1)/4 = (p + 1)/4 * (1 - p + p^2 - ... + p^12). Writing
+		 * the alternating sum as 2 * (1 + p^2 + ... + p^12) - (1 + p + ... +
+		 * p^12) replaces the odd powers by the norm of t0 = a^((p + 1)/4),
+		 * which is N(a)^((p + 1)/4) = sqrt(N(a)) in the prime field. */
+		fp13_norm(n, a);
+		r = fp_srt(s, n);
+
 		e->used = RLC_FP_DIGS;
 		dv_copy(e->dp, fp_prime_get(), RLC_FP_DIGS);
-		bn_div_dig(e, e, 4);
+		bn_add_dig(e, e, 1);
+		bn_rsh(e, e, 2);
 		fp13_exp(t0, a, e);
-		fp13_mul(t0, t0, a);
-
-		fp13_frb(t1, t0, 1);//t0^p
-		fp13_frb(t2, t1, 2);//t0^p^3
-		fp13_frb(t3, t2, 2);//t0^p^5
-		fp13_mul(t1, t1, t2);
-		fp13_mul(t1, t1, t3);//t0^(p+p^3+p^5)
-		fp13_frb(t2, t1, 6);//t0^(p^7+p^9+p^11)
-		fp13_mul(t1, t1, t2);//t0^(p+p^3+p^5+p^7+p^9+p^11)
-		fp13_frb(t2, t1, 1);//t0^(p^2+p^4+p^6+p^8+p^10+p^12)
-		fp13_mul(t2, t2, t0);//t0^(1+p^2+p^4+p^6+p^8+p^10+p^12)
-		fp13_inv(t1, t1);
-		fp13_mul(c, t1, t2);////t0^(1-p+p^2-p^3+p^4-p^5+p^6-p^7+p^8-p^9+p^10-p^11+p^12)
-		fp13_sqr(t0, c);
-		if (fp13_cmp(t0, a) == RLC_EQ) {
-			r = 1;
+
+		/* t2 = t0^(1 + p^2 + p^4 + ... + p^12). */
+		fp13_frb(t1, t0, 2);
+		fp13_mul(t1, t1, t0);
+		fp13_frb(t2, t1, 4);
+		fp13_mul(t2, t2, t1);
+		fp13_frb(t1, t1, 8);
+		fp13_mul(t2, t2, t1);
+		fp13_frb(t1, t0, 12);
+		fp13_mul(t2, t2, t1);
+		fp13_sqr(t2, t2);
+
+		/* c = t2/N(t0), where N(t0) is in the prime field. */
+		fp_inv(s, s);
+		for (int i = 0; i < 13; i++) {
+			fp_mul(c[i], t2[i], s);
 		}
-			
 	} RLC_CATCH_ANY {
 		RLC_THROW(ERR_CAUGHT);
 	} RLC_FINALLY {
+		fp_free(n);
+		fp_free(s);
 		fp13_free(t0);
 		fp13_free(t1);
 		fp13_free(t2);
-		fp13_free(t3);
+		bn_free(e);
 	}
 	return r;
 }
@@ -531,23 +531,85 @@ void fp13_print(const fp13_t a)
 }
 
 
-void fp13_read_bin(fp13_t a, uint8_t* bin, int len)
-{
-	if (len != 13 * RLC_FP_BYTES)
+int fp13_size_bin(fp13_t a, int pack) {
+	if (pack && fp13_test_cyc(a)) {
+		return 1 + 12 * RLC_FP_BYTES;
+	}
+	return 13 * RLC_FP_BYTES;
+}
+
+void fp13_read_bin(fp13_t a, const uint8_t *bin, int len) {
+	int i, k;
+
+	if (len != 1 + 12 * RLC_FP_BYTES && len != 13 * RLC_FP_BYTES) {
 		RLC_THROW(ERR_NO_BUFFER);
-	fp_read_bin(a[0], bin, RLC_FP_BYTES);
-	fp_read_bin(a[1], bin + RLC_FP_BYTES, RLC_FP_BYTES);
-	fp_read_bin(a[2], bin + 2 * RLC_FP_BYTES, RLC_FP_BYTES);
-	fp_read_bin(a[3], bin + 3 * RLC_FP_BYTES, RLC_FP_BYTES);
-	fp_read_bin(a[4], bin + 4 * RLC_FP_BYTES, RLC_FP_BYTES);
-	fp_read_bin(a[5], bin + 5 * RLC_FP_BYTES, RLC_FP_BYTES);
-	fp_read_bin(a[6], bin + 6 * RLC_FP_BYTES, RLC_FP_BYTES);
-	fp_read_bin(a[7], bin + 7 * RLC_FP_BYTES, RLC_FP_BYTES);
-	fp_read_bin(a[8], bin + 8 * RLC_FP_BYTES, RLC_FP_BYTES);
-	fp_read_bin(a[9], bin + 9 * RLC_FP_BYTES, RLC_FP_BYTES);
-	fp_read_bin(a[10], bin + 10 * RLC_FP_BYTES, RLC_FP_BYTES);
-	fp_read_bin(a[11], bin + 11 * RLC_FP_BYTES, RLC_FP_BYTES);
-	fp_read_bin(a[12], bin + 12 * RLC_FP_BYTES, RLC_FP_BYTES);
+		return;
+	}
+	if (len == 13 * RLC_FP_BYTES) {
+		for (i = 0; i < 13; i++) {
+			fp_read_bin(a[i], bin + i * RLC_FP_BYTES, RLC_FP_BYTES);
+		}
+	} else {
+		/* The first byte indexes the leading coefficient, fixed to one. */
+		k = bin[0];
+		if (k >= 13) {
+			RLC_THROW(ERR_NO_VALID);
+			return;
+		}
+		for (i = 0; i < 13; i++) {
+			if (i == k) {
+				fp_set_dig(a[i], 1);
+			} else {
+				fp_read_bin(a[i], bin + 1 + (i - (i > k)) * RLC_FP_BYTES,
+						RLC_FP_BYTES);
+				if (i < k && !fp_is_zero(a[i])) {
+					RLC_THROW(ERR_NO_VALID);
+					return;
+				}
+			}
+		}
+		fp13_upk(a, a);
+	}
+}
+
+void fp13_write_bin(uint8_t *bin, int len, fp13_t a, int pack) {
+	int i, k;
+	fp13_t t;
+
+	fp13_null(t);
+
+	RLC_TRY {
+		fp13_new(t);
+
+		if (pack) {
+			if (len != 1 + 12 * RLC_FP_BYTES) {
+				RLC_THROW(ERR_NO_BUFFER);
+			} else if (!fp13_pck(t, a)) {
+				RLC_THROW(ERR_NO_VALID);
+			} else {
+				for (k = 0; fp_is_zero(t[k]); k++);
+				bin[0] = k;
+				for (i = 0; i < 13; i++) {
+					if (i != k) {
+						fp_write_bin(bin + 1 + (i - (i > k)) * RLC_FP_BYTES,
+								RLC_FP_BYTES, t[i]);
+					}
+				}
+			}
+		} else {
+			if (len != 13 * RLC_FP_BYTES) {
+				RLC_THROW(ERR_NO_BUFFER);
+			} else {
+				for (i = 0; i < 13; i++) {
+					fp_write_bin(bin + i * RLC_FP_BYTES, RLC_FP_BYTES, a[i]);
+				}
+			}
+		}
+	} RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	} RLC_FINALLY {
+		fp13_free(t);
+	}
 }
 
 void fp13_set_dig(fp13_t a,dig_t b){
@@ -556,49 +618,71 @@ void fp13_set_dig(fp13_t a,dig_t b){
 }
 
 
-int fp13_is_square(fp13_t a) {
-	int r = -1;
-	fp_t u;
-	fp13_t t0;
-	fp13_t t1;
- 
-    fp_null(u);
+void fp13_norm(fp_t c, fp13_t a) {
+	fp_t t;
+	fp13_t t0, t1;
+
+	fp_null(t);
 	fp13_null(t0);
 	fp13_null(t1);
 
-	if (fp13_is_zero(a)) {
-		return 1;
-	}
-
 	RLC_TRY {
+		fp_new(t);
 		fp13_new(t0);
 		fp13_new(t1);
-    	fp13_frb(t0, a, 1);//a^p
-		fp13_frb(t1, a, 2);//a^(p^2)
+
+		/* t0 = a^(1 + p + ... + p^11). */
+		fp13_frb(t0, a, 1);
+		fp13_mul(t0, t0, a);
+		fp13_frb(t1, t0, 2);
 		fp13_mul(t0, t0, t1);
-		fp13_frb(t1, a, 3);//a^(p^3)
-		fp13_mul(t0, t0, t1);//a^p*a^(p^2)*a^(p^3)
-		fp13_frb(t1, t0, 3);//a^(p^4)*a^(p^5)*a^(p^6)
-		fp13_mul(t0, t0, t1);//a^p*a^(p^2)*...*a^(p^6)
-		fp13_frb(t1, t0, 6);//a^(p^7)*...*a^(p^12)
+		fp13_frb(t1, t0, 4);
+		fp13_mul(t1, t1, t0);
+		fp13_frb(t0, t0, 8);
 		fp13_mul(t0, t0, t1);
-		fp13_mul(t0, t0, a);
-		fp_srt(u, t0[0]);
-
-		fp_sqr(u,u);
-		 if(fp_cmp(u, t0[0]) == RLC_EQ)
-		 {
-			 r = 1;
-		 } 
-		
+		fp13_frb(t1, a, 12);
+
+		/* The norm lies in the prime field, so only the constant coefficient
+		 * of t0 * t1 is computed, using w^13 = -2. */
+		fp_mul(c, t0[1], t1[12]);
+		for (int i = 2; i < 13; i++) {
+			fp_mul(t, t0[i], t1[13 - i]);
+			fp_add(c, c, t);
+		}
+		fp_dbl(c, c);
+		fp_mul(t, t0[0], t1[0]);
+		fp_sub(c, t, c);
 	}
 	RLC_CATCH_ANY {
 		RLC_THROW(ERR_CAUGHT);
 	}
 	RLC_FINALLY {
+		fp_free(t);
 		fp13_free(t0);
 		fp13_free(t1);
-		fp_free(u);
+	}
+}
+
+int fp13_is_square(fp13_t a) {
+	fp_t t;
+	int r = 1;
+
+	fp_null(t);
+
+	RLC_TRY {
+		fp_new(t);
+
+		/* Since the degree is odd, a is a square iff its norm is. */
+		fp13_norm(t, a);
+		if (fp_smb(t) == -1) {
+			r = -1;
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp_free(t);
 	}
 	return r;
 }
@@ -23,6 +23,20 @@
 
 #include "relic_fp_low.h"
 
+/* Rename the modulus limbs so that labeled builds can be linked together. */
+#ifdef LABEL
+#define p0			RLC_PREFIX(p0)
+#define p1			RLC_PREFIX(p1)
+#define p2			RLC_PREFIX(p2)
+#define p3			RLC_PREFIX(p3)
+#define p4			RLC_PREFIX(p4)
+#define p5			RLC_PREFIX(p5)
+#define p6			RLC_PREFIX(p6)
+#define p7			RLC_PREFIX(p7)
+#define p8			RLC_PREFIX(p8)
+#define p9			RLC_PREFIX(p9)
+#endif
+
 /**
  * @file
  *
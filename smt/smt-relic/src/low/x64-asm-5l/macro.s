@@ -23,6 +23,16 @@
 
 #include "relic_fp_low.h"
 
+/* Rename the modulus limbs so that labeled builds can be linked together. */
+#ifdef LABEL
+#define p0			RLC_PREFIX(p0)
+#define p1			RLC_PREFIX(p1)
+#define p2			RLC_PREFIX(p2)
+#define p3			RLC_PREFIX(p3)
+#define p4			RLC_PREFIX(p4)
+#define bn_addp_low	RLC_PREFIX(bn_addp_low)
+#endif
+
 /**
  * @file
  *
@@ -46,6 +56,18 @@
 #define P3	0xF28FC5A0B7F9D039
 #define P4	0x1058CA226F60892C
 #define U0	0x55B5E0028B047FFD
+#elif FP_PRIME == 310
+#define P0	0xD89000000019228B
+#define P1	0x76C31BF505591835
+#define P2	0xDC71CEFCABD54C60
+#define P3	0x30C2D95B3183A1C1
+#define P4	0x0035AB7292654E9F
+#define U0	0x6B6F2C4202134ADD
+#endif
+
+/* Use MULX/ADCX/ADOX when the target supports the BMI2 and ADX extensions. */
+#if defined(__BMI2__) && defined(__ADX__)
+#define FP_MULX
 #endif
 
 .text
@@ -240,3 +262,231 @@
 	movq	%r14,24(\C)
 	movq	%rcx,32(\C)
 .endm
+
+#ifdef FP_MULX
+
+/*
+ * Accumulates the row a[i] * b into the window R1..R6 with two independent
+ * carry chains, the low words through CF and the high words through OF.
+ * Expects rdx = a[i], Z = 0 and both flags cleared.
+ */
+.macro MULX_ROW B, R1, R2, R3, R4, R5, R6, Z
+	mulxq	0(\B), %rax, %rbx
+	adcxq	%rax, \R1
+	adoxq	%rbx, \R2
+	mulxq	8(\B), %rax, %rbx
+	adcxq	%rax, \R2
+	adoxq	%rbx, \R3
+	mulxq	16(\B), %rax, %rbx
+	adcxq	%rax, \R3
+	adoxq	%rbx, \R4
+	mulxq	24(\B), %rax, %rbx
+	adcxq	%rax, \R4
+	adoxq	%rbx, \R5
+	mulxq	32(\B), %rax, \R6
+	adcxq	%rax, \R5
+	adoxq	\Z, \R6
+	adcxq	\Z, \R6
+.endm
+
+// Uses rax, rbx, rbp, rdx, r8-r13. A must not be rdx.
+.macro FP_MULX_LOW C, A, B
+	movq	0(\A), %rdx
+	mulxq	0(\B), %rax, %r8
+	movq	%rax, 0(\C)
+	mulxq	8(\B), %rax, %r9
+	addq	%rax, %r8
+	mulxq	16(\B), %rax, %r10
+	adcq	%rax, %r9
+	mulxq	24(\B), %rax, %r11
+	adcq	%rax, %r10
+	mulxq	32(\B), %rax, %r12
+	adcq	%rax, %r11
+	adcq	$0, %r12
+
+	xorl	%ebp, %ebp
+	movq	8(\A), %rdx
+	MULX_ROW \B, %r8, %r9, %r10, %r11, %r12, %r13, %rbp
+	movq	%r8, 8(\C)
+
+	xorl	%ebp, %ebp
+	movq	16(\A), %rdx
+	MULX_ROW \B, %r9, %r10, %r11, %r12, %r13, %r8, %rbp
+	movq	%r9, 16(\C)
+
+	xorl	%ebp, %ebp
+	movq	24(\A), %rdx
+	MULX_ROW \B, %r10, %r11, %r12, %r13, %r8, %r9, %rbp
+	movq	%r10, 24(\C)
+
+	xorl	%ebp, %ebp
+	movq	32(\A), %rdx
+	MULX_ROW \B, %r11, %r12, %r13, %r8, %r9, %r10, %rbp
+	movq	%r11, 32(\C)
+	movq	%r12, 40(\C)
+	movq	%r13, 48(\C)
+	movq	%r8, 56(\C)
+	movq	%r9, 64(\C)
+	movq	%r10, 72(\C)
+.endm
+
+/*
+ * Squaring computes the ten cross products a[i] * a[j] with i < j once,
+ * doubles them and adds the diagonal squares in the same pass.
+ * Uses rax, rbx, rbp, rdx, r8-r15. A must not be rdx.
+ */
+.macro FP_SQRX_LOW C, A
+	movq	0(\A), %rdx
+	mulxq	8(\A), %r8, %r9
+	mulxq	16(\A), %rax, %r10
+	addq	%rax, %r9
+	mulxq	24(\A), %rax, %r11
+	adcq	%rax, %r10
+	mulxq	32(\A), %rax, %r12
+	adcq	%rax, %r11
+	adcq	$0, %r12
+
+	xorl	%ebp, %ebp
+	movq	8(\A), %rdx
+	mulxq	16(\A), %rax, %rbx
+	adcxq	%rax, %r10
+	adoxq	%rbx, %r11
+	mulxq	24(\A), %rax, %rbx
+	adcxq	%rax, %r11
+	adoxq	%rbx, %r12
+	mulxq	32(\A), %rax, %r13
+	adcxq	%rax, %r12
+	adoxq	%rbp, %r13
+	adcxq	%rbp, %r13
+
+	xorl	%ebp, %ebp
+	movq	16(\A), %rdx
+	mulxq	24(\A), %rax, %rbx
+	adcxq	%rax, %r12
+	adoxq	%rbx, %r13
+	mulxq	32(\A), %rax, %r14
+	adcxq	%rax, %r13
+	adoxq	%rbp, %r14
+	adcxq	%rbp, %r14
+
+	movq	24(\A), %rdx
+	mulxq	32(\A), %rax, %r15
+	addq	%rax, %r14
+	adcq	$0, %r15
+
+	xorl	%ebp, %ebp
+	movq	0(\A), %rdx
+	mulxq	%rdx, %rax, %rbx
+	movq	%rax, 0(\C)
+	adcxq	%r8, %r8
+	adoxq	%rbx, %r8
+	movq	%r8, 8(\C)
+	movq	8(\A), %rdx
+	mulxq	%rdx, %rax, %rbx
+	adcxq	%r9, %r9
+	adoxq	%rax, %r9
+	movq	%r9, 16(\C)
+	adcxq	%r10, %r10
+	adoxq	%rbx, %r10
+	movq	%r10, 24(\C)
+	movq	16(\A), %rdx
+	mulxq	%rdx, %rax, %rbx
+	adcxq	%r11, %r11
+	adoxq	%rax, %r11
+	movq	%r11, 32(\C)
+	adcxq	%r12, %r12
+	adoxq	%rbx, %r12
+	movq	%r12, 40(\C)
+	movq	24(\A), %rdx
+	mulxq	%rdx, %rax, %rbx
+	adcxq	%r13, %r13
+	adoxq	%rax, %r13
+	movq	%r13, 48(\C)
+	adcxq	%r14, %r14
+	adoxq	%rbx, %r14
+	movq	%r14, 56(\C)
+	movq	32(\A), %rdx
+	mulxq	%rdx, %rax, %rbx
+	adcxq	%r15, %r15
+	adoxq	%rax, %r15
+	movq	%r15, 64(\C)
+	adcxq	%rbp, %rbx
+	adoxq	%rbp, %rbx
+	movq	%rbx, 72(\C)
+.endm
+
+/*
+ * One step of Montgomery reduction: m = R1 * U0 mod 2^64, then the window
+ * R1..R6 accumulates m * p and R1 becomes zero. Expects rcx = U0, Z = 0.
+ */
+.macro RDCX_ROW R1, R2, R3, R4, R5, R6, Z
+	movq	\R1, %rdx
+	imulq	%rcx, %rdx
+	xorl	%eax, %eax
+	mulxq	p0(%rip), %rax, %rbx
+	adcxq	%rax, \R1
+	adoxq	%rbx, \R2
+	mulxq	p1(%rip), %rax, %rbx
+	adcxq	%rax, \R2
+	adoxq	%rbx, \R3
+	mulxq	p2(%rip), %rax, %rbx
+	adcxq	%rax, \R3
+	adoxq	%rbx, \R4
+	mulxq	p3(%rip), %rax, %rbx
+	adcxq	%rax, \R4
+	adoxq	%rbx, \R5
+	mulxq	p4(%rip), %rax, \R6
+	adcxq	%rax, \R5
+	adoxq	\Z, \R6
+	adcxq	\Z, \R6
+.endm
+
+/*
+ * Montgomery reduction of the lower half, followed by the addition of the
+ * upper half, since (l + h * 2^320 + m * p) / 2^320 = (l + m * p) / 2^320 + h.
+ * Uses rax, rbx, rbp, rcx, rdx, r8-r13.
+ */
+.macro FP_RDCX_LOW C, A
+	movq	$U0, %rcx
+	xorl	%ebp, %ebp
+	movq	0(\A), %r8
+	movq	8(\A), %r9
+	movq	16(\A), %r10
+	movq	24(\A), %r11
+	movq	32(\A), %r12
+
+	RDCX_ROW %r8, %r9, %r10, %r11, %r12, %r13, %rbp
+	RDCX_ROW %r9, %r10, %r11, %r12, %r13, %r8, %rbp
+	RDCX_ROW %r10, %r11, %r12, %r13, %r8, %r9, %rbp
+	RDCX_ROW %r11, %r12, %r13, %r8, %r9, %r10, %rbp
+	RDCX_ROW %r12, %r13, %r8, %r9, %r10, %r11, %rbp
+
+	addq	40(\A), %r13
+	adcq	48(\A), %r8
+	adcq	56(\A), %r9
+	adcq	64(\A), %r10
+	adcq	72(\A), %r11
+
+	movq	%r13, %rax
+	movq	%r8, %rbx
+	movq	%r9, %rcx
+	movq	%r10, %rdx
+	movq	%r11, %rbp
+	subq	p0(%rip), %rax
+	sbbq	p1(%rip), %rbx
+	sbbq	p2(%rip), %rcx
+	sbbq	p3(%rip), %rdx
+	sbbq	p4(%rip), %rbp
+	cmovc	%r13, %rax
+	cmovc	%r8, %rbx
+	cmovc	%r9, %rcx
+	cmovc	%r10, %rdx
+	cmovc	%r11, %rbp
+	movq	%rax, 0(\C)
+	movq	%rbx, 8(\C)
+	movq	%rcx, 16(\C)
+	movq	%rdx, 24(\C)
+	movq	%rbp, 32(\C)
+.endm
+
+#endif /* FP_MULX */
@@ -37,6 +37,43 @@
 .global fp_muln_low
 .global fp_mulm_low
 
+#ifdef FP_MULX
+
+fp_muln_low:
+	push	%r12
+	push	%r13
+	push 	%rbx
+	push	%rbp
+
+	movq 	%rdx,%rcx
+	FP_MULX_LOW %rdi, %rsi, %rcx
+
+	pop		%rbp
+	pop		%rbx
+	pop		%r13
+	pop		%r12
+	ret
+
+fp_mulm_low:
+	push	%r12
+	push	%r13
+	push 	%rbx
+	push	%rbp
+	subq 	$80, %rsp
+
+	movq 	%rdx,%rcx
+	FP_MULX_LOW %rsp, %rsi, %rcx
+	FP_RDCX_LOW %rdi, %rsp
+
+	addq	$80, %rsp
+	pop		%rbp
+	pop		%rbx
+	pop		%r13
+	pop		%r12
+	ret
+
+#else
+
 fp_muln_low:
 	movq %rdx,%rcx
 	FP_MULN_LOW %rdi, %r8, %r9, %r10, %rsi, %rcx
@@ -67,3 +104,5 @@ fp_mulm_low:
 	pop		%r13
 	pop		%r12
 	ret
+
+#endif
@@ -44,6 +44,20 @@
  * Output: rax
  */
 fp_rdcn_low:
+#ifdef FP_MULX
+	push	%r12
+	push	%r13
+	push 	%rbx
+	push	%rbp
+
+	FP_RDCX_LOW %rdi, %rsi
+
+	pop		%rbp
+	pop		%rbx
+	pop		%r13
+	pop		%r12
+	ret
+#else
 	push	%r12
 	push	%r13
 	push	%r14
@@ -61,3 +75,4 @@ fp_rdcn_low:
 	pop		%r13
 	pop		%r12
 	ret
+#endif
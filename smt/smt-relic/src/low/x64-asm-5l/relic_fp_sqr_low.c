@@ -39,6 +39,9 @@
 /* Public definitions                                                         */
 /*============================================================================*/
 
+/* With BMI2 and ADX, dedicated squaring is implemented in assembly. */
+#if !defined(__BMI2__) || !defined(__ADX__)
+
 void fp_sqrn_low(dig_t *c, const dig_t *a) {
 	fp_muln_low(c, a, a);
 }
@@ -46,3 +49,5 @@ void fp_sqrn_low(dig_t *c, const dig_t *a) {
 void fp_sqrm_low(dig_t *c, const dig_t *a) {
 	fp_mulm_low(c, a, a);
 }
+
+#endif
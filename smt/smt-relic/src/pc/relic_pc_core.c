@@ -39,6 +39,11 @@
 
 void pc_core_init(void) {
 	gt_new(core_get()->gt_g);
+	core_get()->g2_val_num = 0;
+	g2_key_null(core_get()->g2_g);
+	g2_key_new(core_get()->g2_g);
+	/* The table of the generator of G_T is large, so build it on first use. */
+	gt_pre_null(core_get()->gt_p);
 }
 
 void pc_core_calc(void) {
@@ -60,6 +65,16 @@ void pc_core_calc(void) {
 
 		pc_map(gt, g1, g2);
 		gt_copy(core_get()->gt_g, gt);
+		/* The table of a previous generator is no longer valid. */
+		gt_pre_free(core_get()->gt_p);
+		/* Elements validated for a previous curve are no longer valid. */
+		core_get()->g2_val_num = 0;
+		/* The generator is valid by construction, so skip the test. */
+		g2_norm(core_get()->g2_g->q, g2);
+		core_get()->g2_g->valid = 1;
+#if defined(RLC_PC_PRE)
+		pp_pre_k12(core_get()->g2_g->t, g2);
+#endif
 	} RLC_CATCH_ANY {
 		RLC_THROW(ERR_CAUGHT);
 	} RLC_FINALLY {
@@ -73,5 +88,7 @@ void pc_core_clean(void) {
 	ctx_t *ctx = core_get();
 	if (ctx != NULL) {
 		gt_free(core_get()->gt_g);
+		g2_key_free(core_get()->g2_g);
+		gt_pre_free(core_get()->gt_p);
 	}
 }
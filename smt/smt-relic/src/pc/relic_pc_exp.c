@@ -28,6 +28,8 @@
  * @ingroup pc
  */
 
+#include <stdlib.h>
+
 #include "relic_pc.h"
 #include "relic_core.h"
 
@@ -226,28 +228,117 @@ void gt_exp_sim(gt_t e, const gt_t a, const bn_t b, const gt_t c, const bn_t d)
 	}
 }
 
+void gt_exp_sim_lot(gt_t c, const gt_t a[], const bn_t b[], int n) {
+	int i;
+	bn_t ord, *_b = (bn_t *)calloc(n > 0 ? n : 1, sizeof(bn_t));
+
+	bn_null(ord);
+
+	RLC_TRY {
+		if (_b == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		bn_new(ord);
+		for (i = 0; i < n; i++) {
+			bn_null(_b[i]);
+			bn_new(_b[i]);
+		}
+
+		pc_get_ord(ord);
+		for (i = 0; i < n; i++) {
+			bn_mod(_b[i], b[i], ord);
+		}
+#if defined(RLC_GT_PRE)
+		fp12_exp_cyc_sim_lot(c, a, _b, n);
+#else
+		gt_t t;
+
+		gt_null(t);
+		gt_new(t);
+		gt_set_unity(c);
+		for (i = 0; i < n; i++) {
+			RLC_CAT(RLC_GT_LOWER, exp_cyc)(t, a[i], _b[i]);
+			gt_mul(c, c, t);
+		}
+		gt_free(t);
+#endif
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(ord);
+		if (_b != NULL) {
+			for (i = 0; i < n; i++) {
+				bn_free(_b[i]);
+			}
+		}
+		free(_b);
+	}
+}
+
 void gt_exp_gen(gt_t c, const bn_t b) {
+	ctx_t *ctx = core_get();
+
+	if (ctx->gt_p == NULL) {
+		gt_pre_new(ctx->gt_p);
+		if (ctx->gt_p == NULL) {
+			return;
+		}
+		gt_exp_pre(ctx->gt_p, ctx->gt_g);
+	}
+	gt_exp_fix(c, ctx->gt_p, b);
+}
+
+void gt_pre_make(gt_pre_t t) {
+	gt_null(t->a);
+	gt_new(t->a);
+#if defined(RLC_GT_PRE)
+	for (int i = 0; i < RLC_FP12_TABLE; i++) {
+		fp2_null(t->t[i]);
+		fp2_new(t->t[i]);
+		fp2_zero(t->t[i]);
+	}
+#endif
+}
+
+void gt_pre_clean(gt_pre_t t) {
+	gt_free(t->a);
+#if defined(RLC_GT_PRE)
+	for (int i = 0; i < RLC_FP12_TABLE; i++) {
+		fp2_free(t->t[i]);
+	}
+#endif
+}
+
+void gt_exp_pre(gt_pre_t t, const gt_t a) {
+	gt_copy(t->a, a);
+#if defined(RLC_GT_PRE)
+	fp12_exp_cyc_pre(t->t, a);
+#endif
+}
+
+void gt_exp_fix(gt_t c, const gt_pre_t t, const bn_t b) {
 	bn_t n, _b;
-	gt_t g;
 
 	bn_null(n);
 	bn_null(_b);
-	gt_null(g);
 
 	RLC_TRY {
 		bn_new(n);
 		bn_new(_b);
-		gt_new(g);
 
 		pc_get_ord(n);
 		bn_mod(_b, b, n);
-		gt_get_gen(g);
-		gt_exp(c, g, _b);
+#if defined(RLC_GT_PRE)
+		fp12_exp_cyc_fix(c, t->t, _b);
+#else
+		RLC_CAT(RLC_GT_LOWER, exp_cyc)(c, t->a, _b);
+#endif
 	} RLC_CATCH_ANY {
 		RLC_THROW(ERR_CAUGHT);
 	} RLC_FINALLY {
 		bn_free(n);
 		bn_free(_b);
-		gt_free(g);
 	}
 }
@@ -0,0 +1,141 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (c) 2020 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+/**
+ * @file
+ *
+ * Implementation of G_2 elements prepared for repeated pairings.
+ *
+ * @ingroup pc
+ */
+
+#include "relic_pc.h"
+#include "relic_core.h"
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+void g2_key_make(g2_key_t k) {
+	g2_null(k->q);
+	g2_new(k->q);
+	k->valid = 0;
+#if defined(RLC_PC_PRE)
+	for (int i = 0; i < RLC_PP_TABLE_K12; i++) {
+		fp2_null(k->t[i]);
+		fp2_new(k->t[i]);
+		fp2_zero(k->t[i]);
+	}
+#endif
+}
+
+void g2_key_clean(g2_key_t k) {
+	g2_free(k->q);
+	k->valid = 0;
+#if defined(RLC_PC_PRE)
+	for (int i = 0; i < RLC_PP_TABLE_K12; i++) {
+		fp2_free(k->t[i]);
+	}
+#endif
+}
+
+int g2_key_set(g2_key_t k, const g2_t q) {
+	RLC_TRY {
+		g2_norm(k->q, q);
+		k->valid = g2_is_valid_cached(k->q);
+#if defined(RLC_PC_PRE)
+		if (k->valid) {
+			pp_pre_k12(k->t, k->q);
+		} else {
+			/* An empty table makes the pairing trivial. */
+			for (int i = 0; i < RLC_PP_TABLE_K12; i++) {
+				fp2_zero(k->t[i]);
+			}
+		}
+#endif
+	}
+	RLC_CATCH_ANY {
+		k->valid = 0;
+		RLC_THROW(ERR_CAUGHT);
+	}
+	return k->valid;
+}
+
+g2_key_t g2_key_get_gen(void) {
+	return core_get()->g2_g;
+}
+
+void pc_map_key(gt_t r, const g1_t p, const g2_key_t k) {
+#if defined(RLC_PC_PRE)
+	pp_map_pre_k12(r, p, k->t);
+#else
+	pc_map(r, p, k->q);
+#endif
+}
+
+void pc_map_sim_key(gt_t r, const g1_t *p, const g2_key_t *k, int m) {
+#if defined(RLC_PC_PRE)
+	fp2_t **t = RLC_ALLOCA(fp2_t *, m);
+
+	RLC_TRY {
+		if (t == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (int i = 0; i < m; i++) {
+			t[i] = k[i]->t;
+		}
+		pp_map_sim_pre_k12(r, p, t, m);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		RLC_FREE(t);
+	}
+#else
+	g2_t *q = RLC_ALLOCA(g2_t, m);
+	int i;
+
+	RLC_TRY {
+		if (q == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < m; i++) {
+			g2_null(q[i]);
+			g2_new(q[i]);
+			g2_copy(q[i], k[i]->q);
+		}
+		pc_map_sim(r, p, q, m);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		if (q != NULL) {
+			for (i = 0; i < m; i++) {
+				g2_free(q[i]);
+			}
+		}
+		RLC_FREE(q);
+	}
+#endif
+}
@@ -30,6 +30,7 @@
 
 #include "relic_pc.h"
 #include "relic_core.h"
+#include "relic_md.h"
 
 /*============================================================================*/
 /* Private definitions                                                        */
@@ -43,6 +44,52 @@
  */
 #define gt_rand_imp(A)			RLC_CAT(RLC_GT_LOWER, rand)(A)
 
+/**
+ * Checks if an element of the cyclotomic subgroup of F_{p^13} has order r by
+ * checking that a^(z^2 - z * p + p^2) = 1.
+ *
+ * @param[in] a				- the element to check.
+ * @return 1 if the element has order r, 0 otherwise.
+ */
+static int gt_is_ord_bw13(fp13_t a) {
+	bn_t n;
+	fp13_t u0, u1, u2;
+	int r = 0;
+
+	bn_null(n);
+	fp13_null(u0);
+	fp13_null(u1);
+	fp13_null(u2);
+
+	RLC_TRY {
+		bn_new(n);
+		fp13_new(u0);
+		fp13_new(u1);
+		fp13_new(u2);
+
+		fp_prime_get_par(n);
+		bn_neg(n, n);
+		fp13_exp_cyc(u0, a, n);
+		fp13_exp_cyc(u1, u0, n);
+		fp13_frb(u0, u0, 1);
+		fp13_frb(u2, a, 2);
+		fp13_mul(u0, u0, u1);
+		fp13_mul(u0, u0, u2);
+
+		r = (fp13_cmp_dig(u0, 1) == RLC_EQ);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(n);
+		fp13_free(u0);
+		fp13_free(u1);
+		fp13_free(u2);
+	}
+	return r;
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -250,7 +297,8 @@ int g2_is_valid_bn(const g2_t a) {
 
 	bn_t  n;
 	g2_t u0, u1, u2, u3;
-	int r = 0;
+	int l, r = 0;
+	const int *b;
 
 	bn_null(n);
 	g2_null(u0);
@@ -264,19 +312,11 @@ int g2_is_valid_bn(const g2_t a) {
 		g2_new(u2);
 		g2_new(u3);
 
-       		 fp_prime_get_par(n);
+		fp_prime_get_par(n);
+		b = fp_prime_get_par_sps(&l);
 
 		/* Compute u0=[n]a. */
-			g2_copy(u0, a);
-			for (int i = bn_bits(n) - 2; i >= 0; i--) {
-				g2_dbl(u0, u0);
-				if (bn_get_bit(n, i)) {
-					g2_add(u0, u0, a);
-				}
-			}
-		if (bn_sign(n) == RLC_NEG) {
-			g2_neg(u0, u0);
-			}
+		g2_mul_sps(u0, a, b, l, bn_sign(n));
 		/*Compute u1=[2n]a+[(n+1)^p]a+[n^(p^3)]a*/
 
 		g2_dbl(u1, u0);
@@ -305,9 +345,147 @@ int g2_is_valid_bn(const g2_t a) {
 	return r;
 }
 
+int g2_is_valid_bn_batch(int *res, const g2_t *a, int n) {
+	int i, j, k, m, r = 1;
+	int *idx = RLC_ALLOCA(int, n);
+	g2_t *t = RLC_ALLOCA(g2_t, n);
+	g2_t *u = RLC_ALLOCA(g2_t, n);
+	g2_t v, w;
+	fp2_t z2, z3;
+	bn_t z;
+
+	if (n <= 0) {
+		RLC_FREE(idx);
+		RLC_FREE(t);
+		RLC_FREE(u);
+		return 0;
+	}
+
+	bn_null(z);
+	g2_null(v);
+	g2_null(w);
+	fp2_null(z2);
+	fp2_null(z3);
+
+	RLC_TRY {
+		if (idx == NULL || t == NULL || u == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < n; i++) {
+			g2_null(t[i]);
+			g2_null(u[i]);
+			g2_new(t[i]);
+			g2_new(u[i]);
+		}
+		bn_new(z);
+		g2_new(v);
+		g2_new(w);
+		fp2_new(z2);
+		fp2_new(z3);
+
+		/* Points at infinity are rejected and kept out of the batch. */
+		m = 0;
+		for (i = 0; i < n; i++) {
+			res[i] = 0;
+			if (!g2_is_infty(a[i])) {
+				g2_copy(t[m], a[i]);
+				idx[m++] = i;
+			}
+		}
+
+		if (m > 0) {
+			/* Normalize inputs together, so additions below are mixed. */
+			g2_norm_sim(t, t, m);
+
+			/* Compute u[j] = [z]t[j] for all points with one scan of z. */
+			fp_prime_get_par(z);
+			for (j = 0; j < m; j++) {
+				g2_copy(u[j], t[j]);
+			}
+			for (i = bn_bits(z) - 2; i >= 0; i--) {
+				for (j = 0; j < m; j++) {
+					g2_dbl(u[j], u[j]);
+					if (bn_get_bit(z, i)) {
+						g2_add(u[j], u[j], t[j]);
+					}
+				}
+			}
+
+			/* If [z]t = 0, then u0 = 0 and u1 = t^p, so t is invalid. */
+			k = 0;
+			for (j = 0; j < m; j++) {
+				if (!g2_is_infty(u[j])) {
+					if (k != j) {
+						g2_copy(u[k], u[j]);
+						g2_copy(t[k], t[j]);
+						idx[k] = idx[j];
+					}
+					k++;
+				}
+			}
 
+			/* Normalize all [z]t together, so both sides of the comparison
+			 * below are obtained from affine points. */
+			if (k > 0) {
+				g2_norm_sim(u, u, k);
+			}
 
+			for (j = 0; j < k; j++) {
+				if (bn_sign(z) == RLC_NEG) {
+					g2_neg(u[j], u[j]);
+				}
+				/* Compute v = [2z]t + [(z + 1)p]t + [z p^3]t. */
+				g2_dbl(v, u[j]);
+				g2_add(w, u[j], t[j]);
+				g2_frb(w, w, 1);
+				g2_add(v, v, w);
+				g2_frb(w, u[j], 3);
+				g2_add(v, v, w);
+				/* Compute w = [z p^2]t, which is still affine. */
+				g2_frb(w, u[j], 2);
+
+				/* Check that w = v with x_w * z_v^2 = x_v, y_w * z_v^3 = y_v,
+				 * so that no further inversion is needed. */
+				if (g2_is_infty(v)) {
+					continue;
+				}
+				if (v->coord == BASIC) {
+					res[idx[j]] = (g2_cmp(w, v) == RLC_EQ);
+				} else {
+					fp2_sqr(z2, v->z);
+					fp2_mul(z3, z2, v->z);
+					fp2_mul(z2, z2, w->x);
+					fp2_mul(z3, z3, w->y);
+					res[idx[j]] = (fp2_cmp(z2, v->x) == RLC_EQ) &&
+							(fp2_cmp(z3, v->y) == RLC_EQ);
+				}
+				res[idx[j]] &= g2_on_curve(t[j]);
+			}
+		}
 
+		for (i = 0; i < n; i++) {
+			r &= res[i];
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		for (i = 0; i < n; i++) {
+			g2_free(t[i]);
+			g2_free(u[i]);
+		}
+		bn_free(z);
+		g2_free(v);
+		g2_free(w);
+		fp2_free(z2);
+		fp2_free(z3);
+		RLC_FREE(idx);
+		RLC_FREE(t);
+		RLC_FREE(u);
+	}
+	return r;
+}
 
 int gt_is_valid(const gt_t a) {
 	bn_t p, n;
@@ -406,6 +584,63 @@ int gt_is_valid(const gt_t a) {
 	return r;
 }
 
+int g2_is_valid_cached(const g2_t a) {
+	ctx_t *ctx = core_get();
+	uint8_t h[32], *bin;
+	int i, len, r = 0;
+
+	/* The cache only proves subgroup membership for points on the curve. */
+	if (g2_is_infty(a) || !g2_on_curve(a)) {
+		return 0;
+	}
+
+	/* Hash both coordinates, since the compressed encoding ignores most of
+	 * the y-coordinate. */
+	len = g2_size_bin(a, 0);
+	bin = RLC_ALLOCA(uint8_t, len);
+
+	RLC_TRY {
+		if (bin == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+
+		g2_write_bin(bin, len, a, 0);
+		md_map_sh256(h, bin, len);
+
+		for (i = 0; i < RLC_MIN(ctx->g2_val_num, RLC_G2_CACHE); i++) {
+			if (memcmp(ctx->g2_val[i], h, sizeof(h)) == 0) {
+				r = 1;
+				break;
+			}
+		}
+
+		if (r == 0) {
+			if (ep_curve_is_pairf() == EP_BN) {
+				r = g2_is_valid_bn(a);
+			} else {
+				r = g2_is_valid(a);
+			}
+			if (r) {
+				/* Replace the oldest entry once the cache is full. */
+				memcpy(ctx->g2_val[ctx->g2_val_num % RLC_G2_CACHE], h,
+						sizeof(h));
+				ctx->g2_val_num++;
+				if (ctx->g2_val_num == 2 * RLC_G2_CACHE) {
+					ctx->g2_val_num = RLC_G2_CACHE;
+				}
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		RLC_FREE(bin);
+	}
+
+	return r;
+}
+
 int gt_is_valid_bn(const gt_t a) {
 	bn_t p, n;
 	gt_t u0, u1, u2, u3;
@@ -467,10 +702,94 @@ int gt_is_valid_bn(const gt_t a) {
 	}
 	return r;
 }
+
+int pc_validate_bn(const g1_t p, const g2_t q, const gt_t e) {
+	bn_t z;
+	g2_t t, u[2], v;
+	gt_t a, b, c;
+	int l, r = 0;
+	const int *s;
+
+	if (g1_is_infty(p) || g2_is_infty(q) || gt_is_unity(e)) {
+		return 0;
+	}
+
+	bn_null(z);
+	g2_null(t);
+	g2_null(u[0]);
+	g2_null(u[1]);
+	g2_null(v);
+	gt_null(a);
+	gt_null(b);
+	gt_null(c);
+
+	RLC_TRY {
+		bn_new(z);
+		g2_new(t);
+		g2_new(u[0]);
+		g2_new(u[1]);
+		g2_new(v);
+		gt_new(a);
+		gt_new(b);
+		gt_new(c);
+
+		/* BN curves have prime order, so G_1 membership is the curve
+		 * equation; the cheap tests go first to skip the chains below. */
+		r = g1_on_curve(p) && g2_on_curve(q) && fp12_test_cyc((void *)e);
+
+		if (r) {
+			fp_prime_get_par(z);
+			s = fp_prime_get_par_sps(&l);
+
+			/* Compute u[0] = [z]q from the sparse form of z, with mixed
+			 * additions against the normalized q. */
+			g2_norm(t, q);
+			g2_mul_sps(u[0], t, s, l, bn_sign(z));
+
+			/* Compute a = e^z with the same sparse form. */
+			fp12_exp_cyc_sps((void *)a, (void *)e, s, l, bn_sign(z));
+
+			/* Compute u[1] = [2z]q + [(z + 1)p]q + [z p^3]q and
+			 * u[0] = [z p^2]q, and the same exponents over e. */
+			g2_dbl(u[1], u[0]);
+			g2_add(v, u[0], t);
+			g2_frb(v, v, 1);
+			g2_add(u[1], u[1], v);
+			g2_frb(v, u[0], 3);
+			g2_add(u[1], u[1], v);
+			g2_frb(u[0], u[0], 2);
+
+			gt_sqr(b, a);
+			gt_mul(c, a, e);
+			gt_frb(c, c, 1);
+			gt_mul(b, b, c);
+			gt_frb(c, a, 3);
+			gt_mul(b, b, c);
+			gt_frb(a, a, 2);
+
+			/* A single comparison in G_2 is cheaper by cross-multiplication
+			 * than by normalizing both sides. */
+			r = (g2_cmp(u[0], u[1]) == RLC_EQ) && (gt_cmp(a, b) == RLC_EQ);
+		}
+	} RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	} RLC_FINALLY {
+		bn_free(z);
+		g2_free(t);
+		g2_free(u[0]);
+		g2_free(u[1]);
+		g2_free(v);
+		gt_free(a);
+		gt_free(b);
+		gt_free(c);
+	}
+	return r;
+}
 int g1_is_valid_bw13(const ep_t a) {
 	bn_t  n;
 	ep_t u0, u1, u2;
-	int r = 0;
+	int l, r = 0;
+	const int *b;
 
 	if (ep_is_infty(a)) {
 		return 0;
@@ -489,20 +808,21 @@ int g1_is_valid_bw13(const ep_t a) {
 		/*[a0,a1]=[−(z^7 + z)(z^4 + z^3 − z − 1),a0 · z − 1]*/
 		/*checking a0*a+a1*psi(a)=0, where psi() is a GLV endorphism*/
 		fp_prime_get_par(n);
-		ep_mul_basic(u0, a, n);
-		ep_mul_basic(u1, u0, n);
-		ep_mul_basic(u1, u1, n);
-		ep_mul_basic(u2, u1, n);
+		b = fp_prime_get_par_sps(&l);
+		ep_mul_sps(u0, a, b, l, bn_sign(n));
+		ep_mul_sps(u1, u0, b, l, bn_sign(n));
+		ep_mul_sps(u1, u1, b, l, bn_sign(n));
+		ep_mul_sps(u2, u1, b, l, bn_sign(n));
 		ep_add(u0, u0, a);
 		ep_add(u1, u1, u2);
 		ep_sub(u0, u1, u0);
-		ep_mul_basic(u0, u0, n);
-		ep_mul_basic(u1, u0, n);
-                for(int i = 0; i < 5; i++)ep_mul_basic(u1, u1, n);
+		ep_mul_sps(u0, u0, b, l, bn_sign(n));
+		ep_mul_sps(u1, u0, b, l, bn_sign(n));
+                for(int i = 0; i < 5; i++)ep_mul_sps(u1, u1, b, l, bn_sign(n));
 		ep_add(u0, u0, u1);
 		ep_neg(u0, u0);
 
-		ep_mul_basic(u1, u0, n);
+		ep_mul_sps(u1, u0, b, l, bn_sign(n));
 		ep_sub(u1, a, u1);
            	ep_psi(u1, u1);
 
@@ -577,63 +897,11 @@ int g2_is_valid_bw13(const ep13_t a) {
 }
 
 int gt_is_valid_bw13(const fp13_t a) {
-	bn_t  n;
-	fp13_t u0, u1, u2, u3;
-	int r = 0;
-
-	if (fp13_is_zero(a)||(fp13_cmp_dig(a,1) == RLC_EQ)) {
+	if (fp13_is_zero(a) || (fp13_cmp_dig(a, 1) == RLC_EQ)) {
 		return 0;
 	}
 
-	bn_null(n);
-	fp13_null(u0);
-	fp13_null(u1);
-	fp13_null(u2);
-	fp13_null(u3);
-	RLC_TRY {
-		bn_new(n);
-		fp13_new(u0);
-		fp13_new(u1);
-		fp13_new(u2);
-		fp13_new(u3);
-		fp_prime_get_par(n);
-		bn_neg(n,n);
-
-		/*checking a is a element of cyclotomic subgroup of F^13_{p}*/
-		fp13_frb(u1, a, 1);
-		fp13_frb(u2, a, 2);
-		fp13_mul(u1, u1, u2);
-		fp13_frb(u2, u1, 2);
-		fp13_mul(u1, u1, u2);
-
-		fp13_frb(u2, u1, 4);
-		fp13_frb(u0, u2, 4);	
-		fp13_mul(u1, u0, u1);	
-		fp13_mul(u1, u1, u2);
-		fp13_mul(u1, u1, a);
-
-	        /*the vector C is selected as [z^2, -z, 1]. Checking a^(z^2-z*p+p^2)=1*/
-           	fp13_exp(u0, a, n);
-		fp13_exp(u3, u0, n);
-		fp13_frb(u0, u0, 1);
-		fp13_frb(u2, a, 2);
-		fp13_mul(u0, u0, u3);
-		fp13_mul(u0, u0, u2);
-	
-		r =  (fp13_cmp_dig(u0,1) == RLC_EQ) && (fp13_cmp_dig(u1,1) == RLC_EQ);
-
-		} 	
-	RLC_CATCH_ANY {
-		RLC_THROW(ERR_CAUGHT);
-	} RLC_FINALLY {
-		bn_free(n);
-		fp13_free(u0);
-		fp13_free(u1);
-		fp13_free(u2);
-		fp13_free(u3);
-
-	}
-	return r;
+	/* The vector C is selected as [z^2, -z, 1]. */
+	return fp13_test_cyc(a) && gt_is_ord_bw13(a);
 }
 
-
@@ -70,11 +70,11 @@ void pp_exp_bwk13(fp13_t c, fp13_t l1, fp13_t l2) {
 		fp13_mul(a1, a1, t);
 	
 		/*compute a^(x^i) for i=1,2,3,4,5*/
-		fp13_exp(t0_den, a1, x);//x
-		fp13_exp(t11_num, t0_den, x);//x^2=t0_num
-		fp13_exp(t10_den, t11_num, x);//x^3
-		fp13_exp(t11_den, t10_den, x);//x^4
-		fp13_exp(t10_num, t11_den, x);//x^5
+		fp13_exp_cyc(t0_den, a1, x);//x
+		fp13_exp_cyc(t11_num, t0_den, x);//x^2=t0_num
+		fp13_exp_cyc(t10_den, t11_num, x);//x^3
+		fp13_exp_cyc(t11_den, t10_den, x);//x^4
+		fp13_exp_cyc(t10_num, t11_den, x);//x^5
 
 		/*add x^i(i <= 5) t0 t_i_den and t_i_num*/
 		fp13_mul(t12_num, t0_den, a1);//x+1
@@ -90,19 +90,19 @@ void pp_exp_bwk13(fp13_t c, fp13_t l1, fp13_t l2) {
 
                 /*compute t = a1^(x^14+x^13+x^12)*/
 		fp13_mul(t, t10_num, t);
-		for(int i = 0; i<9; i++)fp13_exp(t,t,x);
+		for(int i = 0; i<9; i++)fp13_exp_cyc(t, t, x);
 	
 		/*compute t0_den, t0_num, t10_den, t10_num, t11_den, t11_num, t12_den, t12_num*/
 		fp13_mul(t0_num, t11_num, t);
-		fp13_exp(t, t, x);
+		fp13_exp_cyc(t, t, x);
 		fp13_mul(t0_num, t0_num, t);
 
-		fp13_exp(t12_den, t, x);
+		fp13_exp_cyc(t12_den, t, x);
 		fp13_mul(t11_den, t11_den, t12_den);
 	        
-		fp13_exp(t, t12_den, x);
+		fp13_exp_cyc(t, t12_den, x);
 		fp13_mul(t10_num, t10_num, t);
-		fp13_exp(t, t, x);
+		fp13_exp_cyc(t, t, x);
 		fp13_mul(t10_num, t10_num, t);
 
 		/*compute t= a1^(t10 + t11*p + t12*p^2)*/	
@@ -121,17 +121,17 @@ void pp_exp_bwk13(fp13_t c, fp13_t l1, fp13_t l2) {
 		fp13_mul(t, t10_den, t10_num);
 		
 		/*compute t^(x^3),t^(x^6), t^(x^9)*/
-		fp13_exp(t10_den, t, x);
-		fp13_exp(t10_den, t10_den, x);
-		fp13_exp(t10_den, t10_den, x);
+		fp13_exp_cyc(t10_den, t, x);
+		fp13_exp_cyc(t10_den, t10_den, x);
+		fp13_exp_cyc(t10_den, t10_den, x);
 
-		fp13_exp(t11_den, t10_den, x);
-		fp13_exp(t11_den, t11_den, x);
-		fp13_exp(t11_den, t11_den, x);
+		fp13_exp_cyc(t11_den, t10_den, x);
+		fp13_exp_cyc(t11_den, t11_den, x);
+		fp13_exp_cyc(t11_den, t11_den, x);
 
-		fp13_exp(t12_den, t11_den, x);
-		fp13_exp(t12_den, t12_den, x);
-		fp13_exp(t12_den, t12_den, x);
+		fp13_exp_cyc(t12_den, t11_den, x);
+		fp13_exp_cyc(t12_den, t12_den, x);
+		fp13_exp_cyc(t12_den, t12_den, x);
 
 		/*t^((x^9+3)*p + x^6*p^4 + x^3*p^7 + p^10)*/
 		fp13_frb(t, t, 10);
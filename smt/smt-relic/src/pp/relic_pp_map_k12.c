@@ -29,6 +29,8 @@
  * @ingroup pp
  */
 
+#include <stdlib.h>
+
 #include "relic_core.h"
 #include "relic_pp.h"
 #include "relic_util.h"
@@ -230,6 +232,265 @@ static void pp_fin_k12_oatep(fp12_t r, ep2_t t, ep2_t q, ep_t p) {
 	}
 }
 
+/**
+ * Advances a point through one step of the Miller loop of optimal ate pairings
+ * with k = 12 and stores the three coefficients of the sparse line function.
+ * Each coefficient is scaled by the first, the second or no coordinate of the
+ * G_1 argument, so the coefficients are the line evaluated at P = (1, 1).
+ *
+ * @param[out] c			- the coefficients of the line function.
+ * @param[in, out] t		- the point in the Miller loop.
+ * @param[in] q				- the point to add, or NULL for doubling.
+ */
+static void pp_pre_lin_k12(fp2_t *c, ep2_t t, const ep2_t q) {
+	fp12_t l;
+	ep_t u;
+	int one = 1, zero = 0;
+
+	fp12_null(l);
+	ep_null(u);
+
+	RLC_TRY {
+		fp12_new(l);
+		ep_new(u);
+
+		fp12_zero(l);
+		fp_set_dig(u->x, 1);
+		fp_set_dig(u->y, 1);
+		fp_set_dig(u->z, 1);
+		u->coord = BASIC;
+
+		if (q == NULL) {
+			pp_dbl_k12(l, t, t, u);
+		} else {
+			pp_add_k12(l, t, q, u);
+		}
+
+		if (ep2_curve_is_twist() == RLC_EP_MTYPE) {
+			one ^= 1;
+			zero ^= 1;
+		}
+		fp2_copy(c[0], l[zero][zero]);
+		fp2_copy(c[1], l[one][zero]);
+		fp2_copy(c[2], l[one][one]);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp12_free(l);
+		ep_free(u);
+	}
+}
+
+/**
+ * Returns the number of line functions of the optimal ate pairing with
+ * embedding degree 12 for the current curve, which is the number of entries
+ * used in a precomputation table divided by three.
+ *
+ * @param[out] s			- the loop parameter in NAF form.
+ * @param[out] len			- the length of the loop parameter in NAF form.
+ * @param[out] a			- the loop parameter.
+ * @return the number of line functions.
+ */
+static int pp_pre_lines_k12(int8_t *s, int *len, bn_t a) {
+	int i, lines;
+
+	fp_prime_get_par(a);
+	if (ep_curve_is_pairf() == EP_BN) {
+		bn_mul_dig(a, a, 6);
+		bn_add_dig(a, a, 2);
+	}
+	*len = bn_bits(a) + 1;
+	bn_rec_naf(s, len, a, 2);
+
+	lines = *len - 1;
+	for (i = *len - 2; i >= 0; i--) {
+		lines += (s[i] != 0);
+	}
+	if (ep_curve_is_pairf() == EP_BN) {
+		lines += 2;
+	}
+	return lines;
+}
+
+/**
+ * Evaluates a precomputed line function at a point. Entries of the result that
+ * are not touched by the line function must be zero.
+ *
+ * @param[out] l			- the result.
+ * @param[in] c				- the coefficients of the line function.
+ * @param[in] p				- the evaluation point.
+ */
+static void pp_pre_eval_k12(fp12_t l, fp2_t *c, const ep_t p) {
+	int one = 1, zero = 0;
+
+	if (ep2_curve_is_twist() == RLC_EP_MTYPE) {
+		one ^= 1;
+		zero ^= 1;
+	}
+	fp_mul(l[zero][zero][0], c[0][0], p->y);
+	fp_mul(l[zero][zero][1], c[0][1], p->y);
+	fp_mul(l[one][zero][0], c[1][0], p->x);
+	fp_mul(l[one][zero][1], c[1][1], p->x);
+	fp2_copy(l[one][one], c[2]);
+}
+
+/**
+ * Computes the Miller loop for pairings of type G_2 x G_1 from precomputed
+ * line functions, following the same steps as pp_mil_k12() and
+ * pp_fin_k12_oatep(). Pairings with G_2 arguments that have no precomputation
+ * table are computed on the fly in the same loop.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the G_1 arguments in affine coordinates.
+ * @param[in] t				- the precomputation tables of the G_2 arguments.
+ * @param[in] m 			- the number of pairings with precomputed tables.
+ * @param[in] u				- the G_1 arguments in affine coordinates.
+ * @param[in] v				- the G_2 arguments in affine coordinates.
+ * @param[in] n 			- the number of pairings computed on the fly.
+ * @param[in] a				- the loop parameter.
+ */
+static void pp_mil_pre_k12(fp12_t r, ep_t *p, fp2_t **t, int m, ep_t *u,
+		ep2_t *v, int n, bn_t a) {
+	fp12_t l;
+	ep_t *_p = RLC_ALLOCA(ep_t, m + n);
+	ep2_t *w = RLC_ALLOCA(ep2_t, 2 * n + 1);
+	int i, j, k, len = bn_bits(a) + 1;
+	int8_t s[RLC_FP_BITS + 1];
+
+	if (m + n == 0) {
+		RLC_FREE(_p);
+		RLC_FREE(w);
+		return;
+	}
+
+	fp12_null(l);
+
+	RLC_TRY {
+		fp12_new(l);
+		if (_p == NULL || w == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (j = 0; j < m + n; j++) {
+			ep_null(_p[j]);
+		}
+		for (j = 0; j < 2 * n; j++) {
+			ep2_null(w[j]);
+		}
+		/* Transform the G_1 arguments of doubling steps, with those of the
+		 * pairings computed on the fly stored after the others. */
+		for (j = 0; j < m + n; j++) {
+			ep_new(_p[j]);
+			ep_copy(_p[j], (j < m ? p[j] : u[j - m]));
+#if EP_ADD == BASIC
+			ep_neg(_p[j], _p[j]);
+#else
+			fp_mul_dig(_p[j]->x, _p[j]->x, 3);
+			fp_neg(_p[j]->y, _p[j]->y);
+#endif
+		}
+		/* The running points come first, followed by the negated points. */
+		for (j = 0; j < n; j++) {
+			ep2_new(w[j]);
+			ep2_new(w[n + j]);
+			ep2_copy(w[j], v[j]);
+			ep2_neg(w[n + j], v[j]);
+		}
+
+		fp12_zero(l);
+		fp12_zero(r);
+		bn_rec_naf(s, &len, a, 2);
+		/* The first line is written directly to the result. */
+		for (j = 0; j < n; j++) {
+			if (j == 0) {
+				pp_dbl_k12(r, w[0], w[0], _p[m]);
+			} else {
+				pp_dbl_k12(l, w[j], w[j], _p[m + j]);
+				fp12_mul_dxs(r, r, l);
+			}
+		}
+		for (j = 0; j < m; j++) {
+			if (n == 0 && j == 0) {
+				pp_pre_eval_k12(r, t[0], _p[0]);
+			} else {
+				pp_pre_eval_k12(l, t[j], _p[j]);
+				fp12_mul_dxs(r, r, l);
+			}
+		}
+		k = 3;
+		if (s[len - 2] != 0) {
+			for (j = 0; j < n; j++) {
+				pp_add_k12(l, w[j], (s[len - 2] > 0 ? v[j] : w[n + j]), u[j]);
+				fp12_mul_dxs(r, r, l);
+			}
+			for (j = 0; j < m; j++) {
+				pp_pre_eval_k12(l, t[j] + k, p[j]);
+				fp12_mul_dxs(r, r, l);
+			}
+			k += 3;
+		}
+
+		for (i = len - 3; i >= 0; i--) {
+			fp12_sqr(r, r);
+			for (j = 0; j < n; j++) {
+				pp_dbl_k12(l, w[j], w[j], _p[m + j]);
+				fp12_mul_dxs(r, r, l);
+				if (s[i] != 0) {
+					pp_add_k12(l, w[j], (s[i] > 0 ? v[j] : w[n + j]), u[j]);
+					fp12_mul_dxs(r, r, l);
+				}
+			}
+			for (j = 0; j < m; j++) {
+				pp_pre_eval_k12(l, t[j] + k, _p[j]);
+				fp12_mul_dxs(r, r, l);
+				if (s[i] != 0) {
+					pp_pre_eval_k12(l, t[j] + k + 3, p[j]);
+					fp12_mul_dxs(r, r, l);
+				}
+			}
+			k += (s[i] != 0 ? 6 : 3);
+		}
+
+		if (bn_sign(a) == RLC_NEG) {
+			/* f_{-a,Q}(P) = 1/f_{a,Q}(P). */
+			fp12_inv_cyc(r, r);
+		}
+		if (ep_curve_is_pairf() == EP_BN) {
+			for (j = 0; j < n; j++) {
+				if (bn_sign(a) == RLC_NEG) {
+					ep2_neg(w[j], w[j]);
+				}
+				pp_fin_k12_oatep(r, w[j], v[j], u[j]);
+			}
+			for (j = 0; j < m; j++) {
+				pp_pre_eval_k12(l, t[j] + k, p[j]);
+				fp12_mul_dxs(r, r, l);
+				pp_pre_eval_k12(l, t[j] + k + 3, p[j]);
+				fp12_mul_dxs(r, r, l);
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp12_free(l);
+		if (_p != NULL) {
+			for (j = 0; j < m + n; j++) {
+				ep_free(_p[j]);
+			}
+		}
+		if (w != NULL) {
+			for (j = 0; j < 2 * n; j++) {
+				ep2_free(w[j]);
+			}
+		}
+		RLC_FREE(_p);
+		RLC_FREE(w);
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -520,7 +781,7 @@ void pp_map_oatep_k12(fp12_t r, const ep_t p, const ep2_t q) {
 	}
 }
 
-void pp_map_sim_oatep_k12(fp12_t r, const ep_t *p, const ep2_t *q, int m) {
+void pp_mil_sim_oatep_k12(fp12_t r, const ep_t *p, const ep2_t *q, int m) {
 	ep_t *_p = RLC_ALLOCA(ep_t, m);
 	ep2_t *t = RLC_ALLOCA(ep2_t, m), *_q = RLC_ALLOCA(ep2_t, m);
 	bn_t a;
@@ -569,7 +830,6 @@ void pp_map_sim_oatep_k12(fp12_t r, const ep_t *p, const ep2_t *q, int m) {
 						}
 						pp_fin_k12_oatep(r, t[i], _q[i], _p[i]);
 					}
-					pp_exp_k12(r, r);
 					break;
 				case EP_B12:
 					/* r = f_{|a|,Q}(P). */
@@ -577,7 +837,6 @@ void pp_map_sim_oatep_k12(fp12_t r, const ep_t *p, const ep2_t *q, int m) {
 					if (bn_sign(a) == RLC_NEG) {
 						fp12_inv_cyc(r, r);
 					}
-					pp_exp_k12(r, r);
 					break;
 			}
 		}
@@ -598,4 +857,319 @@ void pp_map_sim_oatep_k12(fp12_t r, const ep_t *p, const ep2_t *q, int m) {
 	}
 }
 
+void pp_map_sim_oatep_k12(fp12_t r, const ep_t *p, const ep2_t *q, int m) {
+	pp_mil_sim_oatep_k12(r, p, q, m);
+	/* The Miller loop is trivial when all pairs are degenerate. */
+	if (fp12_cmp_dig(r, 1) != RLC_EQ) {
+		pp_exp_k12(r, r);
+	}
+}
+
+void pp_pre_k12(fp2_t *t, const ep2_t q) {
+	ep2_t r, _q, q1, q2;
+	bn_t a;
+	int i, len, lines;
+	int8_t s[RLC_FP_BITS + 1];
+
+	ep2_null(r);
+	ep2_null(_q);
+	ep2_null(q1);
+	ep2_null(q2);
+	bn_null(a);
+
+	RLC_TRY {
+		ep2_new(r);
+		ep2_new(_q);
+		ep2_new(q1);
+		ep2_new(q2);
+		bn_new(a);
+
+		for (i = 0; i < RLC_PP_TABLE_K12; i++) {
+			fp2_zero(t[i]);
+		}
+
+		/* Count the lines before writing them. */
+		lines = pp_pre_lines_k12(s, &len, a);
+		if (3 * lines > RLC_PP_TABLE_K12) {
+			RLC_THROW(ERR_NO_BUFFER);
+		}
+
+		ep2_norm(_q, q);
+		if (!ep2_is_infty(_q) && (ep_curve_is_pairf() == EP_BN ||
+				ep_curve_is_pairf() == EP_B12)) {
+			/* Follow the same steps as pp_mil_k12(). */
+			ep2_copy(r, _q);
+			ep2_neg(q1, _q);
+			pp_pre_lin_k12(t, r, NULL);
+			t += 3;
+			if (s[len - 2] != 0) {
+				pp_pre_lin_k12(t, r, (s[len - 2] > 0 ? _q : q1));
+				t += 3;
+			}
+			for (i = len - 3; i >= 0; i--) {
+				pp_pre_lin_k12(t, r, NULL);
+				t += 3;
+				if (s[i] != 0) {
+					pp_pre_lin_k12(t, r, (s[i] > 0 ? _q : q1));
+					t += 3;
+				}
+			}
+
+			if (ep_curve_is_pairf() == EP_BN) {
+				/* Follow the same steps as pp_fin_k12_oatep(). */
+				if (bn_sign(a) == RLC_NEG) {
+					ep2_neg(r, r);
+				}
+				fp2_set_dig(q1->z, 1);
+				fp2_set_dig(q2->z, 1);
+				ep2_frb(q1, _q, 1);
+				ep2_frb(q2, _q, 2);
+				ep2_neg(q2, q2);
+				pp_pre_lin_k12(t, r, q1);
+				pp_pre_lin_k12(t + 3, r, q2);
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		ep2_free(r);
+		ep2_free(_q);
+		ep2_free(q1);
+		ep2_free(q2);
+		bn_free(a);
+	}
+}
+
+void pp_map_pre_k12(fp12_t r, const ep_t p, fp2_t *t) {
+	ep_t _p[1];
+	fp2_t *_t[1];
+
+	ep_null(_p[0]);
+
+	RLC_TRY {
+		ep_new(_p[0]);
+		ep_copy(_p[0], p);
+		_t[0] = t;
+		pp_map_sim_pre_k12(r, _p, _t, 1);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		ep_free(_p[0]);
+	}
+}
+
+void pp_map_sim_pre_k12(fp12_t r, const ep_t *p, fp2_t **t, int m) {
+	ep_t *_p = RLC_ALLOCA(ep_t, m);
+	fp2_t **_t = RLC_ALLOCA(fp2_t *, m);
+	bn_t a;
+	int i, j;
+
+	bn_null(a);
+
+	RLC_TRY {
+		bn_new(a);
+		if (_p == NULL || _t == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < m; i++) {
+			ep_null(_p[i]);
+			ep_new(_p[i]);
+		}
+
+		/* An empty table corresponds to the point at infinity. */
+		j = 0;
+		for (i = 0; i < m; i++) {
+			if (!ep_is_infty(p[i]) && !fp2_is_zero(t[i][0])) {
+				ep_norm(_p[j], p[i]);
+				_t[j++] = t[i];
+			}
+		}
+
+		fp_prime_get_par(a);
+		if (ep_curve_is_pairf() == EP_BN) {
+			bn_mul_dig(a, a, 6);
+			bn_add_dig(a, a, 2);
+		}
+		fp12_set_dig(r, 1);
+		if (j > 0) {
+			pp_mil_pre_k12(r, _p, _t, j, NULL, NULL, 0, a);
+			pp_exp_k12(r, r);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(a);
+		for (i = 0; i < m; i++) {
+			ep_free(_p[i]);
+		}
+		RLC_FREE(_p);
+		RLC_FREE(_t);
+	}
+}
+
+void pp_map_sim_mix_k12(fp12_t r, const ep_t *p, const ep2_t *q, int m,
+		const ep_t *s, fp2_t **t, int n) {
+	ep_t *_p = RLC_ALLOCA(ep_t, m + n);
+	ep2_t *_q = RLC_ALLOCA(ep2_t, m + 1);
+	fp2_t **_t = RLC_ALLOCA(fp2_t *, n + 1);
+	bn_t a;
+	int i, j, k;
+
+	bn_null(a);
+
+	RLC_TRY {
+		bn_new(a);
+		if (_p == NULL || _q == NULL || _t == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < m + n; i++) {
+			ep_null(_p[i]);
+			ep_new(_p[i]);
+		}
+		for (i = 0; i < m; i++) {
+			ep2_null(_q[i]);
+			ep2_new(_q[i]);
+		}
+
+		/* An empty table corresponds to the point at infinity. */
+		j = 0;
+		for (i = 0; i < n; i++) {
+			if (!ep_is_infty(s[i]) && !fp2_is_zero(t[i][0])) {
+				ep_norm(_p[j], s[i]);
+				_t[j++] = t[i];
+			}
+		}
+		/* Pairings without tables go after the others, in the same loop. */
+		k = 0;
+		for (i = 0; i < m; i++) {
+			if (!ep_is_infty(p[i]) && !ep2_is_infty(q[i])) {
+				ep_norm(_p[j + k], p[i]);
+				ep2_norm(_q[k++], q[i]);
+			}
+		}
+
+		fp_prime_get_par(a);
+		if (ep_curve_is_pairf() == EP_BN) {
+			bn_mul_dig(a, a, 6);
+			bn_add_dig(a, a, 2);
+		}
+		fp12_set_dig(r, 1);
+		if (j + k > 0) {
+			pp_mil_pre_k12(r, _p, _t, j, _p + j, _q, k, a);
+			pp_exp_k12(r, r);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(a);
+		if (_p != NULL) {
+			for (i = 0; i < m + n; i++) {
+				ep_free(_p[i]);
+			}
+		}
+		if (_q != NULL) {
+			for (i = 0; i < m; i++) {
+				ep2_free(_q[i]);
+			}
+		}
+		RLC_FREE(_p);
+		RLC_FREE(_q);
+		RLC_FREE(_t);
+	}
+}
+
+int pp_size_pre_k12(fp2_t *t) {
+	int len, lines = 0;
+	int8_t s[RLC_FP_BITS + 1];
+	bn_t a;
+
+	/* An empty table corresponds to the point at infinity. */
+	if (fp2_is_zero(t[0])) {
+		return 1;
+	}
+
+	bn_null(a);
+
+	RLC_TRY {
+		bn_new(a);
+		lines = pp_pre_lines_k12(s, &len, a);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(a);
+	}
+	return 3 * lines * 2 * RLC_FP_BYTES;
+}
+
+void pp_write_pre_k12(uint8_t *bin, int len, fp2_t *t) {
+	int i, size = pp_size_pre_k12(t);
+
+	if (len != size) {
+		RLC_THROW(ERR_NO_BUFFER);
+		return;
+	}
+
+	if (size == 1) {
+		bin[0] = 0;
+		return;
+	}
+
+	for (i = 0; i < size / (2 * RLC_FP_BYTES); i++) {
+		fp2_write_bin(bin + i * 2 * RLC_FP_BYTES, 2 * RLC_FP_BYTES, t[i], 0);
+	}
+}
+
+void pp_read_pre_k12(fp2_t *t, const uint8_t *bin, int len) {
+	int i, lines;
+	int8_t s[RLC_FP_BITS + 1];
+	bn_t a;
+
+	bn_null(a);
+
+	RLC_TRY {
+		bn_new(a);
+
+		for (i = 0; i < RLC_PP_TABLE_K12; i++) {
+			fp2_zero(t[i]);
+		}
+
+		if (len == 1) {
+			if (bin[0] != 0) {
+				RLC_THROW(ERR_NO_VALID);
+			}
+		} else {
+			lines = pp_pre_lines_k12(s, &i, a);
+			if (3 * lines > RLC_PP_TABLE_K12 ||
+					len != 3 * lines * 2 * RLC_FP_BYTES) {
+				RLC_THROW(ERR_NO_BUFFER);
+			} else {
+				for (i = 0; i < 3 * lines; i++) {
+					fp2_read_bin(t[i], bin + i * 2 * RLC_FP_BYTES,
+							2 * RLC_FP_BYTES);
+				}
+				/* A valid table never starts with a zero coefficient. */
+				if (fp2_is_zero(t[0])) {
+					RLC_THROW(ERR_NO_VALID);
+				}
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(a);
+	}
+}
+
 #endif
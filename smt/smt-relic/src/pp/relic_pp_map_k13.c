@@ -38,105 +38,126 @@
 /*============================================================================*/
 
 /**
- * Compute the modified Miller loop  for super-optimal ate pairings of type G_2 x G_1 with k=13.
+ * Compute the modified Miller loop for super-optimal ate pairings of type
+ * G_2 x G_1 with k = 13, sharing the accumulators among m pairs of points.
  *
- * @param[out] t			- the resulting point.
+ * @param[out] l1			- numerator of the product of f_{a,q}(p).
+ * @param[out] l2			- denominator of the product of f_{a,q}(p).
+ * @param[out] s1			- numerator of the product of f_{a,q}(p2).
+ * @param[out] s2			- denominator of the product of f_{a,q}(p2).
+ * @param[out] t			- the vector of resulting points.
  * @param[in] q				- the vector of first arguments in affine coordinates.
  * @param[in] p				- the vector of second arguments in affine coordinates.
- * @param[in] p2			- the image of p under the glv endomorphism.
+ * @param[in] p2			- the images of p under the glv endomorphism.
+ * @param[in] m				- the number of pairings to evaluate.
  * @param[in] a				- the loop parameter.
- * @param[out] l1			- numerator of f_{a,q}(p).
- * @param[out] l2			- denominator of f_{a,q}(p).
- * @param[out] s1			- numerator of f_{a,q}(p2).
- * @param[out] s2			- denominator of f_{a,q}(p2).
  */
-static void pp_mil_k13(fp13_t l1, fp13_t l2, fp13_t s1, fp13_t s2, ep13_t t, ep13_t q, ep_t p, ep_t p2, bn_t a) {
-	fp13_t f1, g1, f2, g2;
+static void pp_mil_k13(fp13_t l1, fp13_t l2, fp13_t s1, fp13_t s2, ep13_t *t,
+		ep13_t *q, ep_t *p, ep_t *p2, int m, bn_t a) {
+	fp13_t f1, g1, f2, g2, h;
+	int i, j;
+
 	fp13_null(f1);
 	fp13_null(g1);
 	fp13_null(f2);
 	fp13_null(g2);
+	fp13_null(h);
+
 	RLC_TRY {
 		fp13_new(f1);
 		fp13_new(g1);
 		fp13_new(f2);
 		fp13_new(g2);
-		ep13_copy(t, q);
-		pp_qpl_k13_projc_lazyr(l1, l2, s1, s2, t, p, p2);
-		fp13_neg(f1, q->x);
-		fp13_neg(f2, q->x);
-		fp_add(f1[0], f1[0], p->x);
-		fp_add(f2[0], f2[0], p2->x);
-		fp13_sqr(f1, f1);
-		fp13_sqr(f1, f1);
-		fp13_mul(l1, l1, f1);
-		fp13_sqr(l2, l2);
-
-		fp13_sqr(f2, f2);
-		fp13_sqr(f2, f2);
-		fp13_mul(s1, s1, f2);
-		fp13_sqr(s2, s2);
-		for (int i = bn_bits(a) - 4; i >= 0;) {
-			if (bn_get_bit(a, i)) {
-				pp_dba_k13_projc_lazyr(f1, g1, f2, g2, t, q, p, p2);
-				fp13_sqr(l1, l1);
-				fp13_sqr(l2, l2);
+		fp13_new(h);
+
+		for (j = 0; j < m; j++) {
+			ep13_copy(t[j], q[j]);
+			pp_qpl_k13_projc_lazyr(f1, g1, f2, g2, t[j], p[j], p2[j]);
+			fp13_neg(h, q[j]->x);
+			fp_add(h[0], h[0], p[j]->x);
+			fp13_sqr(h, h);
+			fp13_sqr(h, h);
+			fp13_mul(f1, f1, h);
+			fp13_sqr(g1, g1);
+			fp13_neg(h, q[j]->x);
+			fp_add(h[0], h[0], p2[j]->x);
+			fp13_sqr(h, h);
+			fp13_sqr(h, h);
+			fp13_mul(f2, f2, h);
+			fp13_sqr(g2, g2);
+			if (j == 0) {
+				fp13_copy(l1, f1);
+				fp13_copy(l2, g1);
+				fp13_copy(s1, f2);
+				fp13_copy(s2, g2);
+			} else {
 				fp13_mul(l1, l1, f1);
 				fp13_mul(l2, l2, g1);
+				fp13_mul(s1, s1, f2);
+				fp13_mul(s2, s2, g2);
+			}
+		}
 
+		for (i = bn_bits(a) - 4; i >= 0;) {
+			if (bn_get_bit(a, i)) {
+				fp13_sqr(l1, l1);
+				fp13_sqr(l2, l2);
 				fp13_sqr(s1, s1);
 				fp13_sqr(s2, s2);
-				fp13_mul(s1, s1, f2);
-				fp13_mul(s2, s2, g2);
+				for (j = 0; j < m; j++) {
+					pp_dba_k13_projc_lazyr(f1, g1, f2, g2, t[j], q[j], p[j],
+							p2[j]);
+					fp13_mul(l1, l1, f1);
+					fp13_mul(l2, l2, g1);
+					fp13_mul(s1, s1, f2);
+					fp13_mul(s2, s2, g2);
+				}
 				i--;
-			}
-			else{
-				pp_qpl_k13_projc_lazyr(f1, g1, f2, g2, t, p, p2);
+			} else {
 				fp13_sqr(l1, l1);
 				fp13_sqr(l1, l1);
-				fp13_mul(l1, l1, f1);
-
-
 				fp13_sqr(l2, l2);
-				fp13_mul(l2, l2, g1);
-				fp13_sqr(l2, l2);
-
 				fp13_sqr(s1, s1);
 				fp13_sqr(s1, s1);
-				fp13_mul(s1, s1, f2);
-
-
 				fp13_sqr(s2, s2);
-				fp13_mul(s2, s2, g2);
-				fp13_sqr(s2, s2);
-
-				i--;
-				if (bn_get_bit(a, i)) {
-					pp_add_k13_projc_lazyr(f1, g1, f2, g2, t, q, p, p2);
+				for (j = 0; j < m; j++) {
+					pp_qpl_k13_projc_lazyr(f1, g1, f2, g2, t[j], p[j], p2[j]);
 					fp13_mul(l1, l1, f1);
-					fp13_mul(l2, l2, g1);	
-
+					fp13_mul(l2, l2, g1);
 					fp13_mul(s1, s1, f2);
 					fp13_mul(s2, s2, g2);
 				}
+				fp13_sqr(l2, l2);
+				fp13_sqr(s2, s2);
+				i--;
+				if (bn_get_bit(a, i)) {
+					for (j = 0; j < m; j++) {
+						pp_add_k13_projc_lazyr(f1, g1, f2, g2, t[j], q[j], p[j],
+								p2[j]);
+						fp13_mul(l1, l1, f1);
+						fp13_mul(l2, l2, g1);
+						fp13_mul(s1, s1, f2);
+						fp13_mul(s2, s2, g2);
+					}
+				}
 				i--;
-		
-						
 			}
-			
 		}
-	fp13_sqr(g1, t->z);
-	fp13_mul(l1, l1, g1);
-	fp13_mul(s1, s1, g1);
-	for(int i = 0; i<13; i++)fp_mul(f1[i], g1[i], p->x);	
-	for(int i = 0; i<13; i++)fp_mul(f2[i], g1[i], p2->x);
 
-	fp13_sub(f1, f1, t->x);
-	fp13_mul(l2, l2, f1);
-	fp13_sub(f2, f2, t->x);
-	fp13_mul(s2, s2, f2);
+		for (j = 0; j < m; j++) {
+			fp13_sqr(g1, t[j]->z);
+			fp13_mul(l1, l1, g1);
+			fp13_mul(s1, s1, g1);
+			for (i = 0; i < 13; i++) {
+				fp_mul(f1[i], g1[i], p[j]->x);
+				fp_mul(f2[i], g1[i], p2[j]->x);
+			}
+			fp13_sub(f1, f1, t[j]->x);
+			fp13_mul(l2, l2, f1);
+			fp13_sub(f2, f2, t[j]->x);
+			fp13_mul(s2, s2, f2);
+		}
 	}
-	
 	RLC_CATCH_ANY {
 		RLC_THROW(ERR_CAUGHT);
 	}
@@ -145,93 +166,563 @@ static void pp_mil_k13(fp13_t l1, fp13_t l2, fp13_t s1, fp13_t s2, ep13_t t, ep1
 		fp13_free(g1);
 		fp13_free(f2);
 		fp13_free(g2);
-		
+		fp13_free(h);
+	}
+}
+
+/**
+ * Combines the outputs of the Miller loop of super-optimal ate pairings with
+ * k = 13, multiplies the final line functions and computes the final
+ * exponentiation.
+ *
+ * @param[out] r			- the result.
+ * @param[in] l1			- numerator of the product of f_{a,q}(p).
+ * @param[in] l2			- denominator of the product of f_{a,q}(p).
+ * @param[in] s1			- numerator of the product of f_{a,q}(p2).
+ * @param[in] s2			- denominator of the product of f_{a,q}(p2).
+ * @param[in] h				- the product of the final line functions.
+ * @param[in] a				- the loop parameter.
+ */
+static void pp_fin_k13(fp13_t r, fp13_t l1, fp13_t l2, fp13_t s1, fp13_t s2,
+		fp13_t h, bn_t a) {
+	fp13_t t;
+
+	fp13_null(t);
+
+	RLC_TRY {
+		fp13_new(t);
+
+		/* Compute (l1/l2)^(a + p) * (s1/s2)^p. */
+		fp13_frb(s1, s1, 1);
+		fp13_frb(s2, s2, 1);
+		fp13_inv(l2, l2);
+		fp13_mul(l1, l1, l2);
+		fp13_frb(l2, l1, 1);
+		fp13_copy(t, l1);
+		for (int i = bn_bits(a) - 2; i >= 0; i--) {
+			fp13_sqr(t, t);
+			if (bn_get_bit(a, i)) {
+				fp13_mul(t, t, l1);
+			}
+		}
+		fp13_mul(l1, t, l2);
+		fp13_mul(l1, l1, s1);
+		fp13_mul(l1, l1, h);
+
+		/* The final exponentiation. */
+		pp_exp_bwk13(r, l1, s2);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp13_free(t);
+	}
+}
+
+/**
+ * Evaluates the final line functions l_{p^2(Q),p(aQ)}(P) of m pairs of points
+ * and multiplies them together.
+ *
+ * @param[out] h			- the product of the final line functions.
+ * @param[in] q				- the vector of first arguments in affine coordinates.
+ * @param[in] p				- the vector of second arguments in affine coordinates.
+ * @param[in] m				- the number of pairings to evaluate.
+ */
+static void pp_lin_k13(fp13_t h, ep13_t *q, ep_t *p, int m) {
+	fp13_t t;
+
+	fp13_null(t);
+
+	RLC_TRY {
+		fp13_new(t);
+
+		fp13_set_dig(h, 1);
+		for (int j = 0; j < m; j++) {
+			fp13_frb(t, q[j]->y, 2);
+			fp13_neg(t, t);
+			fp_add(t[0], t[0], p[j]->y);
+			fp13_mul(h, h, t);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
 	}
+	RLC_FINALLY {
+		fp13_free(t);
+	}
+}
+
+/**
+ * Advances a point through one step of the Miller loop of super-optimal ate
+ * pairings with k = 13 and stores the line functions of the step as
+ * coefficients c_0 + c_x * x + c_y * y over the coordinates of the G_1
+ * argument. The line functions are affine in the coordinates of P, so the
+ * coefficients are interpolated from evaluations at (0, 0), (1, 0) and (0, 1).
+ *
+ * @param[out] c			- the coefficients of f and g, in this order.
+ * @param[in, out] t		- the point in the Miller loop.
+ * @param[in] q				- the first argument of the pairing.
+ * @param[in] op			- 0 for quadrupling, 1 for doubling-and-addition
+ * 							and 2 for addition.
+ */
+static void pp_pre_lin_k13(fp13_t *c, ep13_t t, ep13_t q, int op) {
+	fp13_t f, g;
+	ep13_t _t;
+	ep_t o, x, y;
+
+	fp13_null(f);
+	fp13_null(g);
+	ep13_null(_t);
+	ep_null(o);
+	ep_null(x);
+	ep_null(y);
+
+	RLC_TRY {
+		fp13_new(f);
+		fp13_new(g);
+		ep13_new(_t);
+		ep_new(o);
+		ep_new(x);
+		ep_new(y);
+
+		ep_set_infty(o);
+		fp_set_dig(o->z, 1);
+		o->coord = BASIC;
+		ep_copy(x, o);
+		ep_copy(y, o);
+		fp_set_dig(x->x, 1);
+		fp_set_dig(y->y, 1);
+
+		/* Evaluate at (0, 1) and (0, 0) on a copy, then at (1, 0) and (0, 0). */
+		ep13_copy(_t, t);
+		switch (op) {
+			case 0:
+				pp_qpl_k13_projc_lazyr(c[2], c[5], f, g, _t, y, o);
+				pp_qpl_k13_projc_lazyr(c[1], c[4], c[0], c[3], t, x, o);
+				break;
+			case 1:
+				pp_dba_k13_projc_lazyr(c[2], c[5], f, g, _t, q, y, o);
+				pp_dba_k13_projc_lazyr(c[1], c[4], c[0], c[3], t, q, x, o);
+				break;
+			default:
+				pp_add_k13_projc_lazyr(c[2], c[5], f, g, _t, q, y, o);
+				pp_add_k13_projc_lazyr(c[1], c[4], c[0], c[3], t, q, x, o);
+				break;
+		}
+		for (int i = 1; i < 3; i++) {
+			fp13_sub(c[i], c[i], c[0]);
+			fp13_sub(c[i + 3], c[i + 3], c[3]);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp13_free(f);
+		fp13_free(g);
+		ep13_free(_t);
+		ep_free(o);
+		ep_free(x);
+		ep_free(y);
+	}
+}
+
+/**
+ * Evaluates a precomputed line function c_0 + c_x * x + c_y * y.
+ *
+ * @param[out] f			- the result.
+ * @param[in] c				- the coefficients of the line function.
+ * @param[in] x				- the first coordinate of the evaluation point.
+ * @param[in] y				- the second coordinate of the evaluation point.
+ */
+static void pp_pre_eval_k13(fp13_t f, fp13_t *c, const fp_t x, const fp_t y) {
+	fp_t t;
+
+	fp_null(t);
 
+	RLC_TRY {
+		fp_new(t);
 
+		for (int i = 0; i < 13; i++) {
+			fp_mul(f[i], c[1][i], x);
+			fp_mul(t, c[2][i], y);
+			fp_add(f[i], f[i], t);
+			fp_add(f[i], f[i], c[0][i]);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp_free(t);
+	}
 }
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
 
 void pp_map_sup_oatep_k13(fp13_t r, ep_t p, ep13_t q) {
 	bn_t a;
-	ep_t p2;
-	ep13_t t;
-	fp13_t l1,l2, s1, s2, h1;
+	ep_t _p[1], _p2[1];
+	ep13_t t[1], _q[1];
+	fp13_t l1, l2, s1, s2, h;
 
 	bn_null(a);
-	ep_null(p2);
-	ep13_null(t);
-        fp13_null(l1);
-        fp13_null(l2);
+	ep_null(_p[0]);
+	ep_null(_p2[0]);
+	ep13_null(t[0]);
+	ep13_null(_q[0]);
+	fp13_null(l1);
+	fp13_null(l2);
 	fp13_null(s1);
 	fp13_null(s2);
+	fp13_null(h);
 
 	RLC_TRY {
-
 		bn_new(a);
-       		fp13_new(l1);
-        	fp13_new(l2);
-        	fp13_new(s1);
-       		fp13_new(s2);
-		ep_new(p2);
-		ep13_new(t);
+		ep_new(_p[0]);
+		ep_new(_p2[0]);
+		ep13_new(t[0]);
+		ep13_new(_q[0]);
+		fp13_new(l1);
+		fp13_new(l2);
+		fp13_new(s1);
+		fp13_new(s2);
+		fp13_new(h);
+
 		fp_prime_get_par(a);
 		fp13_set_dig(r, 1);
-		dig_t* w;
-		w = ep_curve_get_beta();
-       		ep_copy(p2, p);
-		ep13_copy(t, q);
-		fp_mul(p2->x, p->x, w);
 
 		if (!ep_is_infty(p) && !ep13_is_infty(q)) {
-					/* r = f_{|a|,Q}(P). */
+			ep_norm(_p[0], p);
+			ep_copy(_p2[0], _p[0]);
+			fp_mul(_p2[0]->x, _p[0]->x, ep_curve_get_beta());
+			ep13_norm(_q[0], q);
+			/* r = f_{|a|,Q}(P). */
 			bn_neg(a, a);
-			pp_mil_k13(l1, l2, s1, s2,  t, q, p, p2, a);
-			/*compute (l1/l2)^(a+p)*(s1/s2)^p*/
-			fp13_frb(s1, s1, 1);
-			fp13_frb(s2, s2, 1);
-			fp13_inv(l2, l2);
-			fp13_mul(l1, l1, l2);
-			fp13_frb(l2, l1, 1);
-			fp13_copy(h1, l1);
-			for (int i = bn_bits(a) - 2; i >= 0;){
-				fp13_sqr(h1, h1);
-				if (bn_get_bit(a, i))fp13_mul(h1, h1, l1);
-				i--;
-		         }
+			pp_mil_k13(l1, l2, s1, s2, t, _q, _p, _p2, 1, a);
+			pp_lin_k13(h, _q, _p, 1);
+			pp_fin_k13(r, l1, l2, s1, s2, h, a);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(a);
+		ep_free(_p[0]);
+		ep_free(_p2[0]);
+		ep13_free(t[0]);
+		ep13_free(_q[0]);
+		fp13_free(l1);
+		fp13_free(l2);
+		fp13_free(s1);
+		fp13_free(s2);
+		fp13_free(h);
+	}
+}
+
+void pp_map_sim_k13(fp13_t r, ep_t *p, ep13_t *q, int m) {
+	ep_t *_p = RLC_ALLOCA(ep_t, m), *_p2 = RLC_ALLOCA(ep_t, m);
+	ep13_t *t = RLC_ALLOCA(ep13_t, m), *_q = RLC_ALLOCA(ep13_t, m);
+	fp13_t l1, l2, s1, s2, h;
+	bn_t a;
+	int i, j;
+
+	bn_null(a);
+	fp13_null(l1);
+	fp13_null(l2);
+	fp13_null(s1);
+	fp13_null(s2);
+	fp13_null(h);
+
+	RLC_TRY {
+		bn_new(a);
+		fp13_new(l1);
+		fp13_new(l2);
+		fp13_new(s1);
+		fp13_new(s2);
+		fp13_new(h);
+		if (_p == NULL || _p2 == NULL || _q == NULL || t == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < m; i++) {
+			ep_null(_p[i]);
+			ep_null(_p2[i]);
+			ep13_null(_q[i]);
+			ep13_null(t[i]);
+			ep_new(_p[i]);
+			ep_new(_p2[i]);
+			ep13_new(_q[i]);
+			ep13_new(t[i]);
+		}
+
+		j = 0;
+		for (i = 0; i < m; i++) {
+			if (!ep_is_infty(p[i]) && !ep13_is_infty(q[i])) {
+				ep_norm(_p[j], p[i]);
+				ep_copy(_p2[j], _p[j]);
+				fp_mul(_p2[j]->x, _p[j]->x, ep_curve_get_beta());
+				ep13_norm(_q[j++], q[i]);
+			}
+		}
+
+		fp_prime_get_par(a);
+		fp13_set_dig(r, 1);
 
-			fp13_mul(l1, h1, l2);
-			fp13_mul(l1, l1, s1);
-			/*compute the final line function l_{p^2(Q),p(aQ)(P)}*/
-                        fp13_frb(h1, q->y,2);
-			fp13_neg(h1, h1);
-			fp_add(h1[0], h1[0], p->y);
-			fp13_mul(l1, l1, h1);
-			/*the final exponation*/
-			pp_exp_bwk13(r, l1, s2);
+		if (j > 0) {
+			/* r = prod f_{|a|,Q_i}(P_i), with a single final exponentiation. */
+			bn_neg(a, a);
+			pp_mil_k13(l1, l2, s1, s2, t, _q, _p, _p2, j, a);
+			pp_lin_k13(h, _q, _p, j);
+			pp_fin_k13(r, l1, l2, s1, s2, h, a);
 		}
 	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(a);
+		fp13_free(l1);
+		fp13_free(l2);
+		fp13_free(s1);
+		fp13_free(s2);
+		fp13_free(h);
+		for (i = 0; i < m; i++) {
+			ep_free(_p[i]);
+			ep_free(_p2[i]);
+			ep13_free(_q[i]);
+			ep13_free(t[i]);
+		}
+		RLC_FREE(_p);
+		RLC_FREE(_p2);
+		RLC_FREE(_q);
+		RLC_FREE(t);
+	}
+}
+
+void pp_pre_k13(fp13_t *t, ep13_t q) {
+	ep13_t r, _q;
+	bn_t a;
+	int i, l;
+
+	ep13_null(r);
+	ep13_null(_q);
+	bn_null(a);
+
+	RLC_TRY {
+		ep13_new(r);
+		ep13_new(_q);
+		bn_new(a);
 
+		for (i = 0; i < RLC_PP_TABLE_K13; i++) {
+			fp13_zero(t[i]);
+		}
+
+		if (!ep13_is_infty(q)) {
+			fp_prime_get_par(a);
+			bn_neg(a, a);
+			ep13_norm(_q, q);
+			ep13_copy(r, _q);
+			fp13_copy(t[0], _q->x);
+			fp13_frb(t[1], _q->y, 2);
 
+			/* Follow the same steps as pp_mil_k13(). */
+			l = 4;
+			pp_pre_lin_k13(t + l, r, _q, 0);
+			l += 6;
+			for (i = bn_bits(a) - 4; i >= 0; i--) {
+				if (l + 6 > RLC_PP_TABLE_K13) {
+					RLC_THROW(ERR_NO_BUFFER);
+				}
+				if (bn_get_bit(a, i)) {
+					pp_pre_lin_k13(t + l, r, _q, 1);
+					l += 6;
+				} else {
+					pp_pre_lin_k13(t + l, r, _q, 0);
+					l += 6;
+					i--;
+					if (bn_get_bit(a, i)) {
+						if (l + 6 > RLC_PP_TABLE_K13) {
+							RLC_THROW(ERR_NO_BUFFER);
+						}
+						pp_pre_lin_k13(t + l, r, _q, 2);
+						l += 6;
+					}
+				}
+			}
+			fp13_sqr(t[2], r->z);
+			fp13_copy(t[3], r->x);
+		}
+	}
 	RLC_CATCH_ANY {
 		RLC_THROW(ERR_CAUGHT);
 	}
 	RLC_FINALLY {
-		ep13_free(t1);
-		ep13_free(t2);
+		ep13_free(r);
+		ep13_free(_q);
 		bn_free(a);
+	}
+}
+
+void pp_map_pre_k13(fp13_t r, ep_t p, fp13_t *t) {
+	fp13_t l1, l2, s1, s2, f, g, h;
+	fp_t x2;
+	ep_t _p;
+	bn_t a;
+	int i, l;
+
+	fp13_null(l1);
+	fp13_null(l2);
+	fp13_null(s1);
+	fp13_null(s2);
+	fp13_null(f);
+	fp13_null(g);
+	fp13_null(h);
+	fp_null(x2);
+	ep_null(_p);
+	bn_null(a);
+
+	RLC_TRY {
+		fp13_new(l1);
+		fp13_new(l2);
+		fp13_new(s1);
+		fp13_new(s2);
+		fp13_new(f);
+		fp13_new(g);
+		fp13_new(h);
+		fp_new(x2);
+		ep_new(_p);
+		bn_new(a);
+
+		fp13_set_dig(r, 1);
 
+		/* An empty table corresponds to the point at infinity. */
+		if (!ep_is_infty(p) && !fp13_is_zero(t[2])) {
+			fp_prime_get_par(a);
+			bn_neg(a, a);
+			ep_norm(_p, p);
+			fp_mul(x2, _p->x, ep_curve_get_beta());
+
+			l = 4;
+			pp_pre_eval_k13(l1, t + l, _p->x, _p->y);
+			pp_pre_eval_k13(l2, t + l + 3, _p->x, _p->y);
+			pp_pre_eval_k13(s1, t + l, x2, _p->y);
+			pp_pre_eval_k13(s2, t + l + 3, x2, _p->y);
+			fp13_neg(h, t[0]);
+			fp_add(h[0], h[0], _p->x);
+			fp13_sqr(h, h);
+			fp13_sqr(h, h);
+			fp13_mul(l1, l1, h);
+			fp13_sqr(l2, l2);
+			fp13_neg(h, t[0]);
+			fp_add(h[0], h[0], x2);
+			fp13_sqr(h, h);
+			fp13_sqr(h, h);
+			fp13_mul(s1, s1, h);
+			fp13_sqr(s2, s2);
+			l += 6;
+
+			for (i = bn_bits(a) - 4; i >= 0; i--) {
+				if (bn_get_bit(a, i)) {
+					fp13_sqr(l1, l1);
+					fp13_sqr(l2, l2);
+					fp13_sqr(s1, s1);
+					fp13_sqr(s2, s2);
+				} else {
+					fp13_sqr(l1, l1);
+					fp13_sqr(l1, l1);
+					fp13_sqr(l2, l2);
+					fp13_sqr(s1, s1);
+					fp13_sqr(s1, s1);
+					fp13_sqr(s2, s2);
+				}
+				pp_pre_eval_k13(f, t + l, _p->x, _p->y);
+				pp_pre_eval_k13(g, t + l + 3, _p->x, _p->y);
+				fp13_mul(l1, l1, f);
+				fp13_mul(l2, l2, g);
+				pp_pre_eval_k13(f, t + l, x2, _p->y);
+				pp_pre_eval_k13(g, t + l + 3, x2, _p->y);
+				fp13_mul(s1, s1, f);
+				fp13_mul(s2, s2, g);
+				l += 6;
+				if (!bn_get_bit(a, i)) {
+					fp13_sqr(l2, l2);
+					fp13_sqr(s2, s2);
+					i--;
+					if (bn_get_bit(a, i)) {
+						pp_pre_eval_k13(f, t + l, _p->x, _p->y);
+						pp_pre_eval_k13(g, t + l + 3, _p->x, _p->y);
+						fp13_mul(l1, l1, f);
+						fp13_mul(l2, l2, g);
+						pp_pre_eval_k13(f, t + l, x2, _p->y);
+						pp_pre_eval_k13(g, t + l + 3, x2, _p->y);
+						fp13_mul(s1, s1, f);
+						fp13_mul(s2, s2, g);
+						l += 6;
+					}
+				}
+			}
 
+			fp13_mul(l1, l1, t[2]);
+			fp13_mul(s1, s1, t[2]);
+			for (i = 0; i < 13; i++) {
+				fp_mul(f[i], t[2][i], _p->x);
+				fp_mul(g[i], t[2][i], x2);
+			}
+			fp13_sub(f, f, t[3]);
+			fp13_mul(l2, l2, f);
+			fp13_sub(g, g, t[3]);
+			fp13_mul(s2, s2, g);
+
+			fp13_neg(h, t[1]);
+			fp_add(h[0], h[0], _p->y);
+			pp_fin_k13(r, l1, l2, s1, s2, h, a);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
 		fp13_free(l1);
-       		fp13_free(l2);
-        	fp13_free(l3);
-        	fp13_free(l4);
-       		fp13_free(l5);
-       		fp13_free(l6);
-		fp13_free(h1);
+		fp13_free(l2);
+		fp13_free(s1);
+		fp13_free(s2);
+		fp13_free(f);
+		fp13_free(g);
+		fp13_free(h);
+		fp_free(x2);
+		ep_free(_p);
+		bn_free(a);
 	}
 }
 
+void pp_pre_write_k13(uint8_t *bin, int len, fp13_t *t) {
+	if (len != RLC_PP_TABLE_K13 * 13 * RLC_FP_BYTES) {
+		RLC_THROW(ERR_NO_BUFFER);
+		return;
+	}
 
+	for (int i = 0; i < RLC_PP_TABLE_K13; i++) {
+		for (int j = 0; j < 13; j++) {
+			fp_write_bin(bin, RLC_FP_BYTES, t[i][j]);
+			bin += RLC_FP_BYTES;
+		}
+	}
+}
+
+void pp_pre_read_k13(fp13_t *t, const uint8_t *bin, int len) {
+	if (len != RLC_PP_TABLE_K13 * 13 * RLC_FP_BYTES) {
+		RLC_THROW(ERR_NO_BUFFER);
+		return;
+	}
+
+	for (int i = 0; i < RLC_PP_TABLE_K13; i++) {
+		for (int j = 0; j < 13; j++) {
+			fp_read_bin(t[i][j], bin, RLC_FP_BYTES);
+			bin += RLC_FP_BYTES;
+		}
+	}
+}
@@ -0,0 +1,126 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (c) 2019 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of the thread-parallel multi-pairing for curves with
+ * embedding degree 12.
+ *
+ * @ingroup pp
+ */
+
+#include "relic_core.h"
+#include "relic_pp.h"
+#include "relic_util.h"
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Slice of a multi-pairing assigned to one worker thread.
+ */
+typedef struct {
+	/** The partial Miller loop output. */
+	fp12_t *r;
+	/** The first pairing arguments of this slice. */
+	const ep_t *p;
+	/** The second pairing arguments of this slice. */
+	const ep2_t *q;
+	/** The number of pairs in this slice. */
+	int m;
+} pp_job_t;
+
+/**
+ * Computes the Miller loop for a slice of a multi-pairing.
+ *
+ * @param[in,out] arg		- the slice to compute.
+ */
+static void pp_mil_job(void *arg) {
+	pp_job_t *job = (pp_job_t *)arg;
+
+	pp_mil_sim_oatep_k12(*(job->r), job->p, job->q, job->m);
+}
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+void pp_map_sim_par_k12(fp12_t r, const ep_t *p, const ep2_t *q, int m,
+		int n) {
+	fp12_t *f;
+	pp_job_t *job;
+	int i;
+
+	if (n > m) {
+		n = m;
+	}
+	if (n <= 1) {
+		pp_map_sim_oatep_k12(r, p, q, m);
+		return;
+	}
+
+	f = RLC_ALLOCA(fp12_t, n);
+	job = RLC_ALLOCA(pp_job_t, n);
+
+	RLC_TRY {
+		if (f == NULL || job == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < n; i++) {
+			fp12_null(f[i]);
+			fp12_new(f[i]);
+			/* Slice i covers pairs [i * m / n, (i + 1) * m / n). */
+			job[i].r = &f[i];
+			job[i].p = p + (i * m) / n;
+			job[i].q = q + (i * m) / n;
+			job[i].m = ((i + 1) * m) / n - (i * m) / n;
+		}
+
+		if (core_run_par(pp_mil_job, job, sizeof(pp_job_t), n) != RLC_OK) {
+			RLC_THROW(ERR_CAUGHT);
+		} else {
+			/* Multiply the partial Miller loops and exponentiate once. */
+			fp12_copy(r, f[0]);
+			for (i = 1; i < n; i++) {
+				fp12_mul(r, r, f[i]);
+			}
+			if (fp12_cmp_dig(r, 1) != RLC_EQ) {
+				pp_exp_k12(r, r);
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		if (f != NULL) {
+			for (i = 0; i < n; i++) {
+				fp12_free(f[i]);
+			}
+		}
+		RLC_FREE(f);
+		RLC_FREE(job);
+	}
+}
@@ -30,6 +30,7 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "relic_core.h"
@@ -74,6 +75,87 @@ static void empty(int *a) {
 #define CLOCK			NULL
 #endif
 
+/**
+ * Unit of the measured timings.
+ */
+#if TIMER == POSIX || TIMER == ANSI || (OPSYS == DUINO && TIMER == HREAL)
+#define UNIT			"microsec"
+#elif TIMER == CYCLE || TIMER == PERF
+#define UNIT			"cycles"
+#else
+#define UNIT			"nanosec"
+#endif
+
+#if defined(TIMER) && BENCH > 0
+
+/**
+ * Compares two timings, for sorting.
+ *
+ * @param[in] a				- the first timing.
+ * @param[in] b				- the second timing.
+ * @return RLC_LT, RLC_EQ or RLC_GT.
+ */
+static int compare(const void *a, const void *b) {
+	ull_t x = *(const ull_t *)a, y = *(const ull_t *)b;
+	return (x < y ? RLC_LT : (x > y ? RLC_GT : RLC_EQ));
+}
+
+#endif /* TIMER && BENCH > 0 */
+
+#if BFORM == CSV || BFORM == JSON
+
+/**
+ * Returns a percentile of a sorted vector of timings by the nearest-rank
+ * method.
+ *
+ * @param[in] s				- the sorted timings.
+ * @param[in] n				- the number of timings.
+ * @param[in] p				- the percentile, between 0 and 100.
+ * @return the percentile.
+ */
+static ull_t percentile(const ull_t *s, int n, int p) {
+	int i = (p * n + 99) / 100 - 1;
+
+	if (n == 0) {
+		return 0;
+	}
+	return s[RLC_MIN(RLC_MAX(i, 0), n - 1)];
+}
+
+/**
+ * Prints a benchmark label as a quoted string, escaping it as needed by the
+ * chosen output format.
+ *
+ * @param[in] label			- the label.
+ */
+static void print_label(const char *label) {
+	util_print("\"");
+	for (; label != NULL && *label != '\0'; label++) {
+#if BFORM == CSV
+		if (*label == '"') {
+			util_print("\"");
+		}
+#else
+		if (*label == '"' || *label == '\\') {
+			util_print("\\");
+		}
+#endif
+		util_print("%c", *label);
+	}
+	util_print("\"");
+}
+
+#endif /* BFORM */
+
+/**
+ * Printable names of the counted operations.
+ */
+static const char *names[OP_MAX] = {
+	"fp_mul", "fp_sqr", "fp_inv", "fp2_mul", "fp2_sqr", "fp2_inv", "fp12_mul",
+	"fp12_sqr", "fp12_sqr_cyc", "fp13_mul", "fp13_sqr", "fp13_inv", "ep_add",
+	"ep_dbl", "ep2_add", "ep2_dbl", "ep13_add", "ep13_dbl"
+};
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -123,7 +205,11 @@ void bench_overhead(void) {
 		ctx->over /= BENCH;
 	} while (ctx->over < 0);
 	ctx->total = ctx->over;
+#if BFORM == CSV || BFORM == JSON
+	/* The overhead is reported with the configuration record instead. */
+#else
 	bench_print();
+#endif
 }
 
 #endif /* OVER && TIMER && BENCH > 1 */
@@ -134,6 +220,7 @@ void bench_init(void) {
 #ifdef OVERH
 		ctx->over = 0;
 #endif
+		bench_count_reset();
 #if TIMER == PERF
 		static struct perf_event_attr attr;
 		attr.type = PERF_TYPE_HARDWARE;
@@ -156,9 +243,19 @@ void bench_reset(void) {
 #ifdef TIMER
 	core_get()->total = 0;
 #endif
+#if BENCH > 0
+	core_get()->samples = 0;
+#endif
+#ifdef OPCNT
+	memset(core_get()->opcnt_total, 0, sizeof(core_get()->opcnt_total));
+#endif
 }
 
 void bench_before(void) {
+#ifdef OPCNT
+	memcpy(core_get()->opcnt_before, core_get()->opcnt,
+			sizeof(core_get()->opcnt));
+#endif
 #if OPSYS == DUINO && TIMER == HREAL
 	core_get()->before = micros();
 #elif TIMER == HREAL || TIMER == HPROC || TIMER == HTHRD
@@ -197,10 +294,22 @@ void bench_after(void) {
 
 #ifdef TIMER
 	ctx->total += result;
+#if BENCH > 0
+	/* Keep the first timings, each of which may cover several executions. */
+	if (ctx->samples < BENCH) {
+		ctx->sample[ctx->samples] = result;
+	}
+	ctx->samples++;
+#endif
 #else
 	(void)result;
 	(void)ctx;
 #endif
+#ifdef OPCNT
+	for (int i = 0; i < OP_MAX; i++) {
+		ctx->opcnt_total[i] += ctx->opcnt[i] - ctx->opcnt_before[i];
+	}
+#endif
 }
 
 void bench_compute(int benches) {
@@ -210,33 +319,133 @@ void bench_compute(int benches) {
 #ifdef OVERH
 	ctx->total = ctx->total - ctx->over;
 #endif /* OVERH */
+#if BENCH > 0
+	/* Normalize each timing by the executions it covers and sort them. */
+	ctx->benches = benches;
+	for (int i = 0; i < RLC_MIN(ctx->samples, BENCH); i++) {
+		ctx->sample[i] = ctx->sample[i] * ctx->samples / benches;
+#ifdef OVERH
+		ctx->sample[i] -= ctx->over;
+#endif /* OVERH */
+	}
+	qsort(ctx->sample, RLC_MIN(ctx->samples, BENCH), sizeof(ull_t), compare);
+#endif /* BENCH > 0 */
 #else
-	(void)benches;
 	(void)ctx;
 #endif /* TIMER */
+#ifdef OPCNT
+	for (int i = 0; i < OP_MAX; i++) {
+		ctx->opcnt_total[i] /= benches;
+	}
+#endif
+	(void)benches;
+}
+
+void bench_label(const char *label) {
+#if BENCH > 0
+	core_get()->label = label;
+#endif
+#if BFORM != CSV && BFORM != JSON
+	util_print("BENCH: %s%*c = ", label, (int)(32 - strlen(label)), ' ');
+#endif
 }
 
 void bench_print(void) {
 	ctx_t *ctx = core_get();
 
-#if TIMER == POSIX || TIMER == ANSI || (OPSYS == DUINO && TIMER == HREAL)
-	util_print("%lld microsec", ctx->total);
-#elif TIMER == CYCLE || TIMER == PERF
-	util_print("%lld cycles", ctx->total);
+#if (BFORM == CSV || BFORM == JSON) && BENCH > 0
+	int n = RLC_MIN(ctx->samples, BENCH);
+	ull_t *s = ctx->sample;
+
+#if BFORM == CSV
+	util_print("bench,");
+	print_label(ctx->label);
+	util_print("," UNIT ",%d,%d,%lld,%llu,%llu,%llu,%llu,%llu", ctx->benches,
+			n, ctx->total, percentile(s, n, 0), percentile(s, n, 10),
+			percentile(s, n, 50), percentile(s, n, 90), percentile(s, n, 100));
+#ifdef OPCNT
+	for (int i = 0; i < OP_MAX; i++) {
+		if (ctx->opcnt_total[i] > 0) {
+			util_print(",%s=%llu", names[i], ctx->opcnt_total[i]);
+		}
+	}
+#endif
+	util_print("\n");
 #else
-	util_print("%lld nanosec", ctx->total);
+	util_print("{\"type\":\"bench\",\"label\":");
+	print_label(ctx->label);
+	util_print(",\"unit\":\"" UNIT "\",\"executions\":%d,\"samples\":%d,"
+			"\"mean\":%lld,\"min\":%llu,\"p10\":%llu,\"median\":%llu,"
+			"\"p90\":%llu,\"max\":%llu", ctx->benches, n, ctx->total,
+			percentile(s, n, 0), percentile(s, n, 10), percentile(s, n, 50),
+			percentile(s, n, 90), percentile(s, n, 100));
+#ifdef OPCNT
+	util_print(",\"ops\":{");
+	for (int i = 0, first = 1; i < OP_MAX; i++) {
+		if (ctx->opcnt_total[i] > 0) {
+			util_print("%s\"%s\":%llu", (first ? "" : ","), names[i],
+					ctx->opcnt_total[i]);
+			first = 0;
+		}
+	}
+	util_print("}");
+#endif
+	util_print("}\n");
 #endif
+#else
+	util_print("%lld " UNIT, ctx->total);
 	if (ctx->total < 0) {
 		util_print(" (overflow or bad overhead estimation)\n");
 	} else {
 		util_print("\n");
 	}
+#ifdef OPCNT
+	/* Print the average operation counts of nonzero counters. */
+	int first = 1;
+	for (int i = 0; i < OP_MAX; i++) {
+		if (ctx->opcnt_total[i] > 0) {
+			util_print("%s%s %llu", (first ? "       ops: " : ", "), names[i],
+					ctx->opcnt_total[i]);
+			first = 0;
+		}
+	}
+	if (!first) {
+		util_print("\n");
+	}
+#endif
+#endif /* BFORM */
 }
 
 ull_t bench_total(void) {
 	return core_get()->total;
 }
 
+void bench_count_reset(void) {
+#ifdef OPCNT
+	ctx_t *ctx = core_get();
+	if (ctx != NULL) {
+		memset(ctx->opcnt, 0, sizeof(ctx->opcnt));
+		memset(ctx->opcnt_before, 0, sizeof(ctx->opcnt_before));
+		memset(ctx->opcnt_total, 0, sizeof(ctx->opcnt_total));
+	}
+#endif
+}
+
+void bench_count_get(ull_t *cnt) {
+#ifdef OPCNT
+	memcpy(cnt, core_get()->opcnt, sizeof(core_get()->opcnt));
+#else
+	memset(cnt, 0, OP_MAX * sizeof(ull_t));
+#endif
+}
+
+const char *bench_count_name(int op) {
+	if (op >= 0 && op < OP_MAX) {
+		return names[op];
+	}
+	return "";
+}
+
 void bench_clean(void) {
 #if TIMER == PERF
 	ctx_t *ctx = core_get();
@@ -55,12 +55,117 @@
 #define _QUOTE(A)			#A
 /** @} */
 
+#if BFORM == CSV || BFORM == JSON
+
+/**
+ * Prints one entry of the configuration record.
+ *
+ * @param[in] key			- the name of the entry.
+ * @param[in] value			- the value of the entry.
+ */
+static void conf_entry(const char *key, const char *value) {
+#if BFORM == CSV
+	util_print("conf,%s,\"%s\"\n", key, value);
+#else
+	util_print(",\"%s\":\"%s\"", key, value);
+#endif
+}
+
+/**
+ * Prints one numeric entry of the configuration record.
+ *
+ * @param[in] key			- the name of the entry.
+ * @param[in] value			- the value of the entry.
+ */
+static void conf_entry_int(const char *key, long long value) {
+	char str[32];
+
+	snprintf(str, sizeof(str), "%lld", value);
+	conf_entry(key, str);
+}
+
+/**
+ * Prints the build configuration as a machine-readable record, so that
+ * benchmark results can be matched with the build that produced them.
+ */
+static void conf_record(void) {
+#if BFORM == JSON
+	util_print("{\"type\":\"conf\"");
+#endif
+	conf_entry("version", RLC_VERSION);
+#if ALLOC == DYNAMIC
+	conf_entry("alloc", "DYNAMIC");
+#elif ALLOC == AUTO
+	conf_entry("alloc", "AUTO");
+#endif
+#if ARITH == EASY
+	conf_entry("arith", "easy");
+#elif ARITH == GMP
+	conf_entry("arith", "gmp");
+#elif ARITH == GMP_SEC
+	conf_entry("arith", "gmp-sec");
+#else
+	conf_entry("arith", QUOTE(ARITH));
+#endif
+#ifdef LABEL
+	conf_entry("label", QUOTE(LABEL));
+#endif
+	conf_entry_int("bench", BENCH * BENCH);
+#if defined(OVERH) && defined(TIMER) && BENCH > 1
+	bench_overhead();
+	conf_entry_int("overhead", bench_total());
+#endif
+#ifdef OPCNT
+	conf_entry("opcnt", "on");
+#endif
+#ifdef WITH_BN
+	conf_entry_int("bn_bits", RLC_BN_BITS);
+	conf_entry("bn_methd", BN_METHD);
+#endif
+#ifdef WITH_FP
+	conf_entry_int("fp_bits", RLC_FP_BITS);
+	conf_entry("fp_methd", FP_METHD);
+#endif
+#ifdef WITH_FPX
+	conf_entry("fpx_methd", FPX_METHD);
+#endif
+#ifdef WITH_EP
+	conf_entry("ep_methd", EP_METHD);
+#endif
+#ifdef WITH_PP
+	conf_entry("pp_methd", PP_METHD);
+#endif
+#ifdef WITH_FB
+	conf_entry_int("fb_bits", RLC_FB_BITS);
+	conf_entry("fb_methd", FB_METHD);
+#endif
+#ifdef WITH_EB
+	conf_entry("eb_methd", EB_METHD);
+#endif
+#ifdef WITH_EC
+	conf_entry("ec_methd", EC_METHD);
+#endif
+#ifdef WITH_ED
+	conf_entry("ed_methd", ED_METHD);
+#endif
+#ifdef WITH_MD
+	conf_entry("md_methd", MD_METHD);
+#endif
+#if BFORM == JSON
+	util_print("}\n");
+#endif
+}
+
+#endif /* BFORM */
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
 
 void conf_print(void) {
-#ifndef QUIET
+#if BFORM == CSV || BFORM == JSON
+	conf_record();
+#elif !defined(QUIET)
 	util_print("-- RELIC " RLC_VERSION " configuration:\n\n");
 #if ALLOC == DYNAMIC
 	util_print("** Allocation mode: DYNAMIC\n\n");
@@ -88,6 +193,9 @@ void conf_print(void) {
 #ifdef OVERH
 	util_print("   Estimated overhead: ");
 	bench_overhead();
+#endif
+#ifdef OPCNT
+	util_print("   Operation counters: on\n");
 #endif
 	util_print("\n");
 #endif
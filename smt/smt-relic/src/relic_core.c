@@ -72,6 +72,62 @@
 /** Error message respective to ERR_NO_CURVE. */
 #define MSG_NO_RAND			"faulty pseudo-random number generator"
 
+/**
+ * Job run by core_run_par() on a slice of a computation.
+ */
+typedef struct {
+	/** The function computing the job. */
+	void (*f)(void *);
+	/** The argument of the function. */
+	void *arg;
+	/** The library context of the calling thread. */
+	ctx_t *ctx;
+	/** The error code produced by the job. */
+	int code;
+} core_job_t;
+
+/**
+ * Runs a job. When running in a worker thread, the function installs a private
+ * copy of the library context of the calling thread, so that the error state
+ * is not shared, and restores the context the worker had before returning.
+ *
+ * @param[in,out] arg		- the job to run.
+ * @return NULL.
+ */
+static void *core_job(void *arg) {
+	core_job_t *job = (core_job_t *)arg;
+	ctx_t *ctx = NULL, *old = core_get();
+
+	if (old != job->ctx) {
+		ctx = (ctx_t *)malloc(sizeof(ctx_t));
+		if (ctx == NULL) {
+			job->code = RLC_ERR;
+			return NULL;
+		}
+		memcpy(ctx, job->ctx, sizeof(ctx_t));
+#ifdef CHECK
+		ctx->last = NULL;
+#endif
+		ctx->code = RLC_OK;
+		core_set(ctx);
+	}
+
+	RLC_TRY {
+		job->f(job->arg);
+	} RLC_CATCH_ANY {
+		job->code = RLC_ERR;
+	}
+
+	if (ctx != NULL) {
+		if (ctx->code != RLC_OK) {
+			job->code = RLC_ERR;
+		}
+		core_set(old);
+		free(ctx);
+	}
+	return NULL;
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -207,6 +263,71 @@ void core_set(ctx_t *ctx) {
 	core_ctx = ctx;
 }
 
+int core_run_par(void (*f)(void *), void *arg, size_t size, int n) {
+	core_job_t *job;
+	int i, code = RLC_OK;
+#if MULTI == PTHREAD
+	pthread_t *tid;
+#endif
+
+	job = (core_job_t *)malloc(n * sizeof(core_job_t));
+#if MULTI == PTHREAD
+	tid = (pthread_t *)malloc(n * sizeof(pthread_t));
+	if (tid == NULL) {
+		free(job);
+		return RLC_ERR;
+	}
+#endif
+	if (job == NULL) {
+#if MULTI == PTHREAD
+		free(tid);
+#endif
+		return RLC_ERR;
+	}
+
+	for (i = 0; i < n; i++) {
+		job[i].f = f;
+		job[i].arg = (char *)arg + i * size;
+		job[i].ctx = core_get();
+		job[i].code = RLC_OK;
+	}
+
+#if MULTI == PTHREAD
+	/* The calling thread runs the first job itself. */
+	for (i = 1; i < n; i++) {
+		if (pthread_create(&tid[i], NULL, core_job, &job[i]) != 0) {
+			/* Could not spawn a worker, so run the job here. */
+			tid[i] = pthread_self();
+			core_job(&job[i]);
+		}
+	}
+	core_job(&job[0]);
+	for (i = 1; i < n; i++) {
+		if (!pthread_equal(tid[i], pthread_self())) {
+			pthread_join(tid[i], NULL);
+		}
+	}
+	free(tid);
+#elif MULTI == OPENMP
+	#pragma omp parallel for num_threads(n) schedule(static, 1)
+	for (i = 0; i < n; i++) {
+		core_job(&job[i]);
+	}
+#else
+	for (i = 0; i < n; i++) {
+		core_job(&job[i]);
+	}
+#endif
+
+	for (i = 0; i < n; i++) {
+		if (job[i].code != RLC_OK) {
+			code = RLC_ERR;
+		}
+	}
+	free(job);
+	return code;
+}
+
 #if defined(MULTI)
 void core_set_thread_initializer(void(*init)(void *init_ptr), void* init_ptr) {
     core_thread_initializer = init;
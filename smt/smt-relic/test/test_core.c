@@ -34,6 +34,16 @@
 #include "relic.h"
 #include "relic_test.h"
 
+static void square(void *ptr) {
+	int *x = (int *)ptr;
+	*x = *x * *x;
+}
+
+static void fail(void *ptr) {
+	(void)ptr;
+	RLC_THROW(ERR_NO_VALID);
+}
+
 #if defined(MULTI)
 #if MULTI == PTHREAD
 
@@ -100,6 +110,19 @@ int main(void) {
 		core_set(old_ctx);
 	} TEST_END;
 
+	TEST_ONCE("running parallel jobs is correct") {
+		int x[4] = { 1, 2, 3, 4 };
+		ctx_t *ctx = core_get();
+		TEST_ASSERT(core_run_par(square, x, sizeof(int), 4) == RLC_OK, end);
+		TEST_ASSERT(x[0] == 1 && x[1] == 4 && x[2] == 9 && x[3] == 16, end);
+		TEST_ASSERT(core_get() == ctx, end);
+#ifdef CHECK
+		TEST_ASSERT(core_run_par(fail, x, sizeof(int), 4) == RLC_ERR, end);
+		TEST_ASSERT(core_get() == ctx, end);
+		err_get_code();
+#endif
+	} TEST_END;
+
 	code = RLC_OK;
 
 #if defined(MULTI)
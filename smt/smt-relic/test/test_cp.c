@@ -1462,11 +1462,14 @@ static int bgn(void) {
 }
 
 static int bls(void) {
-	int code = RLC_ERR;
-	bn_t d;
-	g1_t s;
-	g2_t q;
-	uint8_t m[5] = { 0, 1, 2, 3, 4 };
+	int i, j, code = RLC_ERR;
+	bn_t d, _d[4];
+	g1_t s, t[4];
+	g2_t q, _q[4];
+	g2_key_t k[4];
+	uint8_t m[5] = { 0, 1, 2, 3, 4 }, _m[4][5];
+	const uint8_t *ms[4];
+	size_t ls[4];
 
 	bn_null(d);
 	g1_null(s);
@@ -1476,6 +1479,16 @@ static int bls(void) {
 		bn_new(d);
 		g1_new(s);
 		g2_new(q);
+		for (i = 0; i < 4; i++) {
+			bn_null(_d[i]);
+			g1_null(t[i]);
+			g2_null(_q[i]);
+			g2_key_null(k[i]);
+			bn_new(_d[i]);
+			g1_new(t[i]);
+			g2_new(_q[i]);
+			g2_key_new(k[i]);
+		}
 
 		TEST_CASE("boneh-lynn-schacham short signature is correct") {
 			TEST_ASSERT(cp_bls_gen(d, q) == RLC_OK, end);
@@ -1487,6 +1500,78 @@ static int bls(void) {
 			TEST_ASSERT(cp_bls_ver(s, m, sizeof(m), q) == 0, end);
 		}
 		TEST_END;
+
+		TEST_CASE("boneh-lynn-schacham aggregate signature is correct") {
+			for (j = 0; j < 4; j++) {
+				TEST_ASSERT(cp_bls_gen(_d[j], _q[j]) == RLC_OK, end);
+				TEST_ASSERT(cp_bls_sig(t[j], m, sizeof(m), _d[j]) == RLC_OK,
+						end);
+			}
+			TEST_ASSERT(cp_bls_agg_sig(s, t, 4) == RLC_OK, end);
+			TEST_ASSERT(cp_bls_agg_ver(s, m, sizeof(m), _q, 4) == 1, end);
+			/* Keys are now cached, so check the result does not change. */
+			TEST_ASSERT(cp_bls_agg_ver(s, m, sizeof(m), _q, 4) == 1, end);
+			TEST_ASSERT(cp_bls_agg_ver(s, m, sizeof(m), _q, 3) == 0, end);
+			TEST_ASSERT(cp_bls_agg_ver(t[0], m, sizeof(m), _q, 4) == 0, end);
+			m[0] ^= 1;
+			TEST_ASSERT(cp_bls_agg_ver(s, m, sizeof(m), _q, 4) == 0, end);
+			m[0] ^= 1;
+		}
+		TEST_END;
+
+		TEST_CASE("boneh-lynn-schacham batch verification is correct") {
+			for (j = 0; j < 4; j++) {
+				TEST_ASSERT(cp_bls_gen(_d[j], _q[j]) == RLC_OK, end);
+				rand_bytes(_m[j], sizeof(_m[j]));
+				ms[j] = _m[j];
+				ls[j] = sizeof(_m[j]);
+				TEST_ASSERT(cp_bls_sig(t[j], _m[j], ls[j], _d[j]) == RLC_OK,
+						end);
+			}
+			TEST_ASSERT(cp_bls_bat_ver(t, ms, ls, _q, 4) == 1, end);
+			TEST_ASSERT(cp_bls_bat_ver(t, ms, ls, _q, 1) == 1, end);
+			/* Swapping two signatures must be caught. */
+			g1_copy(s, t[0]);
+			g1_copy(t[0], t[1]);
+			g1_copy(t[1], s);
+			TEST_ASSERT(cp_bls_bat_ver(t, ms, ls, _q, 4) == 0, end);
+			g1_copy(t[1], t[0]);
+			g1_copy(t[0], s);
+			/* A signature and its negation on another message cancel out
+			 * without randomization. */
+			g1_add(t[2], t[2], t[0]);
+			g1_sub(t[3], t[3], t[0]);
+			TEST_ASSERT(cp_bls_bat_ver(t, ms, ls, _q, 4) == 0, end);
+			g2_set_infty(_q[3]);
+			TEST_ASSERT(cp_bls_bat_ver(t, ms, ls, _q, 4) == 0, end);
+		}
+		TEST_END;
+
+		TEST_CASE("boneh-lynn-schacham prepared-key verification is correct") {
+			for (j = 0; j < 4; j++) {
+				TEST_ASSERT(cp_bls_gen(_d[j], _q[j]) == RLC_OK, end);
+				TEST_ASSERT(g2_key_set(k[j], _q[j]) == 1, end);
+				rand_bytes(_m[j], sizeof(_m[j]));
+				ms[j] = _m[j];
+				ls[j] = sizeof(_m[j]);
+				TEST_ASSERT(cp_bls_sig(t[j], _m[j], ls[j], _d[j]) == RLC_OK,
+						end);
+			}
+			TEST_ASSERT(cp_bls_ver_key(t[0], ms[0], ls[0], k[0]) == 1, end);
+			TEST_ASSERT(cp_bls_ver_key(t[0], ms[0], ls[0], k[1]) == 0, end);
+			TEST_ASSERT(cp_bls_ver_key(t[1], ms[0], ls[0], k[0]) == 0, end);
+			g1_copy(s, t[0]);
+			fp_add_dig(s->y, s->y, 1);
+			TEST_ASSERT(cp_bls_ver_key(s, ms[0], ls[0], k[0]) == 0, end);
+			TEST_ASSERT(cp_bls_bat_ver_key(t, ms, ls, k, 4) == 1, end);
+			g1_add(t[2], t[2], t[0]);
+			g1_sub(t[3], t[3], t[0]);
+			TEST_ASSERT(cp_bls_bat_ver_key(t, ms, ls, k, 4) == 0, end);
+			g2_set_infty(_q[0]);
+			TEST_ASSERT(g2_key_set(k[0], _q[0]) == 0, end);
+			TEST_ASSERT(cp_bls_ver_key(t[0], ms[0], ls[0], k[0]) == 0, end);
+		}
+		TEST_END;
 	}
 	RLC_CATCH_ANY {
 		RLC_ERROR(end);
@@ -1497,6 +1582,12 @@ static int bls(void) {
 	bn_free(d);
 	g1_free(s);
 	g2_free(q);
+	for (i = 0; i < 4; i++) {
+		bn_free(_d[i]);
+		g1_free(t[i]);
+		g2_free(_q[i]);
+		g2_key_free(k[i]);
+	}
 	return code;
 }
 
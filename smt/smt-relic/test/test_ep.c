@@ -577,6 +577,8 @@ static int multiplication(void) {
 	int code = RLC_ERR;
 	bn_t n, k;
 	ep_t p, q, r;
+	const int *b;
+	int l;
 
 	bn_null(n);
 	bn_null(k);
@@ -772,6 +774,20 @@ static int multiplication(void) {
 			TEST_ASSERT(ep_cmp(q, r) == RLC_EQ, end);
 		}
 		TEST_END;
+		TEST_CASE("point multiplication by sparse integer is correct") {
+			b = fp_prime_get_par_sps(&l);
+			if (l > 0) {
+				fp_prime_get_par(k);
+				ep_mul(q, p, k);
+				ep_mul_sps(r, p, b, l, bn_sign(k));
+				TEST_ASSERT(ep_cmp(q, r) == RLC_EQ, end);
+				ep_dbl(q, p);
+				ep_mul_sps(r, q, b, l, bn_sign(k));
+				ep_mul(q, q, k);
+				TEST_ASSERT(ep_cmp(q, r) == RLC_EQ, end);
+			}
+		}
+		TEST_END;
 	}
 	RLC_CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -985,10 +1001,18 @@ static int fixed(void) {
 	return code;
 }
 
+/**
+ * Number of points in the large bucket test. With 16-bit scalars, this selects
+ * windows of 9 bits and thus enough buckets to fill a batch of 256 additions.
+ */
+#define LOT			1024
+
 static int simultaneous(void) {
 	int code = RLC_ERR;
 	bn_t n, k[17];
 	ep_t p[17], r;
+	bn_t *s = NULL;
+	ep_t *q = NULL;
 
 	bn_null(n);
 	ep_null(r);
@@ -1002,6 +1026,17 @@ static int simultaneous(void) {
 			ep_null(p[i]);
 			ep_new(p[i]);
 		}
+		s = (bn_t *)calloc(LOT, sizeof(bn_t));
+		q = (ep_t *)calloc(LOT, sizeof(ep_t));
+		if (s == NULL || q == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (int i = 0; i < LOT; i++) {
+			bn_null(s[i]);
+			bn_new(s[i]);
+			ep_null(q[i]);
+			ep_new(q[i]);
+		}
 
 		ep_curve_get_gen(p[0]);
 		ep_curve_get_ord(n);
@@ -1286,6 +1321,84 @@ static int simultaneous(void) {
 			ep_mul_sim_lot(p[16], p, k, 16);
 			TEST_ASSERT(ep_cmp(p[16], r) == RLC_EQ, end);
 		} TEST_END;
+
+		TEST_CASE("bucket simultaneous point multiplication is correct") {
+			ep_mul_sim_bucket(p[16], p, k, 0);
+			TEST_ASSERT(ep_is_infty(p[16]), end);
+			for (int j = 0; j < 16; j++) {
+				bn_rand_mod(k[j], n);
+				ep_rand(p[j]);
+			}
+			ep_mul_sim_lot(r, p, k, 16);
+			ep_mul_sim_bucket(p[16], p, k, 16);
+			TEST_ASSERT(ep_cmp(p[16], r) == RLC_EQ, end);
+			/* Repeated and opposite points fall into the same buckets. */
+			ep_copy(p[1], p[0]);
+			ep_neg(p[2], p[0]);
+			bn_copy(k[1], k[0]);
+			bn_copy(k[2], k[0]);
+			bn_zero(k[3]);
+			ep_set_infty(p[4]);
+			bn_neg(k[5], k[5]);
+			ep_dbl(p[6], p[6]);
+			ep_mul_sim_lot(r, p, k, 16);
+			ep_mul_sim_bucket(p[16], p, k, 16);
+			TEST_ASSERT(ep_cmp(p[16], r) == RLC_EQ, end);
+		} TEST_END;
+
+		TEST_ONCE("bucket multiplication of many points is correct") {
+			/* The low digits of the first 256 scalars hit distinct buckets, so
+			 * the next 256 points fill a batch of affine additions. */
+			ep_set_infty(r);
+			for (int j = 0; j < LOT; j++) {
+				bn_rand(s[j], RLC_POS, 7);
+				bn_lsh(s[j], s[j], 9);
+				bn_add_dig(s[j], s[j], (j % 256) + 1);
+				if (j >= 512 && j < 544) {
+					/* Repeated and opposite points. */
+					ep_copy(q[j], q[j % 256]);
+					if (j & 1) {
+						ep_neg(q[j], q[j]);
+					}
+				} else {
+					ep_rand(q[j]);
+				}
+				if (j == 0) {
+					bn_set_bit(s[j], 15, 1);
+				}
+				if (j >= 544 && j < 576) {
+					bn_rand(s[j], RLC_POS, 1 + j % 8);
+				}
+				if (j == LOT - 2) {
+					bn_zero(s[j]);
+				}
+				if (j == LOT - 1) {
+					ep_set_infty(q[j]);
+				}
+				ep_mul(p[16], q[j], s[j]);
+				if (j >= 576 && j < 608) {
+					bn_neg(s[j], s[j]);
+					ep_neg(p[16], p[16]);
+				}
+				ep_add(r, r, p[16]);
+			}
+			ep_mul_sim_lot(p[16], q, s, LOT);
+			TEST_ASSERT(ep_cmp(p[16], r) == RLC_EQ, end);
+		} TEST_END;
+
+		TEST_CASE("parallel simultaneous point multiplication is correct") {
+			for (int j = 0; j < 16; j++) {
+				bn_rand_mod(k[j], n);
+				ep_rand(p[j]);
+			}
+			ep_mul_sim_lot(r, p, k, 16);
+			for (int j = 1; j <= 32; j *= 2) {
+				ep_mul_sim_par(p[16], p, k, 16, j);
+				TEST_ASSERT(ep_cmp(p[16], r) == RLC_EQ, end);
+			}
+			ep_mul_sim_par(p[16], p, k, 16, 3);
+			TEST_ASSERT(ep_cmp(p[16], r) == RLC_EQ, end);
+		} TEST_END;
 	}
 	RLC_CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -1299,6 +1412,18 @@ static int simultaneous(void) {
 		ep_free(p[i]);
 	}
 	ep_free(r);
+	if (s != NULL) {
+		for (int i = 0; i < LOT; i++) {
+			bn_free(s[i]);
+		}
+	}
+	if (q != NULL) {
+		for (int i = 0; i < LOT; i++) {
+			ep_free(q[i]);
+		}
+	}
+	free(s);
+	free(q);
 	return code;
 }
 
@@ -411,6 +411,8 @@ static int multiplication2(void) {
 	int code = RLC_ERR;
 	bn_t n, k;
 	ep2_t p, q, r;
+	const int *b;
+	int l;
 
 	bn_null(n);
 	bn_null(k);
@@ -578,6 +580,20 @@ static int multiplication2(void) {
 			TEST_ASSERT(ep2_cmp(q, r) == RLC_EQ, end);
 		}
 		TEST_END;
+		TEST_CASE("point multiplication by sparse integer is correct") {
+			b = fp_prime_get_par_sps(&l);
+			if (l > 0) {
+				fp_prime_get_par(k);
+				ep2_mul(q, p, k);
+				ep2_mul_sps(r, p, b, l, bn_sign(k));
+				TEST_ASSERT(ep2_cmp(q, r) == RLC_EQ, end);
+				ep2_dbl(q, p);
+				ep2_mul_sps(r, q, b, l, bn_sign(k));
+				ep2_mul(q, q, k);
+				TEST_ASSERT(ep2_cmp(q, r) == RLC_EQ, end);
+			}
+		}
+		TEST_END;
 	}
 	RLC_CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -791,10 +807,18 @@ static int fixed2(void) {
 	return code;
 }
 
+/**
+ * Number of points in the large bucket test. With 16-bit scalars, this selects
+ * windows of 9 bits and thus enough buckets to fill a batch of 256 additions.
+ */
+#define LOT			1024
+
 static int simultaneous2(void) {
 	int code = RLC_ERR;
 	bn_t n, k[17];
 	ep2_t p[17], r;
+	bn_t *s = NULL;
+	ep2_t *q = NULL;
 
 	bn_null(n);
 	ep2_null(r);
@@ -807,6 +831,17 @@ static int simultaneous2(void) {
 			ep2_null(p[i]);
 			ep2_new(p[i]);
 		}
+		s = (bn_t *)calloc(LOT, sizeof(bn_t));
+		q = (ep2_t *)calloc(LOT, sizeof(ep2_t));
+		if (s == NULL || q == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (int i = 0; i < LOT; i++) {
+			bn_null(s[i]);
+			bn_new(s[i]);
+			ep2_null(q[i]);
+			ep2_new(q[i]);
+		}
 
 		ep2_curve_get_gen(p[0]);
 		ep2_curve_get_ord(n);
@@ -1045,6 +1080,84 @@ static int simultaneous2(void) {
 			ep2_mul_sim_lot(p[16], p, k, 16);
 			TEST_ASSERT(ep2_cmp(p[16], r) == RLC_EQ, end);
 		} TEST_END;
+
+		TEST_CASE("bucket simultaneous point multiplication is correct") {
+			ep2_mul_sim_bucket(p[16], p, k, 0);
+			TEST_ASSERT(ep2_is_infty(p[16]), end);
+			for (int j = 0; j < 16; j++) {
+				bn_rand_mod(k[j], n);
+				ep2_rand(p[j]);
+			}
+			ep2_mul_sim_lot(r, p, k, 16);
+			ep2_mul_sim_bucket(p[16], p, k, 16);
+			TEST_ASSERT(ep2_cmp(p[16], r) == RLC_EQ, end);
+			/* Repeated and opposite points fall into the same buckets. */
+			ep2_copy(p[1], p[0]);
+			ep2_neg(p[2], p[0]);
+			bn_copy(k[1], k[0]);
+			bn_copy(k[2], k[0]);
+			bn_zero(k[3]);
+			ep2_set_infty(p[4]);
+			bn_neg(k[5], k[5]);
+			ep2_dbl(p[6], p[6]);
+			ep2_mul_sim_lot(r, p, k, 16);
+			ep2_mul_sim_bucket(p[16], p, k, 16);
+			TEST_ASSERT(ep2_cmp(p[16], r) == RLC_EQ, end);
+		} TEST_END;
+
+		TEST_ONCE("bucket multiplication of many points is correct") {
+			/* The low digits of the first 256 scalars hit distinct buckets, so
+			 * the next 256 points fill a batch of affine additions. */
+			ep2_set_infty(r);
+			for (int j = 0; j < LOT; j++) {
+				bn_rand(s[j], RLC_POS, 7);
+				bn_lsh(s[j], s[j], 9);
+				bn_add_dig(s[j], s[j], (j % 256) + 1);
+				if (j >= 512 && j < 544) {
+					/* Repeated and opposite points. */
+					ep2_copy(q[j], q[j % 256]);
+					if (j & 1) {
+						ep2_neg(q[j], q[j]);
+					}
+				} else {
+					ep2_rand(q[j]);
+				}
+				if (j == 0) {
+					bn_set_bit(s[j], 15, 1);
+				}
+				if (j >= 544 && j < 576) {
+					bn_rand(s[j], RLC_POS, 1 + j % 8);
+				}
+				if (j == LOT - 2) {
+					bn_zero(s[j]);
+				}
+				if (j == LOT - 1) {
+					ep2_set_infty(q[j]);
+				}
+				ep2_mul(p[16], q[j], s[j]);
+				if (j >= 576 && j < 608) {
+					bn_neg(s[j], s[j]);
+					ep2_neg(p[16], p[16]);
+				}
+				ep2_add(r, r, p[16]);
+			}
+			ep2_mul_sim_lot(p[16], q, s, LOT);
+			TEST_ASSERT(ep2_cmp(p[16], r) == RLC_EQ, end);
+		} TEST_END;
+
+		TEST_CASE("parallel simultaneous point multiplication is correct") {
+			for (int j = 0; j < 16; j++) {
+				bn_rand_mod(k[j], n);
+				ep2_rand(p[j]);
+			}
+			ep2_mul_sim_lot(r, p, k, 16);
+			for (int j = 1; j <= 32; j *= 2) {
+				ep2_mul_sim_par(p[16], p, k, 16, j);
+				TEST_ASSERT(ep2_cmp(p[16], r) == RLC_EQ, end);
+			}
+			ep2_mul_sim_par(p[16], p, k, 16, 3);
+			TEST_ASSERT(ep2_cmp(p[16], r) == RLC_EQ, end);
+		} TEST_END;
 	}
 	RLC_CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -1058,6 +1171,18 @@ static int simultaneous2(void) {
 		bn_free(k[i]);
 		ep2_free(p[i]);
 	}
+	if (s != NULL) {
+		for (int i = 0; i < LOT; i++) {
+			bn_free(s[i]);
+		}
+	}
+	if (q != NULL) {
+		for (int i = 0; i < LOT; i++) {
+			ep2_free(q[i]);
+		}
+	}
+	free(s);
+	free(q);
 	return code;
 }
 
@@ -1553,6 +1678,8 @@ static int multiplication4(void) {
 	int code = RLC_ERR;
 	bn_t n, k;
 	ep4_t p, q, r;
+	const int *b;
+	int l;
 
 	bn_null(n);
 	bn_null(k);
@@ -1695,6 +1822,20 @@ static int multiplication4(void) {
 			TEST_ASSERT(ep4_cmp(q, r) == RLC_EQ, end);
 		}
 		TEST_END;
+		TEST_CASE("multiplication by sparse integer is correct") {
+			b = fp_prime_get_par_sps(&l);
+			if (l > 0) {
+				fp_prime_get_par(k);
+				ep4_mul(q, p, k);
+				ep4_mul_sps(r, p, b, l, bn_sign(k));
+				TEST_ASSERT(ep4_cmp(q, r) == RLC_EQ, end);
+				ep4_dbl(q, p);
+				ep4_mul_sps(r, q, b, l, bn_sign(k));
+				ep4_mul(q, q, k);
+				TEST_ASSERT(ep4_cmp(q, r) == RLC_EQ, end);
+			}
+		}
+		TEST_END;
 	}
 	RLC_CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -2200,8 +2341,288 @@ static int frobenius4(void) {
 	return code;
 }
 
+static int util13(void) {
+	int l, code = RLC_ERR;
+	bn_t k;
+	ep13_t a, b, c;
+	uint8_t bin[26 * RLC_FP_BYTES + 1];
+
+	bn_null(k);
+	ep13_null(a);
+	ep13_null(b);
+	ep13_null(c);
+
+	RLC_TRY {
+		bn_new(k);
+		ep13_new(a);
+		ep13_new(b);
+		ep13_new(c);
+
+		TEST_CASE("reading and writing a point are consistent") {
+			for (int j = 0; j < 2; j++) {
+				ep13_set_infty(a);
+				l = ep13_size_bin(a, j);
+				TEST_ASSERT(l == 1, end);
+				ep13_write_bin(bin, l, a, j);
+				ep13_read_bin(b, bin, l);
+				TEST_ASSERT(ep13_is_infty(b), end);
+				ep13_curve_get_gen(a);
+				bn_rand(k, RLC_POS, RLC_DIG);
+				ep13_mul_basic(a, a, k);
+				l = ep13_size_bin(a, j);
+				ep13_write_bin(bin, l, a, j);
+				ep13_read_bin(b, bin, l);
+				TEST_ASSERT(ep13_cmp(a, b) == RLC_EQ, end);
+				ep13_neg(a, a);
+				ep13_write_bin(bin, l, a, j);
+				ep13_read_bin(b, bin, l);
+				TEST_ASSERT(ep13_cmp(a, b) == RLC_EQ, end);
+			}
+		}
+		TEST_END;
+
+		TEST_CASE("point compression is correct") {
+			ep13_curve_get_gen(a);
+			bn_rand(k, RLC_POS, RLC_DIG);
+			ep13_mul_basic(a, a, k);
+			ep13_norm(a, a);
+			ep13_pck(b, a);
+			TEST_ASSERT(ep13_upk(c, b) == 1, end);
+			TEST_ASSERT(ep13_cmp(a, c) == RLC_EQ, end);
+			ep13_neg(a, a);
+			ep13_pck(b, a);
+			TEST_ASSERT(ep13_upk(c, b) == 1, end);
+			TEST_ASSERT(ep13_cmp(a, c) == RLC_EQ, end);
+		}
+		TEST_END;
+	}
+	RLC_CATCH_ANY {
+		util_print("FATAL ERROR!\n");
+		RLC_ERROR(end);
+	}
+	code = RLC_OK;
+  end:
+	bn_free(k);
+	ep13_free(a);
+	ep13_free(b);
+	ep13_free(c);
+	return code;
+}
+
+static int multiplication13(void) {
+	int code = RLC_ERR;
+	bn_t k, n;
+	ep13_t p, q, r, t[RLC_EP13_TABLE_MAX];
+	const int *b;
+	int l;
+
+	bn_null(k);
+	bn_null(n);
+	ep13_null(p);
+	ep13_null(q);
+	ep13_null(r);
+
+	for (int i = 0; i < RLC_EP13_TABLE_MAX; i++) {
+		ep13_null(t[i]);
+	}
+
+	RLC_TRY {
+		bn_new(k);
+		bn_new(n);
+		ep13_new(p);
+		ep13_new(q);
+		ep13_new(r);
+
+		ep13_curve_get_gen(p);
+		ep_curve_get_ord(n);
+
+		TEST_CASE("point multiplication by sparse integer is correct") {
+			b = fp_prime_get_par_sps(&l);
+			fp_prime_get_par(k);
+			ep13_mul_basic(q, p, k);
+			ep13_mul_sps(r, p, b, l, bn_sign(k));
+			TEST_ASSERT(ep13_cmp(q, r) == RLC_EQ, end);
+			ep13_rand_mul_u(r, p);
+			TEST_ASSERT(ep13_cmp(q, r) == RLC_EQ, end);
+			ep13_dbl(q, p);
+			ep13_mul_sps(r, q, b, l, bn_sign(k));
+			ep13_mul_basic(q, q, k);
+			TEST_ASSERT(ep13_cmp(q, r) == RLC_EQ, end);
+		}
+		TEST_END;
+
+#if EP_MUL == LWNAF || !defined(STRIP)
+		TEST_CASE("w-naf point multiplication is correct") {
+			bn_rand_mod(k, n);
+			ep13_curve_get_gen(p);
+			ep13_mul_basic(p, p, k);
+			bn_zero(k);
+			ep13_mul_lwnaf(r, p, k);
+			TEST_ASSERT(ep13_is_infty(r), end);
+			bn_set_dig(k, 1);
+			ep13_mul_lwnaf(r, p, k);
+			TEST_ASSERT(ep13_cmp(p, r) == RLC_EQ, end);
+			bn_sub_dig(k, n, 1);
+			ep13_mul_lwnaf(r, p, k);
+			ep13_neg(q, p);
+			TEST_ASSERT(ep13_cmp(q, r) == RLC_EQ, end);
+			bn_rand(k, RLC_POS, RLC_DIG / 2);
+			ep13_mul_basic(q, p, k);
+			ep13_mul_lwnaf(r, p, k);
+			TEST_ASSERT(ep13_cmp(q, r) == RLC_EQ, end);
+			bn_rand_mod(k, n);
+			ep13_mul_basic(q, p, k);
+			ep13_mul_lwnaf(r, p, k);
+			TEST_ASSERT(ep13_cmp(q, r) == RLC_EQ, end);
+			bn_neg(k, k);
+			ep13_mul_lwnaf(r, p, k);
+			ep13_neg(r, r);
+			TEST_ASSERT(ep13_cmp(q, r) == RLC_EQ, end);
+			bn_neg(k, k);
+			bn_add(k, k, n);
+			ep13_mul_lwnaf(r, p, k);
+			TEST_ASSERT(ep13_cmp(q, r) == RLC_EQ, end);
+			ep13_mul_lwnaf(p, p, k);
+			TEST_ASSERT(ep13_cmp(p, q) == RLC_EQ, end);
+		} TEST_END;
+#endif
+
+		for (int i = 0; i < RLC_EP13_TABLE_MAX; i++) {
+			ep13_new(t[i]);
+		}
+
+#if EP_FIX == COMBS || EP_FIX == BASIC || EP_FIX == COMBD || !defined(STRIP)
+		TEST_CASE("single-table comb fixed point multiplication is correct") {
+			bn_rand_mod(k, n);
+			ep13_curve_get_gen(p);
+			ep13_mul_basic(p, p, k);
+			ep13_mul_pre_combs(t, p);
+			bn_zero(k);
+			ep13_mul_fix_combs(r, t, k);
+			TEST_ASSERT(ep13_is_infty(r), end);
+			bn_set_dig(k, 1);
+			ep13_mul_fix_combs(r, t, k);
+			TEST_ASSERT(ep13_cmp(p, r) == RLC_EQ, end);
+			bn_sub_dig(k, n, 1);
+			ep13_mul_fix_combs(r, t, k);
+			ep13_neg(q, p);
+			TEST_ASSERT(ep13_cmp(q, r) == RLC_EQ, end);
+			bn_rand(k, RLC_POS, RLC_DIG / 2);
+			ep13_mul_basic(q, p, k);
+			ep13_mul_fix_combs(r, t, k);
+			TEST_ASSERT(ep13_cmp(q, r) == RLC_EQ, end);
+			bn_rand_mod(k, n);
+			ep13_mul_basic(q, p, k);
+			ep13_mul_fix_combs(r, t, k);
+			TEST_ASSERT(ep13_cmp(q, r) == RLC_EQ, end);
+			bn_neg(k, k);
+			ep13_mul_fix_combs(r, t, k);
+			ep13_neg(r, r);
+			TEST_ASSERT(ep13_cmp(q, r) == RLC_EQ, end);
+			bn_neg(k, k);
+			bn_add(k, k, n);
+			ep13_mul_fix_combs(r, t, k);
+			TEST_ASSERT(ep13_cmp(q, r) == RLC_EQ, end);
+		} TEST_END;
+#endif
+
+#if EP_FIX == LWNAF || EP_FIX == GLV || !defined(STRIP)
+		TEST_CASE("w-naf fixed point multiplication is correct") {
+			bn_rand_mod(k, n);
+			ep13_curve_get_gen(p);
+			ep13_mul_basic(p, p, k);
+			ep13_mul_pre_lwnaf(t, p);
+			bn_zero(k);
+			ep13_mul_fix_lwnaf(r, t, k);
+			TEST_ASSERT(ep13_is_infty(r), end);
+			bn_set_dig(k, 1);
+			ep13_mul_fix_lwnaf(r, t, k);
+			TEST_ASSERT(ep13_cmp(p, r) == RLC_EQ, end);
+			bn_sub_dig(k, n, 1);
+			ep13_mul_fix_lwnaf(r, t, k);
+			ep13_neg(q, p);
+			TEST_ASSERT(ep13_cmp(q, r) == RLC_EQ, end);
+			bn_rand(k, RLC_POS, RLC_DIG / 2);
+			ep13_mul_basic(q, p, k);
+			ep13_mul_fix_lwnaf(r, t, k);
+			TEST_ASSERT(ep13_cmp(q, r) == RLC_EQ, end);
+			bn_rand_mod(k, n);
+			ep13_mul_basic(q, p, k);
+			ep13_mul_fix_lwnaf(r, t, k);
+			TEST_ASSERT(ep13_cmp(q, r) == RLC_EQ, end);
+			bn_neg(k, k);
+			ep13_mul_fix_lwnaf(r, t, k);
+			ep13_neg(r, r);
+			TEST_ASSERT(ep13_cmp(q, r) == RLC_EQ, end);
+			bn_neg(k, k);
+			bn_add(k, k, n);
+			ep13_mul_fix_lwnaf(r, t, k);
+			TEST_ASSERT(ep13_cmp(q, r) == RLC_EQ, end);
+		} TEST_END;
+#endif
+	}
+	RLC_CATCH_ANY {
+		util_print("FATAL ERROR!\n");
+		RLC_ERROR(end);
+	}
+	code = RLC_OK;
+  end:
+	bn_free(k);
+	bn_free(n);
+	ep13_free(p);
+	ep13_free(q);
+	ep13_free(r);
+	for (int i = 0; i < RLC_EP13_TABLE_MAX; i++) {
+		ep13_free(t[i]);
+	}
+	return code;
+}
+
+static int hashing13(void) {
+	int code = RLC_ERR;
+	bn_t n;
+	ep13_t p, q;
+	uint8_t msg[5];
+
+	bn_null(n);
+	ep13_null(p);
+	ep13_null(q);
+
+	RLC_TRY {
+		bn_new(n);
+		ep13_new(p);
+		ep13_new(q);
+
+		ep_curve_get_ord(n);
+
+		TEST_CASE("point hashing is correct") {
+			rand_bytes(msg, sizeof(msg));
+			ep13_map(p, msg, sizeof(msg));
+			TEST_ASSERT(ep13_is_infty(p) == 0, end);
+			TEST_ASSERT(ep13_on_curve(p) == 1, end);
+			ep13_map_dst(q, msg, sizeof(msg), (const uint8_t *)"RELIC", 5);
+			TEST_ASSERT(ep13_cmp(p, q) == RLC_EQ, end);
+			ep13_map_dst(q, msg, sizeof(msg), (const uint8_t *)"CILER", 5);
+			TEST_ASSERT(ep13_cmp(p, q) != RLC_EQ, end);
+			ep13_mul_basic(p, p, n);
+			TEST_ASSERT(ep13_is_infty(p) == 1, end);
+		}
+		TEST_END;
+	}
+	RLC_CATCH_ANY {
+		util_print("FATAL ERROR!\n");
+		RLC_ERROR(end);
+	}
+	code = RLC_OK;
+  end:
+	bn_free(n);
+	ep13_free(p);
+	ep13_free(q);
+	return code;
+}
+
 int main(void) {
-	int r0, r1;
+	int r0, r1, r2;
 
 	if (core_init() != RLC_OK) {
 		core_clean();
@@ -2337,7 +2758,30 @@ int main(void) {
 		}
 	}
 
-	if (!r0 && !r1) {
+	if ((r2 = (ep_param_embed() == 13))) {
+		ep_param_print();
+
+		util_banner("Utilities:", 1);
+
+		if (util13() != RLC_OK) {
+			core_clean();
+			return 1;
+		}
+
+		util_banner("Arithmetic:", 1);
+
+		if (multiplication13() != RLC_OK) {
+			core_clean();
+			return 1;
+		}
+
+		if (hashing13() != RLC_OK) {
+			core_clean();
+			return 1;
+		}
+	}
+
+	if (!r0 && !r1 && !r2) {
 		RLC_THROW(ERR_NO_CURVE);
 		core_clean();
 		return 0;
@@ -478,6 +478,28 @@ static int multiplication(void) {
 		}
 		TEST_END;
 #endif
+
+#ifdef OPCNT
+		TEST_CASE("multiplication and squaring are counted") {
+			ull_t u[OP_MAX], v[OP_MAX];
+			fp_rand(a);
+			fp_rand(b);
+			bench_count_get(u);
+			fp_mul(c, a, b);
+			fp_sqr(d, a);
+			bench_count_get(v);
+#if FP_SQR == MULTP
+			TEST_ASSERT(v[OP_FP_MUL] - u[OP_FP_MUL] == 2, end);
+#else
+			TEST_ASSERT(v[OP_FP_MUL] - u[OP_FP_MUL] == 1, end);
+			TEST_ASSERT(v[OP_FP_SQR] - u[OP_FP_SQR] == 1, end);
+#endif
+			bench_count_reset();
+			bench_count_get(v);
+			TEST_ASSERT(v[OP_FP_MUL] == 0 && v[OP_FP_SQR] == 0, end);
+		}
+		TEST_END;
+#endif
 	}
 	RLC_CATCH_ANY {
 		RLC_ERROR(end);
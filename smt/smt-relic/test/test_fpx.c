@@ -31,6 +31,7 @@
 
 #include "relic.h"
 #include "relic_test.h"
+#include "relic_fpx_low.h"
 
 static int memory2(void) {
 	err_t e;
@@ -4228,6 +4229,7 @@ static int squaring12(void) {
 static int cyclotomic12(void) {
 	int code = RLC_ERR;
 	fp12_t a, b, c, d[2], e[2];
+	fp2_t *t = RLC_ALLOCA(fp2_t, RLC_FP12_TABLE);
 	bn_t f;
 
 	fp12_null(a);
@@ -4247,6 +4249,13 @@ static int cyclotomic12(void) {
 		fp12_new(e[0]);
 		fp12_new(e[1]);
 		bn_new(f);
+		if (t == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (int j = 0; j < RLC_FP12_TABLE; j++) {
+			fp2_null(t[j]);
+			fp2_new(t[j]);
+		}
 
 		TEST_CASE("cyclotomic test is correct") {
 			fp12_rand(a);
@@ -4398,6 +4407,41 @@ static int cyclotomic12(void) {
 			fp12_sqr_cyc(c, a);
 			TEST_ASSERT(fp12_cmp(b, c) == RLC_EQ, end);
 		} TEST_END;
+
+		TEST_CASE("fixed cyclotomic exponentiation is correct") {
+			fp12_rand(a);
+			fp12_conv_cyc(a, a);
+			fp12_exp_cyc_pre(t, a);
+			bn_zero(f);
+			fp12_exp_cyc_fix(c, t, f);
+			TEST_ASSERT(fp12_cmp_dig(c, 1) == RLC_EQ, end);
+			bn_set_dig(f, 1);
+			fp12_exp_cyc_fix(c, t, f);
+			TEST_ASSERT(fp12_cmp(c, a) == RLC_EQ, end);
+			bn_rand(f, RLC_POS, RLC_DIG);
+			fp12_exp_cyc_fix(b, t, f);
+			fp12_exp_dig(c, a, f->dp[0]);
+			TEST_ASSERT(fp12_cmp(b, c) == RLC_EQ, end);
+			bn_rand(f, RLC_POS, RLC_FP_BITS - 1);
+			fp12_exp_cyc_fix(b, t, f);
+			fp12_sqr_cyc(b, b);
+			bn_dbl(f, f);
+			fp12_exp_cyc_fix(c, t, f);
+			TEST_ASSERT(fp12_cmp(b, c) == RLC_EQ, end);
+			bn_neg(f, f);
+			fp12_exp_cyc_fix(c, t, f);
+			fp12_inv_cyc(c, c);
+			TEST_ASSERT(fp12_cmp(b, c) == RLC_EQ, end);
+			/* All windows set to the largest digit propagate carries. */
+			bn_set_2b(f, RLC_FP_BITS - 1);
+			fp12_exp_cyc_fix(b, t, f);
+			fp12_sqr_cyc(b, b);
+			bn_dbl(f, f);
+			bn_sub_dig(f, f, 1);
+			fp12_exp_cyc_fix(c, t, f);
+			fp12_mul(c, c, a);
+			TEST_ASSERT(fp12_cmp(b, c) == RLC_EQ, end);
+		} TEST_END;
 	}
 	RLC_CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -4413,6 +4457,12 @@ static int cyclotomic12(void) {
 	fp12_free(e[0]);
 	fp12_free(e[1]);
 	bn_free(f);
+	if (t != NULL) {
+		for (int j = 0; j < RLC_FP12_TABLE; j++) {
+			fp2_free(t[j]);
+		}
+	}
+	RLC_FREE(t);
 	return code;
 }
 
@@ -4579,6 +4629,552 @@ static int compression12(void) {
 	return code;
 }
 
+static int memory13(void) {
+	err_t e;
+	int code = RLC_ERR;
+	fp13_t a;
+
+	fp13_null(a);
+
+	RLC_TRY {
+		TEST_CASE("memory can be allocated") {
+			fp13_new(a);
+			fp13_free(a);
+		} TEST_END;
+	} RLC_CATCH(e) {
+		switch (e) {
+			case ERR_NO_MEMORY:
+				util_print("FATAL ERROR!\n");
+				RLC_ERROR(end);
+				break;
+		}
+	}
+	(void)a;
+	code = RLC_OK;
+  end:
+	return code;
+}
+
+static int util13(void) {
+	int code = RLC_ERR;
+	uint8_t bin[13 * RLC_FP_BYTES];
+	fp13_t a, b, c;
+	dig_t d;
+
+	fp13_null(a);
+	fp13_null(b);
+	fp13_null(c);
+
+	RLC_TRY {
+		fp13_new(a);
+		fp13_new(b);
+		fp13_new(c);
+
+		TEST_CASE("comparison is consistent") {
+			fp13_rand(a);
+			fp13_rand(b);
+			if (fp13_cmp(a, b) != RLC_EQ) {
+				TEST_ASSERT(fp13_cmp(b, a) == RLC_NE, end);
+			}
+		}
+		TEST_END;
+
+		TEST_CASE("copy and comparison are consistent") {
+			fp13_rand(a);
+			fp13_rand(b);
+			fp13_rand(c);
+			if (fp13_cmp(a, c) != RLC_EQ) {
+				fp13_copy(c, a);
+				TEST_ASSERT(fp13_cmp(c, a) == RLC_EQ, end);
+			}
+			if (fp13_cmp(b, c) != RLC_EQ) {
+				fp13_copy(c, b);
+				TEST_ASSERT(fp13_cmp(b, c) == RLC_EQ, end);
+			}
+		}
+		TEST_END;
+
+		TEST_CASE("negation is consistent") {
+			fp13_rand(a);
+			fp13_neg(b, a);
+			if (fp13_cmp(a, b) != RLC_EQ) {
+				TEST_ASSERT(fp13_cmp(b, a) == RLC_NE, end);
+			}
+			fp13_neg(b, b);
+			TEST_ASSERT(fp13_cmp(a, b) == RLC_EQ, end);
+		}
+		TEST_END;
+
+		TEST_CASE("assignment to zero and comparison are consistent") {
+			do {
+				fp13_rand(a);
+			} while (fp13_is_zero(a));
+			fp13_zero(c);
+			TEST_ASSERT(fp13_cmp(a, c) == RLC_NE, end);
+			TEST_ASSERT(fp13_cmp(c, a) == RLC_NE, end);
+		}
+		TEST_END;
+
+		TEST_CASE("assignment to zero and zero test are consistent") {
+			fp13_zero(a);
+			TEST_ASSERT(fp13_is_zero(a), end);
+		}
+		TEST_END;
+
+		TEST_CASE("assignment to a constant and comparison are consistent") {
+			rand_bytes((uint8_t *)&d, (RLC_DIG / 8));
+			fp13_set_dig(a, d);
+			TEST_ASSERT(fp13_cmp_dig(a, d) == RLC_EQ, end);
+			for (int j = 1; j < 13; j++) {
+				fp13_set_dig(a, d);
+				fp_set_dig(a[j], 1);
+				TEST_ASSERT(fp13_cmp_dig(a, d) == RLC_NE, end);
+			}
+		}
+		TEST_END;
+
+		TEST_CASE("reading and writing a finite field element are consistent") {
+			fp13_rand(a);
+			fp13_write_bin(bin, sizeof(bin), a, 0);
+			fp13_read_bin(b, bin, sizeof(bin));
+			TEST_ASSERT(fp13_cmp(a, b) == RLC_EQ, end);
+		}
+		TEST_END;
+
+		TEST_CASE("getting the size of a finite field element is correct") {
+			fp13_rand(a);
+			TEST_ASSERT(fp13_size_bin(a, 0) == 13 * RLC_FP_BYTES, end);
+		}
+		TEST_END;
+	}
+	RLC_CATCH_ANY {
+		RLC_ERROR(end);
+	}
+	code = RLC_OK;
+  end:
+	fp13_free(a);
+	fp13_free(b);
+	fp13_free(c);
+	return code;
+}
+
+/**
+ * Multiplies two 13-th extension field elements with the schoolbook method,
+ * folding the upper half with w^13 = -2, as a reference for the Karatsuba
+ * multiplication.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the first extension field element.
+ * @param[in] b				- the second extension field element.
+ */
+static void fp13_mul_ref(fp13_t c, fp13_t a, fp13_t b) {
+	fp13_t r;
+	fp_t t;
+
+	fp13_null(r);
+	fp_null(t);
+
+	RLC_TRY {
+		fp13_new(r);
+		fp_new(t);
+
+		fp13_zero(r);
+		for (int j = 0; j < 13; j++) {
+			for (int l = 0; l < 13; l++) {
+				fp_mul(t, a[j], b[l]);
+				if (j + l < 13) {
+					fp_add(r[j + l], r[j + l], t);
+				} else {
+					fp_dbl(t, t);
+					fp_sub(r[j + l - 13], r[j + l - 13], t);
+				}
+			}
+		}
+		fp13_copy(c, r);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp13_free(r);
+		fp_free(t);
+	}
+}
+
+static int multiplication13(void) {
+	int code = RLC_ERR;
+	fp13_t a, b, c, d, e;
+
+	fp13_null(a);
+	fp13_null(b);
+	fp13_null(c);
+	fp13_null(d);
+	fp13_null(e);
+
+	RLC_TRY {
+		fp13_new(a);
+		fp13_new(b);
+		fp13_new(c);
+		fp13_new(d);
+		fp13_new(e);
+
+		TEST_CASE("multiplication is commutative") {
+			fp13_rand(a);
+			fp13_rand(b);
+			fp13_mul(d, a, b);
+			fp13_mul(e, b, a);
+			TEST_ASSERT(fp13_cmp(d, e) == RLC_EQ, end);
+		} TEST_END;
+
+		TEST_CASE("multiplication is associative") {
+			fp13_rand(a);
+			fp13_rand(b);
+			fp13_rand(c);
+			fp13_mul(d, a, b);
+			fp13_mul(d, d, c);
+			fp13_mul(e, b, c);
+			fp13_mul(e, a, e);
+			TEST_ASSERT(fp13_cmp(d, e) == RLC_EQ, end);
+		} TEST_END;
+
+		TEST_CASE("multiplication is distributive") {
+			fp13_rand(a);
+			fp13_rand(b);
+			fp13_rand(c);
+			fp13_add(d, a, b);
+			fp13_mul(d, c, d);
+			fp13_mul(e, c, a);
+			fp13_mul(a, c, b);
+			fp13_add(e, e, a);
+			TEST_ASSERT(fp13_cmp(d, e) == RLC_EQ, end);
+		} TEST_END;
+
+		TEST_CASE("multiplication has identity") {
+			fp13_rand(a);
+			fp13_set_dig(d, 1);
+			fp13_mul(e, a, d);
+			TEST_ASSERT(fp13_cmp(e, a) == RLC_EQ, end);
+		} TEST_END;
+
+		TEST_CASE("multiplication has zero property") {
+			fp13_rand(a);
+			fp13_zero(d);
+			fp13_mul(e, a, d);
+			TEST_ASSERT(fp13_is_zero(e), end);
+		} TEST_END;
+
+		TEST_CASE("multiplication agrees with schoolbook multiplication") {
+			fp13_rand(a);
+			fp13_rand(b);
+			fp13_mul(d, a, b);
+			fp13_mul_ref(e, a, b);
+			TEST_ASSERT(fp13_cmp(d, e) == RLC_EQ, end);
+			/* Reach the largest reduced operands in every coefficient. */
+			fp13_zero(a);
+			fp_sub_dig(a[0], a[0], 1);
+			for (int j = 1; j < 13; j++) {
+				fp_copy(a[j], a[0]);
+			}
+			fp13_mul(d, a, a);
+			fp13_mul_ref(e, a, a);
+			TEST_ASSERT(fp13_cmp(d, e) == RLC_EQ, end);
+		} TEST_END;
+
+		TEST_CASE("multiplication with aliased operands is correct") {
+			fp13_rand(a);
+			fp13_rand(b);
+			fp13_mul(e, a, b);
+			fp13_copy(c, a);
+			fp13_mul(c, c, b);
+			TEST_ASSERT(fp13_cmp(c, e) == RLC_EQ, end);
+			fp13_copy(c, b);
+			fp13_mul(c, a, c);
+			TEST_ASSERT(fp13_cmp(c, e) == RLC_EQ, end);
+		} TEST_END;
+
+		TEST_CASE("multiplication with lazy reduction is consistent") {
+			dv13_t t;
+			dv13_null(t);
+			dv13_new(t);
+			fp13_rand(a);
+			fp13_rand(b);
+			fp13_muln_low(t, a, b);
+			fp13_rdc(d, t);
+			fp13_mul_ref(e, a, b);
+			dv13_free(t);
+			TEST_ASSERT(fp13_cmp(d, e) == RLC_EQ, end);
+		} TEST_END;
+	}
+	RLC_CATCH_ANY {
+		util_print("FATAL ERROR!\n");
+		RLC_ERROR(end);
+	}
+	code = RLC_OK;
+  end:
+	fp13_free(a);
+	fp13_free(b);
+	fp13_free(c);
+	fp13_free(d);
+	fp13_free(e);
+	return code;
+}
+
+static int squaring13(void) {
+	int code = RLC_ERR;
+	fp13_t a, b, c;
+
+	fp13_null(a);
+	fp13_null(b);
+	fp13_null(c);
+
+	RLC_TRY {
+		fp13_new(a);
+		fp13_new(b);
+		fp13_new(c);
+
+		TEST_CASE("squaring is correct") {
+			fp13_rand(a);
+			fp13_mul(b, a, a);
+			fp13_sqr(c, a);
+			TEST_ASSERT(fp13_cmp(b, c) == RLC_EQ, end);
+		} TEST_END;
+
+		TEST_CASE("squaring agrees with schoolbook multiplication") {
+			fp13_rand(a);
+			fp13_mul_ref(b, a, a);
+			fp13_sqr(c, a);
+			TEST_ASSERT(fp13_cmp(b, c) == RLC_EQ, end);
+		} TEST_END;
+
+		TEST_CASE("squaring with aliased operands is correct") {
+			fp13_rand(a);
+			fp13_sqr(b, a);
+			fp13_sqr(a, a);
+			TEST_ASSERT(fp13_cmp(a, b) == RLC_EQ, end);
+		} TEST_END;
+
+		TEST_CASE("squaring with lazy reduction is consistent") {
+			dv13_t t;
+			dv13_null(t);
+			dv13_new(t);
+			fp13_rand(a);
+			fp13_sqrn_low(t, a);
+			fp13_rdc(b, t);
+			fp13_mul_ref(c, a, a);
+			dv13_free(t);
+			TEST_ASSERT(fp13_cmp(b, c) == RLC_EQ, end);
+		} TEST_END;
+	}
+	RLC_CATCH_ANY {
+		util_print("FATAL ERROR!\n");
+		RLC_ERROR(end);
+	}
+	code = RLC_OK;
+  end:
+	fp13_free(a);
+	fp13_free(b);
+	fp13_free(c);
+	return code;
+}
+
+static int inversion13(void) {
+	int code = RLC_ERR;
+	fp13_t a, b, c, d[2], e[2];
+
+	fp13_null(a);
+	fp13_null(b);
+	fp13_null(c);
+	fp13_null(d[0]);
+	fp13_null(d[1]);
+	fp13_null(e[0]);
+	fp13_null(e[1]);
+
+	RLC_TRY {
+		fp13_new(a);
+		fp13_new(b);
+		fp13_new(c);
+		fp13_new(d[0]);
+		fp13_new(d[1]);
+		fp13_new(e[0]);
+		fp13_new(e[1]);
+
+		TEST_CASE("inversion is correct") {
+			do {
+				fp13_rand(a);
+			} while (fp13_is_zero(a));
+			fp13_inv(b, a);
+			fp13_mul(c, a, b);
+			TEST_ASSERT(fp13_cmp_dig(c, 1) == RLC_EQ, end);
+		} TEST_END;
+
+		TEST_CASE("inversion with aliased operands is correct") {
+			do {
+				fp13_rand(a);
+			} while (fp13_is_zero(a));
+			fp13_inv(b, a);
+			fp13_inv(a, a);
+			TEST_ASSERT(fp13_cmp(a, b) == RLC_EQ, end);
+		} TEST_END;
+
+		TEST_CASE("simultaneous inversion is correct") {
+			do {
+				fp13_rand(d[0]);
+				fp13_rand(d[1]);
+			} while (fp13_is_zero(d[0]) || fp13_is_zero(d[1]));
+			fp13_inv(e[0], d[0]);
+			fp13_inv(e[1], d[1]);
+			fp13_inv_sim(d, d, 2);
+			TEST_ASSERT(fp13_cmp(d[0], e[0]) == RLC_EQ &&
+					fp13_cmp(d[1], e[1]) == RLC_EQ, end);
+		} TEST_END;
+
+		TEST_CASE("inversion of a unitary element is correct") {
+			do {
+				fp13_rand(a);
+			} while (fp13_is_zero(a));
+			fp13_frb(b, a, 1);
+			fp13_inv(b, b);
+			fp13_mul(a, a, b);
+			TEST_ASSERT(fp13_test_cyc(a), end);
+			fp13_inv(b, a);
+			fp13_inv_uni(c, a);
+			TEST_ASSERT(fp13_cmp(b, c) == RLC_EQ, end);
+		} TEST_END;
+	}
+	RLC_CATCH_ANY {
+		util_print("FATAL ERROR!\n");
+		RLC_ERROR(end);
+	}
+	code = RLC_OK;
+  end:
+	fp13_free(a);
+	fp13_free(b);
+	fp13_free(c);
+	fp13_free(d[0]);
+	fp13_free(d[1]);
+	fp13_free(e[0]);
+	fp13_free(e[1]);
+	return code;
+}
+
+static int square_root13(void) {
+	int code = RLC_ERR;
+	fp13_t a, b, c;
+	int r;
+
+	fp13_null(a);
+	fp13_null(b);
+	fp13_null(c);
+
+	RLC_TRY {
+		fp13_new(a);
+		fp13_new(b);
+		fp13_new(c);
+
+		TEST_CASE("square root extraction is correct") {
+			fp13_rand(a);
+			fp13_sqr(c, a);
+			r = fp13_srt(b, c);
+			fp13_sqr(b, b);
+			TEST_ASSERT(r == 1, end);
+			TEST_ASSERT(fp13_cmp(b, c) == RLC_EQ, end);
+		} TEST_END;
+
+		TEST_CASE("square root extraction with aliased operands is correct") {
+			fp13_rand(a);
+			fp13_sqr(a, a);
+			fp13_copy(c, a);
+			r = fp13_srt(a, a);
+			fp13_sqr(b, a);
+			TEST_ASSERT(r == 1, end);
+			TEST_ASSERT(fp13_cmp(b, c) == RLC_EQ, end);
+		} TEST_END;
+
+		TEST_CASE("square root of a non-square is rejected") {
+			do {
+				fp13_rand(a);
+			} while (fp13_is_square(a) == 1);
+			TEST_ASSERT(fp13_srt(b, a) == 0, end);
+		} TEST_END;
+	}
+	RLC_CATCH_ANY {
+		util_print("FATAL ERROR!\n");
+		RLC_ERROR(end);
+	}
+	code = RLC_OK;
+  end:
+	fp13_free(a);
+	fp13_free(b);
+	fp13_free(c);
+	return code;
+}
+
+static int compression13(void) {
+	int code = RLC_ERR;
+	uint8_t bin[13 * RLC_FP_BYTES];
+	fp13_t a, b, c;
+
+	fp13_null(a);
+	fp13_null(b);
+	fp13_null(c);
+
+	RLC_TRY {
+		fp13_new(a);
+		fp13_new(b);
+		fp13_new(c);
+
+		TEST_CASE("compression is consistent") {
+			do {
+				fp13_rand(b);
+			} while (fp13_is_zero(b));
+			fp13_frb(a, b, 1);
+			fp13_inv(a, a);
+			fp13_mul(a, a, b);
+			TEST_ASSERT(fp13_pck(b, a) == 1, end);
+			TEST_ASSERT(fp13_upk(c, b) == 1, end);
+			TEST_ASSERT(fp13_cmp(a, c) == RLC_EQ, end);
+			do {
+				fp13_rand(a);
+			} while (fp13_test_cyc(a));
+			TEST_ASSERT(fp13_pck(b, a) == 0, end);
+			TEST_ASSERT(fp13_cmp(a, b) == RLC_EQ, end);
+		} TEST_END;
+
+		TEST_CASE("compression is consistent with reading and writing") {
+			do {
+				fp13_rand(b);
+			} while (fp13_is_zero(b));
+			fp13_frb(a, b, 1);
+			fp13_inv(a, a);
+			fp13_mul(a, a, b);
+			fp13_write_bin(bin, 1 + 12 * RLC_FP_BYTES, a, 1);
+			fp13_read_bin(b, bin, 1 + 12 * RLC_FP_BYTES);
+			TEST_ASSERT(fp13_cmp(a, b) == RLC_EQ, end);
+		}
+		TEST_END;
+
+		TEST_CASE("getting the size of a compressed field element is correct") {
+			fp13_rand(a);
+			TEST_ASSERT(fp13_size_bin(a, 0) == 13 * RLC_FP_BYTES, end);
+			fp13_frb(b, a, 1);
+			fp13_inv(b, b);
+			fp13_mul(a, a, b);
+			TEST_ASSERT(fp13_size_bin(a, 1) == 1 + 12 * RLC_FP_BYTES, end);
+		}
+		TEST_END;
+	}
+	RLC_CATCH_ANY {
+		util_print("FATAL ERROR!\n");
+		RLC_ERROR(end);
+	}
+	code = RLC_OK;
+  end:
+	fp13_free(a);
+	fp13_free(b);
+	fp13_free(c);
+	return code;
+}
+
 static int memory18(void) {
 	err_t e;
 	int code = RLC_ERR;
@@ -7729,6 +8325,48 @@ int main(void) {
 
 	}
 
+	if (ep_param_embed() == 13) {
+		util_banner("Extension of degree 13:", 0);
+		util_banner("Utilities:", 1);
+
+		if (memory13() != RLC_OK) {
+			core_clean();
+			return 1;
+		}
+
+		if (util13() != RLC_OK) {
+			core_clean();
+			return 1;
+		}
+
+		util_banner("Arithmetic:", 1);
+
+		if (multiplication13() != RLC_OK) {
+			core_clean();
+			return 1;
+		}
+
+		if (squaring13() != RLC_OK) {
+			core_clean();
+			return 1;
+		}
+
+		if (inversion13() != RLC_OK) {
+			core_clean();
+			return 1;
+		}
+
+		if (square_root13() != RLC_OK) {
+			core_clean();
+			return 1;
+		}
+
+		if (compression13() != RLC_OK) {
+			core_clean();
+			return 1;
+		}
+	}
+
 	if (fp_prime_get_cnr() && (ep_param_embed() >= 18)) {
 		util_banner("Octdecic extension:", 0);
 		util_banner("Utilities:", 1);
@@ -1150,13 +1150,19 @@ static int simultaneous2(void) {
 }
 
 static int validity2(void) {
-	int code = RLC_ERR;
-	g2_t a;
+	int code = RLC_ERR, r[4];
+	g2_t a, b[4];
 
 	g2_null(a);
+	for (int j = 0; j < 4; j++) {
+		g2_null(b[j]);
+	}
 
 	RLC_TRY {
 		g2_new(a);
+		for (int j = 0; j < 4; j++) {
+			g2_new(b[j]);
+		}
 
 		TEST_CASE("validity test is correct") {
 			g2_set_infty(a);
@@ -1171,6 +1177,23 @@ static int validity2(void) {
 			g2_blind(a, a);
 			TEST_ASSERT(g2_is_valid(a), end);
 		} TEST_END;
+
+		if (ep_curve_is_pairf() == EP_BN) {
+			TEST_CASE("batch validity test is correct") {
+				for (int j = 0; j < 4; j++) {
+					g2_rand(b[j]);
+				}
+				TEST_ASSERT(g2_is_valid_bn_batch(r, b, 4), end);
+				for (int j = 0; j < 4; j++) {
+					TEST_ASSERT(r[j] == g2_is_valid_bn(b[j]), end);
+				}
+				g2_set_infty(b[1]);
+				fp2_add_dig(b[2]->y, b[2]->y, 1);
+				TEST_ASSERT(!g2_is_valid_bn_batch(r, b, 4), end);
+				TEST_ASSERT(r[0] && !r[1] && !r[2] && r[3], end);
+			}
+			TEST_END;
+		}
 	}
 	RLC_CATCH_ANY {
 		RLC_ERROR(end);
@@ -1178,6 +1201,9 @@ static int validity2(void) {
 	code = RLC_OK;
   end:
 	g2_free(a);
+	for (int j = 0; j < 4; j++) {
+		g2_free(b[j]);
+	}
 	return code;
 }
 
@@ -1436,23 +1462,34 @@ static int inversion(void) {
 
 int exponentiation(void) {
 	int code = RLC_ERR;
-	gt_t a, b, c;
-	bn_t n, d, e;
+	gt_t a, b, c, u[64];
+	gt_pre_t t;
+	bn_t n, d, e, k[64];
 
 	gt_null(a);
 	gt_null(b);
 	gt_null(c);
+	gt_pre_null(t);
 	bn_null(d);
 	bn_null(e);
 	bn_null(n);
+	for (int j = 0; j < 64; j++) {
+		gt_null(u[j]);
+		bn_null(k[j]);
+	}
 
 	RLC_TRY {
 		gt_new(a);
 		gt_new(b);
 		gt_new(c);
+		gt_pre_new(t);
 		bn_new(d);
 		bn_new(e);
 		bn_new(n);
+		for (int j = 0; j < 64; j++) {
+			gt_new(u[j]);
+			bn_new(k[j]);
+		}
 
 		gt_get_gen(a);
 		pc_get_ord(n);
@@ -1480,6 +1517,10 @@ int exponentiation(void) {
 			gt_exp_gen(c, d);
 			gt_inv(c, c);
 			TEST_ASSERT(gt_cmp(b, c) == RLC_EQ, end);
+			bn_rand_mod(d, n);
+			gt_exp_gen(b, d);
+			gt_exp(c, a, d);
+			TEST_ASSERT(gt_cmp(b, c) == RLC_EQ, end);
 		} TEST_END;
 
 		TEST_CASE("random element has the right order") {
@@ -1507,6 +1548,81 @@ int exponentiation(void) {
 			gt_exp_dig(c, a, d->dp[0]);
 			TEST_ASSERT(gt_cmp(b, c) == RLC_EQ, end);
 		} TEST_END;
+
+		TEST_CASE("fixed exponentiation is correct") {
+			gt_rand(a);
+			gt_exp_pre(t, a);
+			bn_zero(d);
+			gt_exp_fix(c, t, d);
+			TEST_ASSERT(gt_is_unity(c), end);
+			bn_set_dig(d, 1);
+			gt_exp_fix(c, t, d);
+			TEST_ASSERT(gt_cmp(c, a) == RLC_EQ, end);
+			gt_exp_fix(c, t, n);
+			TEST_ASSERT(gt_is_unity(c), end);
+			bn_rand_mod(d, n);
+			gt_exp_fix(b, t, d);
+			gt_exp(c, a, d);
+			TEST_ASSERT(gt_cmp(b, c) == RLC_EQ, end);
+			bn_neg(d, d);
+			gt_exp_fix(b, t, d);
+			gt_exp(c, a, d);
+			TEST_ASSERT(gt_cmp(b, c) == RLC_EQ, end);
+			bn_rand(d, RLC_POS, RLC_DIG);
+			gt_exp_fix(b, t, d);
+			gt_exp_dig(c, a, d->dp[0]);
+			TEST_ASSERT(gt_cmp(b, c) == RLC_EQ, end);
+			gt_set_unity(a);
+			gt_exp_pre(t, a);
+			bn_rand_mod(d, n);
+			gt_exp_fix(c, t, d);
+			TEST_ASSERT(gt_is_unity(c), end);
+		} TEST_END;
+
+		TEST_CASE("multiple exponentiation is correct") {
+			gt_exp_sim_lot(c, u, k, 0);
+			TEST_ASSERT(gt_is_unity(c), end);
+			gt_set_unity(a);
+			for (int j = 0; j < 64; j++) {
+				gt_rand(u[j]);
+				bn_rand_mod(k[j], n);
+				gt_exp(b, u[j], k[j]);
+				gt_mul(a, a, b);
+				if (j < 4) {
+					gt_exp_sim_lot(c, u, k, j + 1);
+					TEST_ASSERT(gt_cmp(a, c) == RLC_EQ, end);
+				}
+			}
+			gt_exp_sim_lot(c, u, k, 64);
+			TEST_ASSERT(gt_cmp(a, c) == RLC_EQ, end);
+			/* Mix zero, short, sparse and negative exponents with unity. */
+			bn_zero(k[0]);
+			bn_rand(k[1], RLC_POS, RLC_DIG);
+			bn_neg(k[2], k[2]);
+			bn_add(k[3], k[3], n);
+			gt_set_unity(u[4]);
+			bn_set_2b(k[5], bn_bits(n) - 1);
+			for (int j = 6; j < 18; j++) {
+				bn_zero(k[j]);
+				for (int l = 0; l < 24; l++) {
+					bn_set_bit(k[j], 10 * l + j % 8, 1);
+				}
+			}
+			gt_set_unity(a);
+			for (int j = 0; j < 64; j++) {
+				gt_exp(b, u[j], k[j]);
+				gt_mul(a, a, b);
+			}
+			gt_exp_sim_lot(c, u, k, 64);
+			TEST_ASSERT(gt_cmp(a, c) == RLC_EQ, end);
+			gt_exp_sim_lot(c, u, k, 6);
+			gt_exp_sim(a, u[0], k[0], u[1], k[1]);
+			for (int j = 2; j < 6; j++) {
+				gt_exp(b, u[j], k[j]);
+				gt_mul(a, a, b);
+			}
+			TEST_ASSERT(gt_cmp(a, c) == RLC_EQ, end);
+		} TEST_END;
 	}
 	RLC_CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -1520,6 +1636,11 @@ int exponentiation(void) {
 	bn_free(d);
 	bn_free(e);
 	bn_free(n);
+	gt_pre_free(t);
+	for (int j = 0; j < 64; j++) {
+		gt_free(u[j]);
+		bn_free(k[j]);
+	}
 	return code;
 }
 
@@ -1553,6 +1674,7 @@ static int pairing(void) {
 	int j, code = RLC_ERR;
 	g1_t p[2];
 	g2_t q[2];
+	g2_key_t t[2];
 	gt_t e1, e2;
 	bn_t k, n;
 
@@ -1570,8 +1692,10 @@ static int pairing(void) {
 		for (j = 0; j < 2; j++) {
 			g1_null(p[j]);
 			g2_null(q[j]);
+			g2_key_null(t[j]);
 			g1_new(p[j]);
 			g2_new(q[j]);
+			g2_key_new(t[j]);
 		}
 
 		pc_get_ord(n);
@@ -1637,6 +1761,82 @@ static int pairing(void) {
 			pc_map_sim(e2, p, q, 2);
 			TEST_ASSERT(gt_cmp(e1, e2) == RLC_EQ, end);
 		} TEST_END;
+
+		TEST_CASE("pairing with prepared elements is correct") {
+			g1_rand(p[0]);
+			g2_rand(q[0]);
+			pc_map(e1, p[0], q[0]);
+			TEST_ASSERT(g2_key_set(t[0], q[0]) == 1, end);
+			pc_map_key(e2, p[0], t[0]);
+			TEST_ASSERT(gt_cmp(e1, e2) == RLC_EQ, end);
+			g1_rand(p[1]);
+			g2_rand(q[1]);
+			TEST_ASSERT(g2_key_set(t[1], q[1]) == 1, end);
+			pc_map_sim(e1, p, q, 2);
+			pc_map_sim_key(e2, p, t, 2);
+			TEST_ASSERT(gt_cmp(e1, e2) == RLC_EQ, end);
+			g2_get_gen(q[0]);
+			pc_map(e1, p[0], q[0]);
+			pc_map_key(e2, p[0], g2_key_get_gen());
+			TEST_ASSERT(gt_cmp(e1, e2) == RLC_EQ, end);
+			g2_set_infty(q[0]);
+			TEST_ASSERT(g2_key_set(t[0], q[0]) == 0, end);
+			pc_map_key(e2, p[0], t[0]);
+			TEST_ASSERT(gt_cmp_dig(e2, 1) == RLC_EQ, end);
+		} TEST_END;
+
+		if (ep_curve_is_pairf() == EP_BN) {
+			TEST_CASE("cached validity test is correct") {
+				uint8_t b0[2 * RLC_PC_BYTES + 1], b1[2 * RLC_PC_BYTES + 1];
+				g2_rand(q[0]);
+				g2_norm(q[0], q[0]);
+				TEST_ASSERT(g2_is_valid_cached(q[0]), end);
+				TEST_ASSERT(g2_is_valid_cached(q[0]), end);
+				/* An off-curve point with the same compressed encoding. */
+				g2_copy(q[1], q[0]);
+				fp_add_dig(q[1]->y[1], q[1]->y[1], 1);
+				g2_write_bin(b0, sizeof(b0), q[0], 1);
+				g2_write_bin(b1, sizeof(b1), q[1], 1);
+				TEST_ASSERT(memcmp(b0, b1, sizeof(b0)) == 0, end);
+				TEST_ASSERT(!g2_is_valid_cached(q[1]), end);
+				TEST_ASSERT(g2_key_set(t[0], q[1]) == 0, end);
+			} TEST_END;
+
+			TEST_CASE("combined validation is correct") {
+				g1_rand(p[0]);
+				g2_rand(q[0]);
+				pc_map(e1, p[0], q[0]);
+				TEST_ASSERT(pc_validate_bn(p[0], q[0], e1), end);
+				TEST_ASSERT(pc_validate_bn(p[0], q[0], e1) ==
+						(g1_is_valid(p[0]) && g2_is_valid_bn(q[0]) &&
+						gt_is_valid(e1)), end);
+				g1_set_infty(p[1]);
+				TEST_ASSERT(!pc_validate_bn(p[1], q[0], e1), end);
+				g2_copy(q[1], q[0]);
+				fp2_add_dig(q[1]->y, q[1]->y, 1);
+				TEST_ASSERT(!pc_validate_bn(p[0], q[1], e1), end);
+				/* A point on the twist but outside the subgroup. */
+				do {
+					fp2_rand(q[1]->x);
+					fp2_set_dig(q[1]->z, 1);
+					q[1]->coord = BASIC;
+					ep2_rhs(q[1]->y, q[1]);
+				} while (!fp2_srt(q[1]->y, q[1]->y));
+				TEST_ASSERT(g2_on_curve(q[1]), end);
+				TEST_ASSERT(!g2_is_valid_bn(q[1]), end);
+				TEST_ASSERT(!pc_validate_bn(p[0], q[1], e1), end);
+				gt_set_unity(e2);
+				TEST_ASSERT(!pc_validate_bn(p[0], q[0], e2), end);
+				gt_copy(e2, e1);
+				fp_add_dig(e2[0][0][0], e2[0][0][0], 1);
+				TEST_ASSERT(!pc_validate_bn(p[0], q[0], e2), end);
+				/* An element of the cyclotomic subgroup outside G_T. */
+				fp12_rand(e2);
+				fp12_conv_cyc(e2, e2);
+				TEST_ASSERT(!gt_is_valid(e2), end);
+				TEST_ASSERT(!pc_validate_bn(p[0], q[0], e2), end);
+			} TEST_END;
+		}
 	}
 	RLC_CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -1651,6 +1851,7 @@ static int pairing(void) {
 	for (j = 0; j < 2; j++) {
 		g1_free(p[j]);
 		g2_free(q[j]);
+		g2_key_free(t[j]);
 	}
 	return code;
 }
@@ -1071,6 +1071,8 @@ static int pairing12(void) {
 	ep_t p[2];
 	ep2_t q[2], r;
 	fp12_t e1, e2;
+	fp2_t _t[2][RLC_PP_TABLE_K12], *t[2] = { _t[0], _t[1] };
+	uint8_t bin[2 * RLC_PP_TABLE_K12 * RLC_FP_BYTES];
 
 	bn_null(k);
 	bn_null(n);
@@ -1091,6 +1093,12 @@ static int pairing12(void) {
 			ep_new(p[j]);
 			ep2_new(q[j]);
 		}
+		for (j = 0; j < RLC_PP_TABLE_K12; j++) {
+			fp2_null(_t[0][j]);
+			fp2_null(_t[1][j]);
+			fp2_new(_t[0][j]);
+			fp2_new(_t[1][j]);
+		}
 
 		ep_curve_get_ord(n);
 
@@ -1343,6 +1351,98 @@ static int pairing12(void) {
 			pp_map_sim_oatep_k12(e2, p, q, 2);
 			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
 		} TEST_END;
+
+		TEST_CASE("parallel optimal ate multi-pairing is correct") {
+			ep_rand(p[0]);
+			ep2_rand(q[0]);
+			ep_rand(p[1]);
+			ep2_rand(q[1]);
+			pp_map_sim_oatep_k12(e1, p, q, 2);
+			pp_mil_sim_oatep_k12(e2, p, q, 2);
+			pp_exp_k12(e2, e2);
+			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
+			pp_map_sim_par_k12(e2, p, q, 2, 2);
+			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
+			pp_map_sim_par_k12(e2, p, q, 2, 4);
+			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
+			ep2_set_infty(q[i % 2]);
+			pp_map_oatep_k12(e1, p[1 - (i % 2)], q[1 - (i % 2)]);
+			pp_map_sim_par_k12(e2, p, q, 2, 2);
+			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
+		} TEST_END;
+
+		TEST_CASE("optimal ate pairing with precomputation is correct") {
+			ep_rand(p[0]);
+			ep2_rand(q[0]);
+			pp_map_oatep_k12(e1, p[0], q[0]);
+			pp_pre_k12(t[0], q[0]);
+			pp_map_pre_k12(e2, p[0], t[0]);
+			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
+			ep_dbl(p[0], p[0]);
+			pp_map_pre_k12(e2, p[0], t[0]);
+			fp12_sqr(e1, e1);
+			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
+			ep_rand(p[1]);
+			ep2_rand(q[1]);
+			pp_pre_k12(t[1], q[1]);
+			pp_map_sim_oatep_k12(e1, p, q, 2);
+			pp_map_sim_pre_k12(e2, p, t, 2);
+			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
+			ep_set_infty(p[0]);
+			pp_map_pre_k12(e2, p[0], t[0]);
+			TEST_ASSERT(fp12_cmp_dig(e2, 1) == RLC_EQ, end);
+			ep_rand(p[0]);
+			ep2_set_infty(q[0]);
+			pp_pre_k12(t[0], q[0]);
+			pp_map_pre_k12(e2, p[0], t[0]);
+			TEST_ASSERT(fp12_cmp_dig(e2, 1) == RLC_EQ, end);
+			pp_map_oatep_k12(e1, p[1], q[1]);
+			pp_map_sim_pre_k12(e2, p, t, 2);
+			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
+		} TEST_END;
+
+		TEST_CASE("optimal ate pairing with mixed precomputation is correct") {
+			ep_rand(p[0]);
+			ep2_rand(q[0]);
+			ep_rand(p[1]);
+			ep2_rand(q[1]);
+			pp_pre_k12(t[1], q[1]);
+			pp_map_sim_oatep_k12(e1, p, q, 2);
+			pp_map_sim_mix_k12(e2, p, q, 1, p + 1, t + 1, 1);
+			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
+			pp_map_sim_mix_k12(e2, p, q, 2, NULL, NULL, 0);
+			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
+			pp_pre_k12(t[0], q[0]);
+			pp_map_sim_mix_k12(e2, NULL, NULL, 0, p, t, 2);
+			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
+			ep2_set_infty(q[0]);
+			pp_map_oatep_k12(e1, p[1], q[1]);
+			pp_map_sim_mix_k12(e2, p, q, 1, p + 1, t + 1, 1);
+			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
+			pp_pre_k12(t[0], q[0]);
+			pp_map_sim_mix_k12(e2, p + 1, q + 1, 1, p, t, 1);
+			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
+		} TEST_END;
+
+		TEST_CASE("precomputation serialization is correct") {
+			ep_rand(p[0]);
+			ep2_rand(q[0]);
+			pp_pre_k12(t[0], q[0]);
+			j = pp_size_pre_k12(t[0]);
+			TEST_ASSERT(j <= (int)sizeof(bin), end);
+			pp_write_pre_k12(bin, j, t[0]);
+			pp_read_pre_k12(t[1], bin, j);
+			pp_map_pre_k12(e1, p[0], t[0]);
+			pp_map_pre_k12(e2, p[0], t[1]);
+			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
+			ep2_set_infty(q[0]);
+			pp_pre_k12(t[0], q[0]);
+			TEST_ASSERT(pp_size_pre_k12(t[0]) == 1, end);
+			pp_write_pre_k12(bin, 1, t[0]);
+			pp_read_pre_k12(t[1], bin, 1);
+			pp_map_pre_k12(e2, p[0], t[1]);
+			TEST_ASSERT(fp12_cmp_dig(e2, 1) == RLC_EQ, end);
+		} TEST_END;
 #endif
 	}
 	RLC_CATCH_ANY {
@@ -1361,6 +1461,10 @@ static int pairing12(void) {
 		ep_free(p[j]);
 		ep2_free(q[j]);
 	}
+	for (j = 0; j < RLC_PP_TABLE_K12; j++) {
+		fp2_free(_t[0][j]);
+		fp2_free(_t[1][j]);
+	}
 	return code;
 }
 
@@ -2453,6 +2557,169 @@ static int pairing54(void) {
 	return code;
 }
 
+static int pairing13(void) {
+	int j, code = RLC_ERR;
+	bn_t k, n;
+	ep_t p[2];
+	ep13_t q[2], r;
+	fp13_t e1, e2, t[RLC_PP_TABLE_K13];
+	uint8_t bin[RLC_PP_TABLE_K13 * 13 * RLC_FP_BYTES];
+
+	bn_null(k);
+	bn_null(n);
+	fp13_null(e1);
+	fp13_null(e2);
+	ep13_null(r);
+
+	RLC_TRY {
+		bn_new(n);
+		bn_new(k);
+		fp13_new(e1);
+		fp13_new(e2);
+		ep13_new(r);
+		for (j = 0; j < RLC_PP_TABLE_K13; j++) {
+			fp13_null(t[j]);
+			fp13_new(t[j]);
+		}
+
+		for (j = 0; j < 2; j++) {
+			ep_null(p[j]);
+			ep13_null(q[j]);
+			ep_new(p[j]);
+			ep13_new(q[j]);
+		}
+
+		ep_curve_get_ord(n);
+
+		TEST_CASE("pairing non-degeneracy is correct") {
+			ep_rand(p[0]);
+			ep13_rand(q[0]);
+			pp_map_sup_oatep_k13(e1, p[0], q[0]);
+			TEST_ASSERT(fp13_cmp_dig(e1, 1) != RLC_EQ, end);
+			ep_set_infty(p[0]);
+			pp_map_sup_oatep_k13(e1, p[0], q[0]);
+			TEST_ASSERT(fp13_cmp_dig(e1, 1) == RLC_EQ, end);
+			ep_rand(p[0]);
+			ep13_set_infty(q[0]);
+			pp_map_sup_oatep_k13(e1, p[0], q[0]);
+			TEST_ASSERT(fp13_cmp_dig(e1, 1) == RLC_EQ, end);
+		} TEST_END;
+
+		TEST_CASE("pairing is bilinear") {
+			ep_rand(p[0]);
+			ep13_rand(q[0]);
+			bn_rand_mod(k, n);
+			ep13_mul(r, q[0], k);
+			pp_map_sup_oatep_k13(e1, p[0], r);
+			pp_map_sup_oatep_k13(e2, p[0], q[0]);
+			fp13_exp(e2, e2, k);
+			TEST_ASSERT(fp13_cmp(e1, e2) == RLC_EQ, end);
+			ep_mul(p[0], p[0], k);
+			pp_map_sup_oatep_k13(e2, p[0], q[0]);
+			TEST_ASSERT(fp13_cmp(e1, e2) == RLC_EQ, end);
+			ep_dbl(p[0], p[0]);
+			pp_map_sup_oatep_k13(e2, p[0], q[0]);
+			fp13_sqr(e1, e1);
+			TEST_ASSERT(fp13_cmp(e1, e2) == RLC_EQ, end);
+			ep13_dbl(q[0], q[0]);
+			pp_map_sup_oatep_k13(e2, p[0], q[0]);
+			fp13_sqr(e1, e1);
+			TEST_ASSERT(fp13_cmp(e1, e2) == RLC_EQ, end);
+		} TEST_END;
+
+		TEST_CASE("multi-pairing is correct") {
+			ep_rand(p[i % 2]);
+			ep13_rand(q[i % 2]);
+			pp_map_sup_oatep_k13(e1, p[i % 2], q[i % 2]);
+			ep_rand(p[1 - (i % 2)]);
+			ep13_set_infty(q[1 - (i % 2)]);
+			pp_map_sim_k13(e2, p, q, 2);
+			TEST_ASSERT(fp13_cmp(e1, e2) == RLC_EQ, end);
+			ep_set_infty(p[1 - (i % 2)]);
+			ep13_rand(q[1 - (i % 2)]);
+			pp_map_sim_k13(e2, p, q, 2);
+			TEST_ASSERT(fp13_cmp(e1, e2) == RLC_EQ, end);
+			ep13_set_infty(q[i % 2]);
+			pp_map_sim_k13(e2, p, q, 2);
+			TEST_ASSERT(fp13_cmp_dig(e2, 1) == RLC_EQ, end);
+			ep_rand(p[0]);
+			ep13_rand(q[0]);
+			pp_map_sup_oatep_k13(e1, p[0], q[0]);
+			ep_rand(p[1]);
+			ep13_rand(q[1]);
+			pp_map_sup_oatep_k13(e2, p[1], q[1]);
+			fp13_mul(e1, e1, e2);
+			pp_map_sim_k13(e2, p, q, 2);
+			TEST_ASSERT(fp13_cmp(e1, e2) == RLC_EQ, end);
+		} TEST_END;
+
+		TEST_CASE("pairing with precomputation is correct") {
+			ep_rand(p[0]);
+			ep13_rand(q[0]);
+			pp_map_sup_oatep_k13(e1, p[0], q[0]);
+			pp_pre_k13(t, q[0]);
+			pp_map_pre_k13(e2, p[0], t);
+			TEST_ASSERT(fp13_cmp(e1, e2) == RLC_EQ, end);
+			ep_dbl(p[0], p[0]);
+			pp_map_pre_k13(e2, p[0], t);
+			fp13_sqr(e1, e1);
+			TEST_ASSERT(fp13_cmp(e1, e2) == RLC_EQ, end);
+			pp_pre_write_k13(bin, sizeof(bin), t);
+			ep13_rand(q[0]);
+			pp_pre_k13(t, q[0]);
+			pp_pre_read_k13(t, bin, sizeof(bin));
+			pp_map_pre_k13(e2, p[0], t);
+			TEST_ASSERT(fp13_cmp(e1, e2) == RLC_EQ, end);
+			ep_set_infty(p[0]);
+			pp_map_pre_k13(e2, p[0], t);
+			TEST_ASSERT(fp13_cmp_dig(e2, 1) == RLC_EQ, end);
+			ep_rand(p[0]);
+			ep13_set_infty(q[0]);
+			pp_pre_k13(t, q[0]);
+			pp_map_pre_k13(e2, p[0], t);
+			TEST_ASSERT(fp13_cmp_dig(e2, 1) == RLC_EQ, end);
+		} TEST_END;
+
+		TEST_CASE("reading and writing of pairing results is correct") {
+			ep_rand(p[0]);
+			ep13_rand(q[0]);
+			pp_map_sup_oatep_k13(e1, p[0], q[0]);
+			for (j = 0; j < 2; j++) {
+				fp13_write_bin(bin, fp13_size_bin(e1, j), e1, j);
+				fp13_read_bin(e2, bin, fp13_size_bin(e1, j));
+				TEST_ASSERT(fp13_cmp(e1, e2) == RLC_EQ, end);
+			}
+			TEST_ASSERT(fp13_size_bin(e1, 1) < fp13_size_bin(e1, 0), end);
+			fp13_set_dig(e1, 1);
+			fp13_write_bin(bin, fp13_size_bin(e1, 1), e1, 1);
+			fp13_read_bin(e2, bin, fp13_size_bin(e1, 1));
+			TEST_ASSERT(fp13_cmp_dig(e2, 1) == RLC_EQ, end);
+			fp13_rand(e1);
+			TEST_ASSERT(fp13_size_bin(e1, 1) == fp13_size_bin(e1, 0), end);
+		} TEST_END;
+	}
+	RLC_CATCH_ANY {
+		util_print("FATAL ERROR!\n");
+		RLC_ERROR(end);
+	}
+	code = RLC_OK;
+  end:
+	bn_free(n);
+	bn_free(k);
+	fp13_free(e1);
+	fp13_free(e2);
+	ep13_free(r);
+	for (j = 0; j < RLC_PP_TABLE_K13; j++) {
+		fp13_free(t[j]);
+	}
+
+	for (j = 0; j < 2; j++) {
+		ep_free(p[j]);
+		ep13_free(q[j]);
+	}
+	return code;
+}
+
 int main(void) {
 	if (core_init() != RLC_OK) {
 		core_clean();
@@ -2573,6 +2840,13 @@ int main(void) {
 		}
 	}
 
+	if (ep_param_embed() == 13) {
+		if (pairing13() != RLC_OK) {
+			core_clean();
+			return 1;
+		}
+	}
+
 	util_banner("All tests have passed.\n", 0);
 
 	core_clean();
@@ -0,0 +1,122 @@
+#!/bin/bash
+#
+# Compares two benchmark runs produced with BFORM=JSON or BFORM=CSV and flags
+# the benchmarks whose median got slower by more than a threshold. Lines that
+# are not benchmark records are ignored, so the output of the benchmark
+# binaries can be saved as is. Since some binaries run the same benchmarks once
+# per curve, records are keyed on the last top-level banner (such as
+# "-- Curve BN-P254:") and on their label, numbering repeated keys.
+#
+# Usage: relic_bench_compare.sh [-t <percent>] <old> <new>
+#
+# Example:
+#   bin/bench_pc > old.json
+#   (rebuild the library)
+#   bin/bench_pc > new.json
+#   tools/relic_bench_compare.sh -t 3 old.json new.json
+#
+# The exit status is 1 if any benchmark regressed and 0 otherwise.
+
+set -e
+
+THRESHOLD=5
+while getopts "t:" OPT; do
+	case "$OPT" in
+		t) THRESHOLD="$OPTARG" ;;
+		*) echo "Usage: $0 [-t <percent>] <old> <new>"; exit 2 ;;
+	esac
+done
+shift $((OPTIND - 1))
+
+if [ $# -ne 2 ]; then
+	echo "Usage: $0 [-t <percent>] <old> <new>"
+	exit 2
+fi
+
+# Extracts "key<TAB>median<TAB>unit" from JSON or CSV benchmark records.
+extract() {
+	awk '
+	function emit(label, median, unit,    key) {
+		key = (section == "" ? label : section " " label)
+		if (++count[key] > 1) {
+			key = key " #" count[key]
+		}
+		printf "%s\t%s\t%s\n", key, median, unit
+	}
+	/^-- / {
+		section = substr($0, 4)
+		sub(/:$/, "", section)
+		next
+	}
+	/^\{"type":"bench"/ {
+		match($0, /"label":"([^"\\]|\\.)*"/)
+		label = substr($0, RSTART + 9, RLENGTH - 10)
+		match($0, /"unit":"[^"]*"/)
+		unit = substr($0, RSTART + 8, RLENGTH - 9)
+		match($0, /"median":-?[0-9]+/)
+		median = substr($0, RSTART + 9, RLENGTH - 9)
+		emit(label, median, unit)
+		next
+	}
+	/^bench,"/ {
+		match($0, /"([^"]|"")*"/)
+		label = substr($0, RSTART + 1, RLENGTH - 2)
+		gsub(/""/, "\"", label)
+		n = split(substr($0, RSTART + RLENGTH + 1), f, ",")
+		# Fields after the label: unit, executions, samples, mean, min, p10,
+		# median, p90, max.
+		emit(label, f[7], f[1])
+	}
+	' "$1"
+}
+
+OLD=$(mktemp)
+NEW=$(mktemp)
+trap 'rm -f "$OLD" "$NEW"' EXIT
+extract "$1" > "$OLD"
+extract "$2" > "$NEW"
+
+awk -F '\t' -v threshold="$THRESHOLD" '
+	BEGIN {
+		printf "%-40s %12s %12s %9s\n", "Benchmark (median)", "old", "new", "change"
+	}
+	FILENAME == ARGV[1] {
+		old[$1] = $2
+		unit[$1] = $3
+		next
+	}
+	{
+		label = $1
+		seen[label] = 1
+		if (!(label in old)) {
+			printf "%-40s %12s %12s %9s  NEW\n", label, "-", $2, "-"
+			next
+		}
+		if (unit[label] != $3) {
+			printf "%-40s %12s %12s %9s  UNIT MISMATCH\n", label, old[label], $2, "-"
+			next
+		}
+		if (old[label] > 0) {
+			change = 100.0 * ($2 - old[label]) / old[label]
+		} else {
+			change = 0
+		}
+		flag = ""
+		if (change > threshold) {
+			flag = "  REGRESSION"
+			regressions++
+		} else if (change < -threshold) {
+			flag = "  IMPROVEMENT"
+		}
+		printf "%-40s %12s %12s %+8.2f%%%s\n", label, old[label], $2, change, flag
+	}
+	END {
+		for (label in old) {
+			if (!(label in seen)) {
+				printf "%-40s %12s %12s %9s  REMOVED\n", label, old[label], "-", "-"
+			}
+		}
+		printf "\n%d regression(s) above %s%%.\n", regressions, threshold
+		exit (regressions > 0)
+	}
+' "$OLD" "$NEW"
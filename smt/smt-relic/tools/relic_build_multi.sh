@@ -0,0 +1,45 @@
+#!/bin/bash
+#
+# Builds several labeled static libraries, one per parameter set, and merges
+# them into a single archive that can be linked into one process. Every build
+# keeps its own field kernels and its own core context, with entry points
+# namespaced as <label>_core_init(), <label>_pc_map(), ...
+#
+# Usage: relic_build_multi.sh <outdir> <label>:<preset> [<label>:<preset> ...]
+#
+# Example:
+#   tools/relic_build_multi.sh build-multi bn446:preset/x64-pbc-bn446.sh \
+#       bw13:preset/x64-ecc-bw310.sh
+#
+# Sources including relic.h must be compiled against exactly one of the builds,
+# for instance with -I<outdir>/bn446/include -I<relic>/include.
+
+set -e
+
+if [ $# -lt 2 ]; then
+	echo "Usage: $0 <outdir> <label>:<preset> [<label>:<preset> ...]"
+	exit 1
+fi
+
+SRC=$(cd "$(dirname "$0")/.." && pwd)
+OUT=$(mkdir -p "$1" && cd "$1" && pwd)
+shift
+
+MRI="CREATE $OUT/librelic_s_multi.a"
+for ARG in "$@"; do
+	LABEL=${ARG%%:*}
+	PRESET=${ARG#*:}
+	case "$PRESET" in
+		/*) ;;
+		*) PRESET="$SRC/$PRESET" ;;
+	esac
+	mkdir -p "$OUT/$LABEL"
+	(cd "$OUT/$LABEL" && \
+		bash "$PRESET" "-DLABEL=$LABEL -DTESTS=0 -DBENCH=0 $SRC" && \
+		make -j"$(nproc)" "relic_s_$LABEL")
+	MRI="$MRI
+ADDLIB $OUT/$LABEL/lib/librelic_s_$LABEL.a"
+done
+
+printf "%s\nSAVE\nEND\n" "$MRI" | ar -M
+echo "Merged archive: $OUT/librelic_s_multi.a"
@@ -50,16 +50,16 @@ cat << PREAMBLE
 PREAMBLE
 
 REDEF() {
-	cat "relic_$1.h" | grep "$1_" | grep -v define | grep -v typedef | grep -v '\\' | grep '(' | grep -v '^ \*' | sed 's/const //' | sed 's/\*//' | sed -r 's/[a-z,_0-9]+ ([a-z,_,0-9]+)\(.*/\#undef \1/'
+	cat "relic_$1.h" | grep "$1_" | grep -v define | grep -v typedef | grep -v '\\' | grep '(' | grep -v '^ \*' | grep -v '^//' | sed 's/const //' | sed 's/\*//' | sed -r 's/[a-z,_0-9]+ ([a-z,_,0-9]+)\(.*/\#undef \1/'
 	echo
-	cat "relic_$1.h" | grep "$1_" | grep -v define | grep -v typedef | grep -v '\\' | grep '(' | sed 's/\*//' | sed 's/const //' | sed -r 's/[a-z,_,0-9]+ ([a-z,_,0-9]+)\(.*/\#define \1 \tRLC_PREFIX\(\1\)/'
+	cat "relic_$1.h" | grep "$1_" | grep -v define | grep -v typedef | grep -v '\\' | grep '(' | grep -v '^//' | sed 's/\*//' | sed 's/const //' | sed -r 's/[a-z,_,0-9]+ ([a-z,_,0-9]+)\(.*/\#define \1 \tRLC_PREFIX\(\1\)/'
 	echo
 }
 
 REDEF2() {
-	cat "relic_$1.h" | grep "$2_" | grep -v define | grep -v typedef | grep -v '\\' | grep '(' | grep -v '^ \*' | sed 's/const //' | sed 's/\*//' | sed -r 's/[a-z,_0-9]+ ([a-z,_,0-9]+)\(.*/\#undef \1/'
+	cat "relic_$1.h" | grep "$2_" | grep -v define | grep -v typedef | grep -v '\\' | grep '(' | grep -v '^ \*' | grep -v '^//' | sed 's/const //' | sed 's/\*//' | sed -r 's/[a-z,_0-9]+ ([a-z,_,0-9]+)\(.*/\#undef \1/'
 	echo
-	cat "relic_$1.h" | grep "$2_" | grep -v define | grep -v typedef | grep -v '\\' | grep '(' | sed 's/\*//' | sed 's/const //' | sed -r 's/[a-z,_,0-9]+ ([a-z,_,0-9]+)\(.*/\#define \1 \tRLC_PREFIX\(\1\)/'
+	cat "relic_$1.h" | grep "$2_" | grep -v define | grep -v typedef | grep -v '\\' | grep '(' | grep -v '^//' | sed 's/\*//' | sed 's/const //' | sed -r 's/[a-z,_,0-9]+ ([a-z,_,0-9]+)\(.*/\#define \1 \tRLC_PREFIX\(\1\)/'
 	echo
 }
 
@@ -159,6 +159,13 @@ echo "#define ep4_t         RLC_PREFIX(ep4_t)"
 echo
 REDEF2 epx ep4
 
+echo "#undef ep13_st"
+echo "#undef ep13_t"
+echo "#define ep13_st       RLC_PREFIX(ep13_st)"
+echo "#define ep13_t        RLC_PREFIX(ep13_t)"
+echo
+REDEF2 epx ep13
+
 echo "#undef fp2_st"
 echo "#undef fp2_t"
 echo "#undef dv2_t"
@@ -195,6 +202,10 @@ echo "#undef dv12_t"
 echo "#define fp12_st        RLC_PREFIX(fp12_st)"
 echo "#define fp12_t         RLC_PREFIX(fp12_t)"
 echo "#define dv12_t         RLC_PREFIX(dv12_t)"
+echo "#undef fp13_t"
+echo "#undef dv13_t"
+echo "#define fp13_t        RLC_PREFIX(fp13_t)"
+echo "#define dv13_t        RLC_PREFIX(dv13_t)"
 echo "#undef fp18_st"
 echo "#undef fp18_t"
 echo "#undef dv18_t"
@@ -229,6 +240,8 @@ REDEF2 fpx fp6
 REDEF2 fpx fp8
 REDEF2 fpx fp9
 REDEF2 fpx fp12
+REDEF2 fpx fp13
+REDEF2_LOW fpx fp13
 REDEF2 fpx fp18
 REDEF2 fpx fp24
 REDEF2 fpx fp48
@@ -237,9 +250,18 @@ REDEF2 fpx fp54
 REDEF2 fbx fb2
 REDEF2 fbx fb4
 
+REDEF bc
+
 REDEF pp
 REDEF pc
+REDEF2 pc g1 | grep -v pc_
+REDEF2 pc g2 | grep -v pc_
+REDEF2 pc gt | grep -v pc_
 REDEF mpc
+REDEF2 mpc g1 | grep -v mpc_
+REDEF2 mpc g2 | grep -v mpc_
+REDEF2 mpc gt | grep -v mpc_
+REDEF2 mpc pc | grep -v mpc_
 
 echo "#undef crt_t"
 echo "#undef rsa_t"
@@ -258,6 +280,15 @@ REDEF cp
 
 REDEF md
 
+# Non-static helpers that are not declared in any public header.
+INTERNAL="fb_param_get fp_invn_asm fp2_rdc_basic fp2_rdc_integ fp3_rdc_basic
+	fp3_rdc_integ ed_map_ell2_5mod8 ep_mul_sim_lot_endom pp_dbl_k8_projc_new
+	pp_dbl_k8_projc_lazyr_new"
+for F in $INTERNAL; do echo "#undef $F"; done
+echo
+for F in $INTERNAL; do echo -e "#define $F \tRLC_PREFIX($F)"; done
+echo
+
 echo "#endif /* LABEL */"
 echo
 echo "#endif /* !RLC_LABEL_H */"